@@ -0,0 +1,38 @@
+/*!
+ * \file SU2_BENCH.hpp
+ * \brief Headers of the benchmark of the linear solvers.
+ *        The main program is in the <i>SU2_BENCH.cpp</i> file.
+ * \author Aerospace Design Laboratory (Stanford University).
+ * \version 1.2.0
+ *
+ * SU2 EDU, Copyright (C) 2014 Aerospace Design Laboratory (Stanford University).
+ *
+ * SU2 EDU is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 EDU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2 EDU. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <ctime>
+#include <sys/time.h>
+
+#include <string>
+#include <iomanip>
+
+#include "config_structure.hpp"
+#include "matrix_structure.hpp"
+#include "vector_structure.hpp"
+#include "linear_solvers_structure.hpp"
+#include "thread_structure.hpp"
+
+using namespace std;
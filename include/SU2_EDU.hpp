@@ -24,6 +24,7 @@
 #pragma once
 
 #include <ctime>
+#include <sys/time.h>
 
 #include<string>
 
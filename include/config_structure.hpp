@@ -101,6 +101,7 @@ private:
 	double *DV_Value;		/*!< \brief Previous value of the design variable. */
 	double LimiterCoeff;				/*!< \brief Limiter coefficient */
   unsigned long LimiterIter;	/*!< \brief Freeze the value of the limiter after a number of iterations */
+  bool Fused_Reconstruction;	/*!< \brief Bounds of the limiter with the gradients, and face states stored for each edge. */
 	double SharpEdgesCoeff;				/*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short Kind_Regime;	/*!< \brief Kind of adjoint function. */
 	unsigned short Kind_ObjFunc;	/*!< \brief Kind of objective function. */
@@ -366,6 +367,23 @@ private:
 	unsigned long Linear_Solver_Iter;		/*!< \brief Max iterations of the linear solver for the implicit formulation. */
 	unsigned long Linear_Solver_Restart_Frequency;   /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
 	double Linear_Solver_Relax;		/*!< \brief Relaxation coefficient of the linear solver. */
+  unsigned short nThreads;   /*!< \brief Number of shared memory threads (0 to use the environment variable SU2_NUM_THREADS). */
+  unsigned short Kind_Linear_Solver_Sweep;   /*!< \brief Schedule of the triangular sweeps of the LU-SGS and ILU preconditioners. */
+  unsigned short Kind_Point_Ordering;   /*!< \brief Renumbering of the points of the grid. */
+  bool Coarse_Point_Ordering;   /*!< \brief Renumber the agglomerated multigrid levels in the order of the fine grid. */
+  bool Linear_Solver_Prec_Float;   /*!< \brief Store the preconditioners in single precision. */
+  bool Jacobian_Free;   /*!< \brief Jacobian-free Newton-Krylov, finite difference matrix-vector products of the flow residual. */
+  double Jacobian_Free_Perturbation;   /*!< \brief Relative perturbation of the Jacobian-free products (0 for automatic). */
+  unsigned long Jacobian_Lag_Iter;   /*!< \brief Iterations between assemblies of the Jacobian of the flow system. */
+  double Jacobian_Lag_Stall;   /*!< \brief Residual reduction below which the lagged Jacobian is assembled again. */
+  bool Linear_Solver_Forcing;   /*!< \brief Adaptive tolerance of the linear solver (Eisenstat-Walker forcing terms). */
+  double *Linear_Solver_Forcing_Coeff;   /*!< \brief Coefficients of the forcing terms (gamma, alpha, maximum tolerance). */
+  unsigned short Kind_Linear_Solver_Ortho;   /*!< \brief Orthogonalization of the Krylov vectors of FGMRES. */
+  unsigned short Linear_Solver_Recycle;   /*!< \brief Number of recycled vectors of FGMRES between nonlinear iterations. */
+  unsigned short Kind_Linear_Solver_Smoother;   /*!< \brief Smoother of the multigrid preconditioner. */
+  unsigned short Kind_Linear_Solver_MG_Operator;   /*!< \brief Coarse operators of the multigrid preconditioner. */
+  long Linear_Solver_Dump_Iter;   /*!< \brief Iteration at which the linear system of the flow is written (-1 if it is never written). */
+  string Linear_Solver_Dump_FileName;   /*!< \brief File of the snapshot of the linear system of the flow. */
 	double AdjTurb_Linear_Error;		/*!< \brief Min error of the turbulent adjoint linear solver for the implicit formulation. */
   double EntropyFix_Coeff;              /*!< \brief Entropy fix coefficient. */
 	unsigned short AdjTurb_Linear_Iter;		/*!< \brief Min error of the turbulent adjoint linear solver for the implicit formulation. */
@@ -1549,6 +1567,13 @@ public:
 	 */
 	unsigned long GetLimiterIter(void);
   
+  /*!
+	 * \brief Check if the bounds of the limiter are found in the pass of the gradients, and the
+   *        reconstructed states of the flow are stored for each edge.
+	 * \return <code>TRUE</code> if the fused reconstruction is used; otherwise <code>FALSE</code>.
+	 */
+	bool GetFused_Reconstruction(void);
+  
   /*!
 	 * \brief Get the value of sharp edge limiter.
 	 * \return Value of the sharp edge limiter coefficient.
@@ -2211,6 +2236,105 @@ public:
 	 * \return relaxation coefficient of the linear solver for the implicit formulation.
 	 */
 	double GetLinear_Solver_Relax(void);
+  
+  /*!
+	 * \brief Get the number of shared memory threads.
+	 * \return Number of threads (0 if it is given by the environment variable SU2_NUM_THREADS).
+	 */
+  unsigned short GetnThreads(void);
+  
+  /*!
+	 * \brief Get the schedule of the triangular sweeps of the LU-SGS and ILU preconditioners.
+	 * \return Kind of schedule (sequential, level sets or multicolor).
+	 */
+  unsigned short GetKind_Linear_Solver_Sweep(void);
+  
+  /*!
+	 * \brief Get the orthogonalization of the Krylov vectors of FGMRES.
+	 * \return Kind of Gram-Schmidt process (modified, or classical applied twice).
+	 */
+  unsigned short GetKind_Linear_Solver_Ortho(void);
+  
+  /*!
+	 * \brief Get the size of the subspace that FGMRES recycles between nonlinear iterations.
+	 * \return Number of recycled vectors (0 if the recycling is not used).
+	 */
+  unsigned short GetLinear_Solver_Recycle(void);
+  
+  /*!
+	 * \brief Get the smoother of the multigrid preconditioner.
+	 * \return Kind of smoother (Jacobi, LU-SGS, ILU0 or linelet).
+	 */
+  unsigned short GetKind_Linear_Solver_Smoother(void);
+  
+  /*!
+	 * \brief Get the coarse operators of the multigrid preconditioner.
+	 * \return Kind of operator (rediscretized or Galerkin).
+	 */
+  unsigned short GetKind_Linear_Solver_MG_Operator(void);
+  
+  /*!
+	 * \brief Get the iteration at which the linear system of the flow is written (see SU2_BENCH).
+	 * \return Iteration of the snapshot (-1 if it is never written).
+	 */
+  long GetLinear_Solver_Dump_Iter(void);
+  
+  /*!
+	 * \brief Get the name of the file of the snapshot of the linear system of the flow.
+	 * \return Name of the file.
+	 */
+  string GetLinear_Solver_Dump_FileName(void);
+  
+  /*!
+	 * \brief Get the method that is applied to the rows of the Jacobian: the preconditioner,
+	 *        or the smoother if the preconditioner is multigrid.
+	 * \return Kind of preconditioner (Jacobi, LU-SGS, ILU0 or linelet).
+	 */
+  unsigned short GetKind_Linear_Solver_Prec_Rows(void);
+  
+  /*!
+	 * \brief Check if the preconditioners are stored in single precision.
+	 * \return <code>TRUE</code> if the ILU, Jacobi and linelet preconditioners are stored in single precision.
+	 */
+  bool GetLinear_Solver_Prec_Float(void);
+  
+  /*!
+	 * \brief Check if the flow system uses Jacobian-free (finite difference) matrix-vector products.
+	 * \return <code>TRUE</code> if the assembled Jacobian is only used as preconditioner.
+	 */
+  bool GetJacobian_Free(void);
+  
+  /*!
+	 * \brief Get the relative perturbation of the Jacobian-free matrix-vector products.
+	 * \return Relative perturbation (0 if it is the square root of the machine epsilon).
+	 */
+  double GetJacobian_Free_Perturbation(void);
+  
+  /*!
+	 * \brief Get the number of iterations between assemblies of the Jacobian of the flow system.
+	 * \return Number of iterations (1 if the Jacobian and the preconditioner are built in every iteration).
+	 */
+  unsigned long GetJacobian_Lag_Iter(void);
+  
+  /*!
+	 * \brief Get the stall criterion of the lagged Jacobian.
+	 * \return The Jacobian is assembled again if the ratio of the residuals of two iterations is larger.
+	 */
+  double GetJacobian_Lag_Stall(void);
+  
+  /*!
+	 * \brief Check if the tolerance of the linear solver is set in each iteration by the Eisenstat-Walker
+	 *        forcing terms (LINEAR_SOLVER_ERROR is then the minimum tolerance).
+	 * \return <code>TRUE</code> if the tolerance is adaptive.
+	 */
+  bool GetLinear_Solver_Forcing(void);
+  
+  /*!
+	 * \brief Get a coefficient of the Eisenstat-Walker forcing terms.
+	 * \param[in] val_index - 0 for gamma, 1 for alpha, 2 for the maximum tolerance.
+	 * \return Value of the coefficient.
+	 */
+  double GetLinear_Solver_Forcing_Coeff(unsigned short val_index);
 
 	/*!
 	 * \brief Get the kind of solver for the implicit solver.
@@ -3743,6 +3867,18 @@ public:
 	 */
 	bool GetDivide_Element(void);
   
+  /*!
+	 * \brief Get the renumbering of the points of the grid.
+	 * \return Kind of ordering (see ENUM_POINT_ORDERING).
+	 */
+  unsigned short GetKind_Point_Ordering(void);
+  
+  /*!
+	 * \brief Check if the agglomerated multigrid levels are renumbered in the order of the fine grid.
+	 * \return <code>TRUE</code> if the coarse levels inherit the ordering of the fine grid.
+	 */
+  bool GetCoarse_Point_Ordering(void);
+  
   /*!
 	 * \brief Divide the rectbles and hexahedron.
 	 * \return <code>TRUE</code> if the elements must be divided; otherwise <code>FALSE</code>.
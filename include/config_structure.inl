@@ -231,6 +231,8 @@ inline double CConfig::GetLimiterCoeff(void) { return LimiterCoeff; }
 
 inline unsigned long CConfig::GetLimiterIter(void) { return LimiterIter; }
 
+inline bool CConfig::GetFused_Reconstruction(void) { return Fused_Reconstruction; }
+
 inline double CConfig::GetSharpEdgesCoeff(void) { return SharpEdgesCoeff; }
 
 inline double CConfig::GetReynolds(void) { return Reynolds; }
@@ -448,6 +450,39 @@ inline unsigned long CConfig::GetLinear_Solver_Restart_Frequency(void) { return
 
 inline double CConfig::GetLinear_Solver_Relax(void) { return Linear_Solver_Relax; }
 
+inline unsigned short CConfig::GetnThreads(void) { return nThreads; }
+
+inline unsigned short CConfig::GetKind_Linear_Solver_Sweep(void) { return Kind_Linear_Solver_Sweep; }
+
+inline unsigned short CConfig::GetKind_Linear_Solver_Ortho(void) { return Kind_Linear_Solver_Ortho; }
+
+inline unsigned short CConfig::GetLinear_Solver_Recycle(void) { return Linear_Solver_Recycle; }
+
+inline unsigned short CConfig::GetKind_Linear_Solver_Smoother(void) { return Kind_Linear_Solver_Smoother; }
+
+inline unsigned short CConfig::GetKind_Linear_Solver_MG_Operator(void) { return Kind_Linear_Solver_MG_Operator; }
+
+inline long CConfig::GetLinear_Solver_Dump_Iter(void) { return Linear_Solver_Dump_Iter; }
+
+inline string CConfig::GetLinear_Solver_Dump_FileName(void) { return Linear_Solver_Dump_FileName; }
+
+inline unsigned short CConfig::GetKind_Linear_Solver_Prec_Rows(void) {
+  return (Kind_Linear_Solver_Prec == MULTIGRID_PREC ? Kind_Linear_Solver_Smoother : Kind_Linear_Solver_Prec); }
+
+inline bool CConfig::GetLinear_Solver_Prec_Float(void) { return Linear_Solver_Prec_Float; }
+
+inline bool CConfig::GetJacobian_Free(void) { return Jacobian_Free; }
+
+inline double CConfig::GetJacobian_Free_Perturbation(void) { return Jacobian_Free_Perturbation; }
+
+inline unsigned long CConfig::GetJacobian_Lag_Iter(void) { return Jacobian_Lag_Iter; }
+
+inline double CConfig::GetJacobian_Lag_Stall(void) { return Jacobian_Lag_Stall; }
+
+inline bool CConfig::GetLinear_Solver_Forcing(void) { return Linear_Solver_Forcing; }
+
+inline double CConfig::GetLinear_Solver_Forcing_Coeff(unsigned short val_index) { return Linear_Solver_Forcing_Coeff[val_index]; }
+
 inline unsigned short CConfig::GetKind_AdjTurb_Linear_Solver(void) { return Kind_AdjTurb_Linear_Solver; }
 
 inline unsigned short CConfig::GetKind_AdjTurb_Linear_Prec(void) { return Kind_AdjTurb_Linear_Prec; }
@@ -876,6 +911,10 @@ inline double CConfig::GetTotal_UnstTime(void) { return Total_UnstTime; }
 
 inline bool CConfig::GetDivide_Element(void) { return Divide_Element; }
 
+inline unsigned short CConfig::GetKind_Point_Ordering(void) { return Kind_Point_Ordering; }
+
+inline bool CConfig::GetCoarse_Point_Ordering(void) { return Coarse_Point_Ordering; }
+
 inline bool CConfig::GetEngine_Intake(void) { return Engine_Intake; }
 
 inline double CConfig::GetDV_Value(unsigned short val_dv) { return DV_Value[val_dv]; }
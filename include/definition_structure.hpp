@@ -80,6 +80,15 @@ void Integration_Preprocessing(CIntegration **integration_container, CGeometry *
  */
 void Numerics_Preprocessing(CNumerics ****numerics_container, CSolver ***solver_container, CGeometry **geometry, CConfig *config);
 
+/*! 
+ * \brief Definition of a copy of the numerics for each thread of the edge loops.
+ * \param[in] numerics_container - Description of the numerical method, the numerics of the first thread.
+ * \param[in] solver_container - Container vector with all the solutions.
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ */
+void Numerics_Thread_Preprocessing(CNumerics ****numerics_container, CSolver ***solver_container, CGeometry **geometry, CConfig *config);
+
 /*! 
  * \brief Do the geometrical preprocessing.
  * \param[in] geometry - Geometrical definition of the problem.
@@ -34,6 +34,8 @@
 #include <sstream>
 #include <cmath>
 #include <algorithm>
+#include <iomanip>
+#include <list>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -41,9 +43,13 @@
 #include "primal_grid_structure.hpp"
 #include "dual_grid_structure.hpp"
 #include "config_structure.hpp"
+#include "thread_structure.hpp"
 
 using namespace std;
 
+const unsigned long ORDERING_CACHE_POINTS = 256;    /*!< \brief Points that fit in the cache model of the orderings (a 64 KB cache, with 256 bytes of variables, primitives and gradients per point). */
+const unsigned long EDGE_COLOR_GROUP = 128;         /*!< \brief Consecutive edges that are colored together (and done by the same thread) in the edge loops. */
+
 /*! 
  * \class CGeometry
  * \brief Parent class for defining the geometry of the problem (complete geometry, 
@@ -87,6 +93,26 @@ protected:
 	nMarker;				/*!< \brief Number of different markers of the mesh. */
 	bool FinestMGLevel; /*!< \brief Indicates whether the geometry class contains the finest (original) multigrid mesh. */
   unsigned long Max_GlobalPoint;  /*!< \brief Greater global point in the domain local structure. */
+  vector<unsigned long> EdgeColor_Begin,  /*!< \brief Position in EdgeColor_Group of the first group of each color (one more entry than colors). */
+  EdgeColor_Group;                        /*!< \brief Groups of EDGE_COLOR_GROUP consecutive edges, sorted by color. */
+  vector<unsigned long> LS_Coeff_Begin;   /*!< \brief Position in LS_Coeff of the first neighbour of each point (empty if not computed). */
+  vector<double> LS_Coeff;                /*!< \brief Coefficients of the least squares gradients, nDim for each neighbour of each point. */
+  vector<double> Edge_Geometry;           /*!< \brief Geometric factors of the edges for the viscous numerics, 2*nDim+4 for each edge (empty if not computed). */
+
+  /*!
+   * \brief Arguments of the threaded edge loops.
+   */
+  struct CEdgeColor_Loop {
+    CGeometry *geometry;
+    void (*kernel)(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+    void *data;
+  };
+
+  /*!
+   * \brief Threaded edge loop (see CThreadPool::Run), each thread does a static chunk of the groups of
+   *        every color, and waits for the others before the next color.
+   */
+  static void EdgeColor_Thread(void *data, unsigned short iThread, unsigned short nThread);
 
 public:
 	unsigned long *nElem_Bound;			/*!< \brief Number of elements of the boundary. */
@@ -317,6 +343,100 @@ public:
 	 */
 	virtual void SetRCM_Ordering(CConfig *config);
   
+  /*!
+	 * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+	 */
+	virtual void SetPoint_Ordering(CConfig *config);
+  
+  /*!
+	 * \brief Estimate the memory locality of the edge loops with a renumbering of the points.
+   * \param[in] Result - Renumbering, Result[new index] = old index (empty for the current numbering).
+   * \param[out] Bandwidth - Maximum difference between the indices of the two points of an edge.
+   * \param[out] Profile - Mean distance from each point to its lowest neighbor (envelope of a row of the matrix).
+   * \param[out] Misses - Misses per edge of a loop over the edges sorted by their first point, with a
+   *             least recently used cache of ORDERING_CACHE_POINTS points.
+	 */
+	void GetOrdering_Quality(const vector<unsigned long> & Result, unsigned long & Bandwidth, double & Profile, double & Misses);
+
+  /*!
+   * \brief Kernel of an edge loop, it must only write to the arrays of the two points of each edge
+   *        (and to the entries of the edge), see Run_EdgeLoop.
+   * \param[in] data - Arguments of the kernel.
+   * \param[in] iThread - Index of the thread (to select its auxiliary structures).
+   * \param[in] iEdge_begin - First edge.
+   * \param[in] iEdge_end - Last edge (not included).
+   */
+  typedef void (*EdgeKernel)(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+
+  /*!
+   * \brief Color the groups of EDGE_COLOR_GROUP consecutive edges (greedy, first color available),
+   *        so that the groups of one color don't share points and can be done by different threads.
+	 */
+	void SetEdge_Coloring(void);
+
+  /*!
+   * \brief Get the number of colors of the edge groups.
+   * \return Number of colors (0 if SetEdge_Coloring has not been called).
+   */
+  unsigned short GetnEdgeColor(void);
+
+  /*!
+   * \brief Parallel efficiency of the coloring, the edges over the work of the slowest thread of each color.
+   * \param[in] val_nThread - Number of threads.
+   * \return Efficiency (1 is a perfect balance).
+   */
+  double GetEdgeColor_Efficiency(unsigned short val_nThread);
+
+  /*!
+   * \brief Loop over all the edges with the threads of the pool, color by color. The groups are always
+   *        done in the same order, so the result doesn't depend on the number of threads.
+   * \param[in] kernel - Kernel of the loop.
+   * \param[in] data - Arguments of the kernel.
+   */
+  void Run_EdgeLoop(EdgeKernel kernel, void *data);
+  
+  /*!
+   * \brief Coefficients of the weighted least squares gradients, grad(U)_i = sum over the neighbours j of
+   *        Coeff_ij*(U_j-U_i), with Coeff_ij = S_i*(x_j-x_i)/|x_j-x_i|^2 and S_i = inv(R)*transpose(inv(R)).
+   *        They only depend on the coordinates, nothing is done if they are already computed.
+   */
+  void SetLS_Coeff(void);
+  
+  /*!
+   * \brief The coordinates have changed (grid deformation or motion), the coefficients of the least
+   *        squares gradients will be computed again by the next SetLS_Coeff.
+   */
+  void ResetLS_Coeff(void);
+  
+  /*!
+   * \brief Get the coefficients of the least squares gradient of a point (see SetLS_Coeff).
+   * \param[in] val_point - Point.
+   * \return Coefficients of the neighbours of the point, nDim for each one in the order of CPoint::GetPoint.
+   */
+  double *GetLS_Coeff(unsigned long val_point);
+  
+  /*!
+   * \brief Geometric factors of each edge used by the average gradient numerics: the unit normal (nDim),
+   *        the area, the edge vector x_j-x_i (nDim), its length, 1/|x_j-x_i|^2 and Normal.(x_j-x_i)/|x_j-x_i|^2
+   *        (the last two are zero if the points coincide). They depend on the coordinates and on the dual
+   *        grid, nothing is done if they are already computed.
+   */
+  void SetEdge_Geometry(void);
+  
+  /*!
+   * \brief The coordinates or the dual grid have changed, the geometric factors of the edges will be
+   *        computed again by the next SetEdge_Geometry.
+   */
+  void ResetEdge_Geometry(void);
+  
+  /*!
+   * \brief Get the geometric factors of an edge (see SetEdge_Geometry).
+   * \param[in] val_edge - Edge.
+   * \return The 2*nDim+4 factors of the edge.
+   */
+  double *GetEdge_Geometry(unsigned long val_edge);
+  
 	/*!
 	 * \brief A virtual member.
 	 */		
@@ -819,6 +939,35 @@ public:
 	 */
 	void SetRCM_Ordering(CConfig *config);
   
+  /*!
+	 * \brief Compute the Reverse Cuthill-McKee renumbering of the domain points (the others keep their place).
+   * \param[out] Result - Renumbering, Result[new index] = old index.
+	 */
+	void GetRCM_Ordering(vector<unsigned long> & Result);
+  
+  /*!
+	 * \brief Compute a space-filling curve renumbering of the domain points, they are sorted by the index
+   *        along the curve of their coordinates (quantized to 2^21 cells per direction in the bounding box).
+   * \param[in] val_kind - ORDERING_HILBERT or ORDERING_MORTON.
+   * \param[out] Result - Renumbering, Result[new index] = old index.
+	 */
+	void GetSFC_Ordering(unsigned short val_kind, vector<unsigned long> & Result);
+  
+  /*!
+	 * \brief Renumber the points (coordinates, elements and boundary elements), the connectivity
+   *        has to be computed again.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Result - Renumbering, Result[new index] = old index.
+	 */
+	void SetReordering(CConfig *config, const vector<unsigned long> & Result);
+  
+  /*!
+	 * \brief Report the bandwidth, profile and cache misses of all the orderings, and renumber
+   *        the points with the one of POINT_ORDERING.
+   * \param[in] config - Definition of the particular problem.
+	 */
+	void SetPoint_Ordering(CConfig *config);
+  
 	/*!
 	 * \brief Function declaration to avoid partially overridden classes.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -1102,6 +1251,15 @@ public:
 	 * \brief Destructor of the class.
 	 */
 	~CMultiGridGeometry(void);
+  
+  /*!
+	 * \brief Renumber the agglomerated control volumes in the order of their first child, so the
+   *        coarse level inherits the ordering of the fine one (done at the end of the agglomeration,
+   *        with COARSE_POINT_ORDERING).
+   * \param[in] fine_grid - Geometrical definition of the fine level.
+   * \param[in] config - Definition of the particular problem.
+	 */
+	void SetCoarse_Ordering(CGeometry *fine_grid, CConfig *config);
 
 	/*! 
 	 * \brief Determine if a CVPoint van be agglomerated, if it have the same marker point as the seed.
@@ -82,6 +82,8 @@ inline void CGeometry::SetPoint_Connectivity(void) { }
 
 inline void CGeometry::SetRCM_Ordering(CConfig *config) { }
 
+inline void CGeometry::SetPoint_Ordering(CConfig *config) { }
+
 inline void CGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, double val_smooth_coeff, CConfig *config) { }
 
 inline void CGeometry::SetCoord(CGeometry *geometry) { }
@@ -128,6 +130,16 @@ inline unsigned long CGeometry::GetnVertex(unsigned short val_marker) { return n
 
 inline unsigned long CGeometry::GetnEdge(void) { return nEdge; }
 
+inline unsigned short CGeometry::GetnEdgeColor(void) { return (EdgeColor_Begin.empty() ? 0 : EdgeColor_Begin.size()-1); }
+
+inline void CGeometry::ResetLS_Coeff(void) { LS_Coeff_Begin.clear(); LS_Coeff.clear(); }
+
+inline double *CGeometry::GetLS_Coeff(unsigned long val_point) { return &LS_Coeff[0] + LS_Coeff_Begin[val_point]*nDim; }
+
+inline void CGeometry::ResetEdge_Geometry(void) { Edge_Geometry.clear(); }
+
+inline double *CGeometry::GetEdge_Geometry(unsigned long val_edge) { return &Edge_Geometry[0] + val_edge*(2*nDim+4); }
+
 inline bool CGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) {return 0;}
 
 inline void CGeometry::SetBoundVolume(void) { }
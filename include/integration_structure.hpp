@@ -34,6 +34,8 @@
 
 using namespace std;
 
+class CJacobianFreeProduct;
+
 /*! 
  * \class CIntegration
  * \brief Main class for doing the space integration, time integration, and monitoring 
@@ -53,6 +55,10 @@ protected:
 	Convergence_OneShot,	/*!< \brief To indicate if the one-shot method has converged. */
 	Convergence_FullMG;		/*!< \brief To indicate if the Full Multigrid has converged and it is necessary to add a new level. */
 	double InitResidual;	/*!< \brief Initial value of the residual to evaluate the convergence level. */
+	CJacobianFreeProduct *JacobianFree;	/*!< \brief Jacobian-free matrix-vector product of the finest grid (NULL if it is not used). */
+	unsigned long Jacobian_Age;	/*!< \brief Iterations since the Jacobian was assembled (0 if it has never been). */
+	unsigned short Jacobian_Mesh;	/*!< \brief Finest grid of the iteration where the Jacobian was assembled. */
+	double Jacobian_Res_Old;	/*!< \brief Residual of the previous iteration, to detect the stall of a lagged Jacobian. */
 
 public:
 	
@@ -304,6 +310,101 @@ public:
 	virtual void Smooth_Solution(unsigned short RunTime_EqSystem, CSolver **solver, CGeometry *geometry,
                        unsigned short val_nSmooth, double val_smooth_coeff, CConfig *config);
 
+	/*!
+	 * \brief Set up the Jacobian-free matrix-vector product of the finest grid (first call), and give it
+	 *        to the linear solver of the flow.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] numerics_container - Description of the numerical method (the way in which the equations are solved).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+	 */
+	void SetJacobianFree(CGeometry **geometry, CSolver ***solver_container, CNumerics ****numerics_container,
+	                     CConfig *config, unsigned short RunTime_EqSystem);
+
+	/*!
+	 * \brief Decide if the Jacobians of all the grids are assembled in this iteration, or the lagged ones (and
+	 *        their preconditioners) are reused: they are assembled every JACOBIAN_LAG_ITER iterations, and when
+	 *        the residual reduction of one iteration is worse than JACOBIAN_LAG_STALL.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+	 */
+	void SetJacobian_Update(CSolver ***solver_container, CConfig *config, unsigned short RunTime_EqSystem);
+
+};
+
+/*!
+ * \class CJacobianFreeProduct
+ * \brief Jacobian-free matrix-vector product of the implicit flow system, the product of the
+ *        Jacobian of the residual is a finite difference of the residual of the space integration.
+ * \author Aerospace Design Laboratory (Stanford University).
+ * \version 1.2.0
+ *
+ * The product is v = Vol/dt.u + (R(U+eps.u) - R(U))/eps, with the perturbation of Pernice and
+ * Walker, eps = delta.sqrt(1+|U|)/|u| (delta is the square root of the machine epsilon by
+ * default). The residual is evaluated without updating the Jacobian (it is the preconditioner),
+ * and the right hand side of the linear system (stored in LinSysRes) and the solution are restored
+ * after each product. The primitive variables, gradients, limiters and reconstructed edge states
+ * are not restored, they are left at the last perturbed state: the caller must run the
+ * Preprocessing of the solver before using them (the iterations do it after updating the solution).
+ */
+class CJacobianFreeProduct : public CMatrixVectorProduct {
+private:
+	CIntegration *integration;	/*!< \brief Integration that evaluates the residual. */
+	CGeometry *geometry;	/*!< \brief Geometry of the grid. */
+	CSolver **solver_container;	/*!< \brief Solutions of the grid. */
+	CNumerics **numerics;	/*!< \brief Numerical methods of the system. */
+	CConfig *config;	/*!< \brief Definition of the particular problem. */
+	unsigned short iMesh,	/*!< \brief Grid of the product. */
+	RunTime_EqSystem,	/*!< \brief System of equations. */
+	MainSolver;	/*!< \brief Position of the solver in the container. */
+	double Perturbation,	/*!< \brief Relative perturbation (delta). */
+	Norm_Base;	/*!< \brief Norm of the base state U. */
+	CSysVector *Solution_Base,	/*!< \brief Base state U. */
+	*Residual_Base,	/*!< \brief Residual of the base state R(U). */
+	*Residual_Backup;	/*!< \brief Right hand side of the linear system while the residual is evaluated. */
+	mutable unsigned long nEval;	/*!< \brief Residual evaluations since the last call to SetBase. */
+
+public:
+
+	/*!
+	 * \brief Constructor of the class.
+	 * \param[in] val_integration - Integration that evaluates the residual.
+	 * \param[in] val_geometry - Geometry of the grid.
+	 * \param[in] val_solver_container - Solutions of the grid.
+	 * \param[in] val_numerics - Numerical methods of the system.
+	 * \param[in] val_config - Definition of the particular problem.
+	 * \param[in] val_iMesh - Grid of the product.
+	 * \param[in] val_RunTime_EqSystem - System of equations.
+	 */
+	CJacobianFreeProduct(CIntegration *val_integration, CGeometry *val_geometry, CSolver **val_solver_container,
+	                     CNumerics **val_numerics, CConfig *val_config, unsigned short val_iMesh, unsigned short val_RunTime_EqSystem);
+
+	/*!
+	 * \brief Destructor of the class.
+	 */
+	~CJacobianFreeProduct(void);
+
+	/*!
+	 * \brief Keep the state and its residual (LinSysRes, just computed by the space integration)
+	 *        as the base of the finite differences, and reset the counter of residual evaluations.
+	 */
+	void SetBase(void);
+
+	/*!
+	 * \brief Get the number of residual evaluations since the last call to SetBase.
+	 * \return Number of residual evaluations.
+	 */
+	unsigned long GetnResidual_Eval(void);
+
+	/*!
+	 * \brief Finite difference product of the Jacobian of the implicit system.
+	 * \param[in] u - CSysVector that is being multiplied by the Jacobian.
+	 * \param[out] v - CSysVector that is the result of the product.
+	 */
+	void operator()(const CSysVector & u, CSysVector & v) const;
+
 };
 
 /*!
@@ -55,6 +55,52 @@ class CSysSolve {
   
 private:
   
+  vector<CSysVector> W;          /*!< \brief Krylov vectors of FGMRES (and work vectors of BCGSTAB), kept between calls. */
+  vector<CSysVector> Z;          /*!< \brief Preconditioned Krylov vectors of FGMRES, kept between calls. */
+  vector<vector<double> > H;     /*!< \brief Hessenberg matrix of FGMRES. */
+  vector<double> g,              /*!< \brief Right-hand-side of the reduced system of FGMRES. */
+  sn,                            /*!< \brief Sines of the Givens rotations of FGMRES. */
+  cs,                            /*!< \brief Cosines of the Givens rotations of FGMRES. */
+  y,                             /*!< \brief Solution of the reduced system of FGMRES. */
+  proj;                          /*!< \brief Projections of the block Gram-Schmidt process. */
+  unsigned short Kind_GramSchmidt;           /*!< \brief Orthogonalization of the Krylov vectors of FGMRES. */
+  unsigned short nRecycle;       /*!< \brief Maximum number of recycled vectors of FGMRES (0 if the recycling is not used). */
+  unsigned short nRecycle_Set;   /*!< \brief Number of recycled vectors available from the previous solutions. */
+  bool Recycle_NewMatrix;        /*!< \brief The matrix has changed, the images of the recycled vectors have to be recomputed. */
+  vector<CSysVector> Rec_U,      /*!< \brief Recycled vectors (approximate eigenvectors) of FGMRES, kept between calls. */
+  Rec_C,                         /*!< \brief Images of the recycled vectors, C = A.U, orthonormal. */
+  Rec_Aux;                       /*!< \brief New recycled vectors and images while they are being computed. */
+  vector<vector<double> > Rec_B, /*!< \brief Projections of the new Krylov vectors on the images, B = C^T.A.Z. */
+  Rec_H;                         /*!< \brief Copy of the Hessenberg matrix before the Givens rotations. */
+  vector<double> Rec_Sol;        /*!< \brief Coefficients of the last correction of the solution in the search space [U, Z]. */
+  unsigned short MG_nLevel;      /*!< \brief Number of levels of the multigrid preconditioner arrays (0 if not used). */
+  CSysMatrix **MG_Operator;      /*!< \brief Operator of each level of the multigrid preconditioner (Jacobian or Galerkin). */
+  CSysMatrix **MG_Galerkin;      /*!< \brief Galerkin operators of the coarse levels, owned by the solver. */
+  CSysVector **MG_Res,           /*!< \brief Restricted residual of each coarse level. */
+  **MG_Sol,                      /*!< \brief Correction of each coarse level. */
+  **MG_Aux,                      /*!< \brief Residual of each level. */
+  **MG_Cor;                      /*!< \brief Smoothing correction (and prolongated correction) of each level. */
+  CMatrixVectorProduct *MatVec_Product;      /*!< \brief Matrix-vector product of the Krylov solvers, if it is not the Jacobian (not owned). */
+  bool Coarse_Jacobian;          /*!< \brief The Jacobians of the coarse levels are assembled (they can be used by the multigrid preconditioner). */
+  bool New_Matrix;               /*!< \brief The Jacobians have been assembled since the last call, the preconditioner has to be built again. */
+  bool New_Operator;             /*!< \brief The matrix has changed since the last call, even if the preconditioner is reused (time step terms of a lagged Jacobian). */
+  bool Prec_Built;               /*!< \brief The preconditioner has been built at least once. */
+  double Forcing_Res;            /*!< \brief Norm of the right hand side of the previous call (0 before the first call). */
+  double Forcing_Tol;            /*!< \brief Tolerance of the last call to Solve. */
+  unsigned long Workspace_Memory;            /*!< \brief Memory (bytes) of the workspace of this solver. */
+  static unsigned long Total_Workspace_Memory; /*!< \brief Memory (bytes) of the workspace of all the solvers. */
+  static unsigned long Peak_Workspace_Memory;  /*!< \brief Peak of Total_Workspace_Memory. */
+  
+  /*!
+   * \brief Size the workspace, it is only allocated on first use or if it has to grow
+   *        (more vectors, a larger subspace, or a system of a different size).
+   * \param[in] x - Vector with the size of the system.
+   * \param[in] val_nW - Number of vectors needed in W.
+   * \param[in] val_nZ - Number of vectors needed in Z.
+   * \param[in] m - Size of the subspace (Hessenberg matrix and Givens rotations).
+   */
+  void SetWorkspace(const CSysVector & x, unsigned long val_nW, unsigned long val_nZ, unsigned long m);
+  
   /*!
    * \brief sign transfer function
    * \param[in] x - value having sign prescribed
@@ -121,6 +167,70 @@ private:
    */
   void ModGramSchmidt(int i, vector<vector<double> > & Hsbg, vector<CSysVector> & w);
   
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization applied twice (CGS2)
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in,out] Hsbg - the upper Hessenberg begin updated
+   * \param[in,out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * \pre the vectors w[0:i] are orthonormal
+   * \post the vectors w[0:i+1] are orthonormal
+   *
+   * All the projections on w[0:i] are computed in one fused pass (multiDotProd)
+   * and removed in another (Plus_Multi_AX), and the process is repeated once,
+   * which gives the same orthogonality as ModGramSchmidt. The new vector is read
+   * 4 times (plus the norm) instead of 2 or 3 times for each previous vector.
+   */
+  void ClassicalGramSchmidt2(int i, vector<vector<double> > & Hsbg, vector<CSysVector> & w);
+  
+  /*!
+   * \brief Recompute the images of the recycled vectors with a new matrix, C = A.U,
+   *        and orthonormalize them (the same combinations are applied to U).
+   * \param[in] mat_vec - Matrix-vector product of the new matrix.
+   *
+   * Vectors whose image is (numerically) dependent on the previous ones are dropped.
+   */
+  void SetRecycle_Images(CMatrixVectorProduct & mat_vec);
+  
+  /*!
+   * \brief Update the recycled vectors with the last correction of the solution and the
+   *        harmonic Ritz vectors of the last solution.
+   * \param[in] nKrylov - Number of Krylov vectors of the last solution.
+   *
+   * The search space [U, Z] satisfies A.[U, Z] = [C, W].G, with G = [I B; 0 H]. The k-1 harmonic
+   * Ritz vectors of smallest harmonic Ritz value, G^T.G.p = theta.G^T.[C, W]^T.[C, W(0:n-1)].p
+   * (the deflation of the flexible GCRO-DR), are computed as an invariant subspace by block
+   * inverse iteration on the small dense problem, so complex pairs need no special treatment.
+   * The last correction (see Rec_Sol) is kept as well, in the tail of the convergence the
+   * successive corrections of the nonlinear iterations are almost parallel.
+   * The new images are C = [C, W].G.P, orthonormalized by a QR factorization.
+   */
+  void SetRecycle_Subspace(int nKrylov);
+  
+  /*!
+   * \brief Apply the smoother of the multigrid preconditioner, x = S^-1.b
+   * \param[in] Jac - Operator of the level.
+   * \param[in] b - Right hand side.
+   * \param[out] x - Result of the smoothing.
+   * \param[in] geometry - Geometry of the level.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MultiGrid_Smooth(CSysMatrix *Jac, const CSysVector & b, CSysVector & x, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Compute the tolerance of the linear solver from the Eisenstat-Walker forcing terms (choice 2),
+   *        tol = gamma.(|b|/|b_old|)^alpha, the right hand side being the nonlinear residual.
+   * \param[in] res_norm - Norm of the right hand side of this call.
+   * \param[in] config - Definition of the particular problem.
+   * \return Tolerance of this call.
+   *
+   * The tolerance does not drop faster than gamma.tol_old^alpha while that is larger than 0.1,
+   * a good reduction of one iteration would otherwise ask for a very tight solution of the next.
+   * It is bounded by the maximum tolerance (also used in the first call) and LINEAR_SOLVER_ERROR.
+   */
+  double SetForcing_Tolerance(double res_norm, CConfig *config);
+  
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in,out] os - ostream class object for output
@@ -145,6 +255,99 @@ private:
   
 public:
   
+  /*!
+   * \brief Constructor of the class, the workspace is empty.
+   */
+  CSysSolve(void);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CSysSolve(void);
+  
+  /*!
+   * \brief Get the memory of the Krylov workspace of this solver.
+   * \return Memory in bytes.
+   */
+  unsigned long GetWorkspace_Memory(void);
+  
+  /*!
+   * \brief Get the peak memory of the Krylov workspaces of all the solvers.
+   * \return Memory in bytes.
+   */
+  static unsigned long GetPeak_Workspace_Memory(void);
+  
+  /*!
+   * \brief Set the orthogonalization of the Krylov vectors of FGMRES.
+   * \param[in] val_kind - Kind of Gram-Schmidt process (see ENUM_GRAM_SCHMIDT).
+   */
+  void SetKind_GramSchmidt(unsigned short val_kind);
+  
+  /*!
+   * \brief Set the number of vectors that FGMRES recycles between calls, the recycled vectors
+   *        are discarded if it is set to 0.
+   * \param[in] val_nRecycle - Number of recycled vectors.
+   */
+  void SetRecycle(unsigned short val_nRecycle);
+  
+  /*!
+   * \brief Set the matrix-vector product of the Krylov solvers of Solve (e.g. Jacobian-free),
+   *        the Jacobian is still used to build the preconditioner.
+   * \param[in] val_mat_vec - Matrix-vector product, NULL to use the Jacobian.
+   */
+  void SetMatrixVectorProduct(CMatrixVectorProduct *val_mat_vec);
+  
+  /*!
+   * \brief Set if the Jacobians have been assembled since the last call to Solve, if not
+   *        (lagged Jacobian) the preconditioner of the previous call is reused.
+   * \param[in] val_new_matrix - <code>TRUE</code> if the Jacobians are new.
+   */
+  void SetNew_Matrix(bool val_new_matrix);
+  
+  /*!
+   * \brief Set if the matrix has changed since the last call to Solve. A lagged Jacobian keeps its preconditioner,
+   *        but its diagonal gets the new time step terms, so the images of the recycled vectors of FGMRES are recomputed.
+   * \param[in] val_new_operator - <code>TRUE</code> if the matrix has changed.
+   */
+  void SetNew_Operator(bool val_new_operator);
+  
+  /*!
+   * \brief Set if the Jacobians of the coarse levels are assembled by the solver, if not,
+   *        the multigrid preconditioner always uses Galerkin operators.
+   * \param[in] val_coarse_jacobian - <code>TRUE</code> if the coarse Jacobians are assembled.
+   */
+  void SetCoarse_Jacobian(bool val_coarse_jacobian);
+  
+  /*!
+   * \brief Get the tolerance of the last call to Solve (adaptive if LINEAR_SOLVER_FORCING is set).
+   * \return Relative tolerance of the linear solver.
+   */
+  double GetTolerance(void);
+  
+  /*!
+   * \brief Set the levels of the multigrid preconditioner: allocate the workspace (first call),
+   *        compute the Galerkin operators if they are used, and build the smoothers.
+   * \param[in] Jacobian - Jacobians of all the levels.
+   * \param[in] LinSysRes - Residuals of all the levels.
+   * \param[in] geometry - Geometries of all the levels.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Finest level of the preconditioner.
+   */
+  void SetMultiGrid_Preconditioner(CSysMatrix **Jacobian, CSysVector **LinSysRes, CGeometry **geometry, CConfig *config, unsigned short iMesh);
+  
+  /*!
+   * \brief One V (mu = 0) or W (mu = 1) correction scheme cycle of the multigrid preconditioner,
+   *        with one pre- and one post-smoothing on each level.
+   * \param[in] b - Right hand side of the level.
+   * \param[in,out] x - Approximate solution of the level.
+   * \param[in] zero_guess - The initial guess is zero (the input value of x is not used).
+   * \param[in] geometry - Geometries of all the levels.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Level of the cycle.
+   * \param[in] mu - Kind of cycle.
+   */
+  void MultiGrid_Preconditioner(const CSysVector & b, CSysVector & x, bool zero_guess, CGeometry **geometry, CConfig *config, unsigned short iMesh, unsigned short mu);
+  
   /*! \brief Conjugate Gradient method
    * \param[in] b - the right hand size vector
    * \param[in,out] x - on entry the intial guess, on exit the solution
@@ -223,4 +426,36 @@ public:
   
 };
 
+/*!
+ * \class CMultiGridPreconditioner
+ * \brief Preconditioner that applies one cycle of agglomeration multigrid (see CSysSolve::MultiGrid_Preconditioner)
+ */
+class CMultiGridPreconditioner : public CPreconditioner {
+private:
+  CSysSolve* system;    /*!< \brief Solver that owns the levels of the preconditioner. */
+  CGeometry** geometry; /*!< \brief Geometries of all the levels. */
+  CConfig* config;      /*!< \brief Definition of the particular problem. */
+  unsigned short iMesh; /*!< \brief Finest level of the preconditioner. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] system_ref - solver whose levels have been set by SetMultiGrid_Preconditioner
+   */
+  CMultiGridPreconditioner(CSysSolve & system_ref, CGeometry **geometry_ref, CConfig *config_ref, unsigned short val_iMesh);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CMultiGridPreconditioner() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 #include "linear_solvers_structure.inl"
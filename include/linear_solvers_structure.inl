@@ -22,6 +22,25 @@
 
 #pragma once
 
+inline unsigned long CSysSolve::GetWorkspace_Memory(void) { return Workspace_Memory; }
+
+inline unsigned long CSysSolve::GetPeak_Workspace_Memory(void) { return Peak_Workspace_Memory; }
+
+inline void CSysSolve::SetKind_GramSchmidt(unsigned short val_kind) { Kind_GramSchmidt = val_kind; }
+
+inline void CSysSolve::SetRecycle(unsigned short val_nRecycle) {
+  nRecycle = val_nRecycle; if (nRecycle_Set > nRecycle) nRecycle_Set = nRecycle; }
+
+inline void CSysSolve::SetMatrixVectorProduct(CMatrixVectorProduct *val_mat_vec) { MatVec_Product = val_mat_vec; }
+
+inline void CSysSolve::SetNew_Matrix(bool val_new_matrix) { New_Matrix = val_new_matrix; }
+
+inline void CSysSolve::SetNew_Operator(bool val_new_operator) { New_Operator = val_new_operator; }
+
+inline void CSysSolve::SetCoarse_Jacobian(bool val_coarse_jacobian) { Coarse_Jacobian = val_coarse_jacobian; }
+
+inline double CSysSolve::GetTolerance(void) { return Forcing_Tol; }
+
 inline double CSysSolve::Sign(const double & x, const double & y) const {
   if (y == 0.0)
     return 0.0;
@@ -29,3 +48,14 @@ inline double CSysSolve::Sign(const double & x, const double & y) const {
     return (y < 0 ? -fabs(x) : fabs(x));
   }
 }
+
+inline CMultiGridPreconditioner::CMultiGridPreconditioner(CSysSolve & system_ref, CGeometry **geometry_ref, CConfig *config_ref, unsigned short val_iMesh) {
+  system = &system_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+  iMesh = val_iMesh;
+}
+
+inline void CMultiGridPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  system->MultiGrid_Preconditioner(u, v, true, geometry, config, iMesh, config->GetMGCycle());
+}
@@ -26,6 +26,7 @@
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
+#include <climits>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
@@ -37,6 +38,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <string>
+#include <cstring>
 #include <vector>
 #include <algorithm>
 
@@ -46,6 +48,11 @@
 
 using namespace std;
 
+const unsigned long MATRIX_ALIGNMENT = 64;     /*!< \brief Alignment (bytes) of the values of the matrices, one cache line (four 4x4 float blocks, or half a double one). */
+const unsigned short LINELET_LANES = 4;        /*!< \brief Linelets of each batch of the linelet preconditioner (SIMD lanes of the block Thomas algorithm). */
+const unsigned long LINELET_PADDING = ~0UL;    /*!< \brief Point of the padding elements of the batches of linelets. */
+const unsigned short JACOBI_LANES = 8;         /*!< \brief Diagonal blocks inverted together by the Jacobi preconditioner (SIMD lanes of the closed-form inverses). */
+
 /*!
  * \class CSysMatrix
  * \brief Main class for defining sparse matrices-by-blocks
@@ -60,9 +67,16 @@ private:
 	nVar,                   /*!< \brief Number of variables. */
 	nEqn;                   /*!< \brief Number of equations. */
 	double *matrix;            /*!< \brief Entries of the sparse matrix. */
-	double *ILU_matrix;         /*!< \brief Entries of the ILU sparse matrix. */
-	unsigned long *row_ptr;    /*!< \brief Pointers to the first element in each row. */
-	unsigned long *col_ind;    /*!< \brief Column index for each of the elements in val(). */
+	double *ILU_matrix;         /*!< \brief Entries of the ILU(0) factors (L, U, and inverse of the diagonal of U). */
+	unsigned long *row_ptr;    /*!< \brief Pointers to the first element in each row (NULL if the compact indices are used). */
+	unsigned long *col_ind;    /*!< \brief Column index for each of the elements in val() (NULL if the compact indices are used). */
+  unsigned int *row_ptr_32;  /*!< \brief Compact (32-bit) row_ptr, used instead of row_ptr if the matrix fits, NULL otherwise. */
+  unsigned int *col_ind_32;  /*!< \brief Compact (32-bit) col_ind, used instead of col_ind if the matrix fits, NULL otherwise. */
+  unsigned long Index_Memory_Saved;              /*!< \brief Memory (bytes) of the indices saved by the compact indices of this matrix. */
+  static unsigned long Total_Index_Memory_Saved; /*!< \brief Memory (bytes) of the indices saved by the compact indices of all the matrices. */
+	unsigned long *dia_ptr;    /*!< \brief Position in col_ind of the diagonal block of each row. */
+	unsigned long *edge_ptr;   /*!< \brief Position in col_ind of the (i,i), (i,j), (j,i) and (j,j) blocks of each edge. */
+	unsigned long nEdge;       /*!< \brief Number of edges in edge_ptr (zero if the matrix is not edge based). */
 	unsigned long nnz;         /*!< \brief Number of possible nonzero entries in the matrix. */
 	double *block;             /*!< \brief Internal array to store a subblock of the matrix. */
 	double *block_inverse;             /*!< \brief Internal array to store a subblock of the matrix. */
@@ -72,13 +86,146 @@ private:
 	double *aux_vector;         /*!< \brief Auxilar array to store intermediate results. */
   double *sum_vector;         /*!< \brief Auxilar array to store intermediate results. */
 	double *invM;              /*!< \brief Inverse of (Jacobi) preconditioner. */
+  float *ILU_matrix_flt;     /*!< \brief Single precision ILU(0) factors (used instead of ILU_matrix if LINEAR_SOLVER_PREC_FLOAT). */
+  float *invM_flt;           /*!< \brief Single precision inverse of the Jacobi preconditioner (used instead of invM if LINEAR_SOLVER_PREC_FLOAT). */
 	bool *LineletBool;                          /*!< \brief Identify if a point belong to a linelet. */
 	vector<unsigned long> *LineletPoint;        /*!< \brief Linelet structure. */
 	unsigned long nLinelet;                     /*!< \brief Number of Linelets in the system. */
-  double **UBlock, **invUBlock, **LBlock,
-  **yVector, **zVector, **rVector, *LFBlock,
-  *LyVector, *FzVector, *AuxVector;           /*!< \brief Arrays of the Linelet preconditioner methodology. */
-  unsigned long max_nElem;
+  unsigned long nLineletBatch;                /*!< \brief Number of batches of LINELET_LANES linelets (sorted by length) that are solved together. */
+  unsigned long *LineletBatch_ptr;            /*!< \brief Position of the first element of each batch, its length is the one of its longest linelet. */
+  unsigned long *LineletBatch_Point;          /*!< \brief Point of each element and lane of the batches (LINELET_PADDING after the end of a linelet). */
+  double *Linelet_Factor;                     /*!< \brief Block Thomas factors of each element, inv(U), lower coupling and inv(U).upper coupling, interleaved by lane. */
+  float *Linelet_Factor_flt;                  /*!< \brief Single precision factors of the linelets (used instead of Linelet_Factor if LINEAR_SOLVER_PREC_FLOAT). */
+  unsigned long max_nElem;                    /*!< \brief Length of the longest linelet. */
+  double *Linelet_Work;                       /*!< \brief Scratch of each thread for the linelets, lane-interleaved solution of a batch and right hand side (or blocks of the factorization). */
+  unsigned long Linelet_Work_Size;            /*!< \brief Size of the scratch of each thread in Linelet_Work. */
+  unsigned short nVarBlock;  /*!< \brief Block size of the specialized (unrolled) kernels, 0 if the generic kernels are used. */
+  unsigned short Kind_Sweep;       /*!< \brief Schedule of the triangular sweeps of the LU-SGS and ILU preconditioners. */
+  unsigned long nSweepGroup;       /*!< \brief Number of groups (level sets or colors) of independent rows. */
+  unsigned long *sweep_group_ptr;  /*!< \brief Position in sweep_row of the first row of each group. */
+  unsigned long *sweep_row;        /*!< \brief Rows of the domain, sorted by group. */
+  unsigned long *sweep_ptr;        /*!< \brief Position in sweep_ind of the off-diagonal blocks of each row. */
+  unsigned long *sweep_mid;        /*!< \brief Position in sweep_ind of the first upper block of each row. */
+  unsigned long *sweep_ind;        /*!< \brief Off-diagonal blocks (position in col_ind) of each row, first the lower part (in sweep order) and then the upper part. */
+  unsigned long nSweepCoupling;    /*!< \brief Number of off-diagonal blocks between points of the domain. */
+  unsigned long nSweepReversed;    /*!< \brief Off-diagonal blocks that change of triangular part with respect to the natural ordering. */
+  
+  /*!
+	 * \brief Position of the first block of a row, and column of a block, in the compact or the wide indices
+	 *        (the kernels receive the index arrays instead, see MatrixVectorProduct_Kernel).
+	 */
+  unsigned long GetRow_Ptr(unsigned long iPoint) const;
+  unsigned long GetCol_Ind(unsigned long index) const;
+  
+  /*!
+	 * \brief Product of a block by a vector, c = a.b (block size nB, or nVar if nB is 0).
+	 *        The block may be stored in single precision, the product is done in double precision.
+	 */
+  template<unsigned short nB, class T> void BlockVectorProduct(const T *a, const double *b, double *c) const;
+  
+  /*!
+	 * \brief Product of two blocks, c = a.b (block size nB, or nVar if nB is 0).
+	 *        The blocks may be stored in single precision, the product is done in double precision.
+	 */
+  template<unsigned short nB, class Ta, class Tb> void BlockBlockProduct(const Ta *a, const Tb *b, double *c) const;
+  
+  /*!
+	 * \brief Gauss elimination of a block system (block size nB, or nVar if nB is 0).
+	 * \param[in] Block - Block of the system, it is not modified.
+	 * \param[in,out] rhs - Right-hand-side of the system, overwritten with the solution.
+	 */
+  template<unsigned short nB> void BlockGaussElimination(const double *Block, double *rhs);
+  
+  /*!
+	 * \brief Inverse of a block, the elimination is done once for all the columns (block size nB, or nVar if nB is 0).
+	 * \param[in] Block - Block matrix.
+	 * \param[out] invBlock - Inverse block (it may be stored in single precision).
+	 * \param[in] scratch - Storage (nVar*nVar+nVar) of the generic elimination, the internal arrays if NULL.
+	 */
+  template<unsigned short nB, class Tin, class Tout> void BlockInverse(const Tin *Block, Tout *invBlock, double *scratch = NULL);
+  
+  /*!
+	 * \brief Closed-form inverses (cofactors over the determinant) of JACOBI_LANES blocks of size
+	 *        nB = 1, 2 or 4, without pivoting. The entries are interleaved by lanes, Block[iVar*JACOBI_LANES+iLane],
+	 *        so each operation is done for all the blocks at once.
+	 * \param[in] Block - Interleaved blocks.
+	 * \param[out] invBlock - Interleaved inverses.
+	 */
+  template<unsigned short nB> void BlockInverse_Batch(const double *Block, double *invBlock) const;
+  
+  /*!
+	 * \brief Kernels of the sparse matrix-vector product and the preconditioners, for a block size
+	 *        known at compile time (nB) or the generic one (nB = 0), see the public versions. The
+	 *        preconditioners receive their storage (inv, LU), in single or double precision (T), and
+	 *        the kernels that read the sparsity pattern receive the compact or the wide indices (I).
+	 */
+  template<unsigned short nB, class I> void MatrixVectorProduct_Kernel(const I *row, const I *col, const CSysVector & vec, CSysVector & prod, unsigned long row_begin, unsigned long row_end);
+  template<unsigned short nB, class T> void BuildJacobiPreconditioner_Kernel(T *inv, unsigned long row_begin, unsigned long row_end);
+  template<unsigned short nB, class T> void ComputeJacobiPreconditioner_Kernel(const T *inv, const CSysVector & vec, CSysVector & prod, unsigned long row_begin, unsigned long row_end);
+  template<unsigned short nB, class T> void BuildLineletPreconditioner_Kernel(T *factor, double *work, unsigned long batch_begin, unsigned long batch_end);
+  template<unsigned short nB, class T> void ComputeLineletPreconditioner_Kernel(const T *inv, const T *factor, const CSysVector & vec, CSysVector & prod, double *work,
+                                                                                unsigned long row_begin, unsigned long row_end,
+                                                                                unsigned long batch_begin, unsigned long batch_end);
+  
+  /*!
+	 * \brief Kernels of the triangular sweeps (ILU factorization, ILU forward and backward substitutions,
+	 *        LU-SGS forward and backward sweeps) over the rows sweep_row[row_begin..row_end), which are
+	 *        independent of each other. Rows of the backward sweeps are done in reverse order.
+	 */
+  template<unsigned short nB, class T, class I> void BuildILUPreconditioner_Kernel(const I *row, const I *col, T *LU, unsigned long row_begin, unsigned long row_end);
+  template<unsigned short nB, class T, class I> void ILUForwardSweep_Kernel(const I *col, const T *LU, const CSysVector & vec, CSysVector & prod, unsigned long row_begin, unsigned long row_end);
+  template<unsigned short nB, class T, class I> void ILUBackwardSweep_Kernel(const I *col, const T *LU, CSysVector & prod, unsigned long row_begin, unsigned long row_end);
+  template<unsigned short nB, class I> void LU_SGSForwardSweep_Kernel(const I *col, const CSysVector & vec, CSysVector & prod, unsigned long row_begin, unsigned long row_end);
+  template<unsigned short nB, class I> void LU_SGSBackwardSweep_Kernel(const I *col, CSysVector & prod, unsigned long row_begin, unsigned long row_end);
+  template<unsigned short nB, class I> void Sweep_Kernel(const I *row, const I *col, unsigned short kernel, const CSysVector *vec, CSysVector *prod, unsigned long row_begin, unsigned long row_end);
+  
+  /*!
+	 * \brief Execute a triangular sweep group by group, the rows of each group are split among the threads.
+	 * \param[in] kernel - Sweep to be done (see SWEEP_KERNEL in matrix_structure.cpp).
+	 * \param[in] vec - Input vector (NULL for the factorization).
+	 * \param[in,out] prod - Output vector (NULL for the factorization).
+	 * \param[in] reverse - The groups are done in reverse order (backward sweeps).
+	 */
+  void Sweep(unsigned short kernel, const CSysVector *vec, CSysVector *prod, bool reverse);
+  
+  /*!
+	 * \brief Find the linelets of the grid, starting from the vertices of the walls and following
+	 *        the faces of largest weight (stretched control volumes), it doesn't need a matrix.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[out] val_nLinelet - Number of linelets.
+	 * \return Points of each linelet (allocated with new[], NULL if the grid has no linelets).
+	 */
+  static vector<unsigned long> *FindLinelets(CGeometry *geometry, CConfig *config, unsigned long & val_nLinelet);
+  
+  /*!
+	 * \brief Mark the points of the linelets (LineletPoint), group the linelets in batches of
+	 *        LINELET_LANES, and allocate the storage of their block Thomas factors and the scratch of the threads.
+	 */
+  void SetLinelet_Batches(void);
+  
+  /*!
+	 * \brief Arguments of the threaded loops over the rows of the matrix.
+	 */
+  struct CSysMatrix_Loop {
+    CSysMatrix *matrix;      /*!< \brief Matrix of the loop. */
+    const CSysVector *vec;   /*!< \brief Input vector. */
+    CSysVector *prod;        /*!< \brief Output vector. */
+    unsigned short kernel;   /*!< \brief Kernel of the triangular sweeps. */
+    unsigned long row_begin; /*!< \brief First position in sweep_row of the group of rows of a sweep. */
+    unsigned long row_end;   /*!< \brief Last position (not included) in sweep_row of the group of rows of a sweep. */
+  };
+  
+  /*!
+	 * \brief Threaded loops (see CThreadPool::Run), each thread does a static chunk of rows.
+	 */
+  static void SetValZero_Thread(void *data, unsigned short iThread, unsigned short nThread);
+  static void MatrixVectorProduct_Thread(void *data, unsigned short iThread, unsigned short nThread);
+  static void BuildJacobiPreconditioner_Thread(void *data, unsigned short iThread, unsigned short nThread);
+  static void ComputeJacobiPreconditioner_Thread(void *data, unsigned short iThread, unsigned short nThread);
+  static void BuildLineletPreconditioner_Thread(void *data, unsigned short iThread, unsigned short nThread);
+  static void ComputeLineletPreconditioner_Thread(void *data, unsigned short iThread, unsigned short nThread);
+  static void Sweep_Thread(void *data, unsigned short iThread, unsigned short nThread);
   
 public:
   
@@ -108,12 +255,45 @@ public:
 	 * \param[in] val_nPoint - Number of points in the nPoint x nPoint block structure
 	 * \param[in] val_nVar - Number of nVar x nVar variables in each subblock of the matrix-by-block structure.
    * \param[in] val_nEq - Number of nEqn x nVar variables in each subblock of the matrix-by-block structure.
-	 * \param[in] val_row_ptr - Pointers to the first element in each row.
-	 * \param[in] val_col_ind - Column index for each of the elements in val().
+	 * \param[in] val_row_ptr - Pointers to the first element in each row (the matrix takes the array, it is released if the compact indices are used).
+	 * \param[in] val_col_ind - Column index for each of the elements in val() (the matrix takes the array, it is released if the compact indices are used).
 	 * \param[in] val_nnz - Number of possible nonzero entries in the matrix.
 	 * \param[in] preconditioner - If <code>TRUE</code> then it use a preconditioner.
 	 */
 	void SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDomain, unsigned short val_nVar, unsigned short val_nEq, unsigned long* val_row_ptr, unsigned long* val_col_ind, unsigned long val_nnz, CConfig *config);
+  
+  /*!
+	 * \brief Store, for each edge of the grid, the position in the sparse structure of the
+	 *        (i,i), (i,j), (j,i) and (j,j) blocks, so the assembly doesn't search the rows.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 */
+	void SetEdgeMap(CGeometry *geometry);
+  
+  /*!
+	 * \brief Group the rows of the domain for the triangular sweeps of the LU-SGS and ILU preconditioners.
+	 *        The level sets keep the natural ordering (same preconditioner), the multicoloring reorders
+	 *        the rows (more and larger groups, but a different preconditioner).
+	 * \param[in] val_kind - Kind of schedule (SWEEP_SEQUENTIAL, SWEEP_LEVEL_SETS or SWEEP_MULTICOLOR).
+	 */
+	void SetSweepSchedule(unsigned short val_kind);
+  
+  /*!
+	 * \brief Get the schedule of the triangular sweeps.
+	 * \return Kind of schedule (the level sets are replaced by the sequential sweeps with one thread).
+	 */
+	unsigned short GetKind_Sweep(void);
+  
+  /*!
+	 * \brief Get the number of groups of independent rows of the triangular sweeps.
+	 * \return Number of level sets or colors (1 for the sequential sweeps).
+	 */
+	unsigned long GetnSweepGroup(void);
+  
+  /*!
+	 * \brief Get the couplings whose triangular part changes with respect to the natural ordering.
+	 * \return Percentage of the off-diagonal blocks of the domain (0 unless the rows are colored).
+	 */
+	double GetSweep_Reversed(void);
    
 	/*!
 	 * \brief Sets to zero all the entries of the sparse matrix.
@@ -166,6 +346,38 @@ public:
 	 */
 	void SubtractBlock(unsigned long block_i, unsigned long block_j, double **val_block);
   
+  /*!
+	 * \brief Adds the specified block to the diagonal block (i,i) of the sparse matrix.
+	 * \param[in] block_i - Index of the block in the matrix-by-blocks structure.
+	 * \param[in] **val_block - Block to add to A(i,i).
+	 */
+	void AddBlock2Diag(unsigned long block_i, double **val_block);
+  
+  /*!
+	 * \brief Subtracts the specified block to the diagonal block (i,i) of the sparse matrix.
+	 * \param[in] block_i - Index of the block in the matrix-by-blocks structure.
+	 * \param[in] **val_block - Block to subtract to A(i,i).
+	 */
+	void SubtractBlock2Diag(unsigned long block_i, double **val_block);
+  
+  /*!
+	 * \brief Update the four blocks of an edge: A(i,i) += Block_i, A(i,j) += Block_j,
+	 *        A(j,i) -= Block_i and A(j,j) -= Block_j.
+	 * \param[in] iEdge - Index of the edge (see SetEdgeMap).
+	 * \param[in] **block_i - Jacobian of the flux with respect to the state at the first node.
+	 * \param[in] **block_j - Jacobian of the flux with respect to the state at the second node.
+	 */
+	void UpdateBlocks(unsigned long iEdge, double **block_i, double **block_j);
+  
+  /*!
+	 * \brief Update the four blocks of an edge with the opposite sign: A(i,i) -= Block_i,
+	 *        A(i,j) -= Block_j, A(j,i) += Block_i and A(j,j) += Block_j.
+	 * \param[in] iEdge - Index of the edge (see SetEdgeMap).
+	 * \param[in] **block_i - Jacobian of the flux with respect to the state at the first node.
+	 * \param[in] **block_j - Jacobian of the flux with respect to the state at the second node.
+	 */
+	void UpdateBlocksSub(unsigned long iEdge, double **block_i, double **block_j);
+  
   /*!
 	 * \brief Copies the block (i,j) of the matrix-by-blocks structure in the internal variable *block.
 	 * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
@@ -245,14 +457,6 @@ public:
 	 */
 	void Gauss_Elimination(double* Block, double* rhs);
   
-  /*!
-	 * \brief Performs the Gauss Elimination algorithm to solve the linear subsystem of the (i,i) subblock and rhs.
-	 * \param[in] block_i - Index of the (i,i) subblock in the matrix-by-blocks structure.
-	 * \param[in] rhs - Right-hand-side of the linear system.
-	 * \return Solution of the linear system (overwritten on rhs).
-	 */
-	void Gauss_Elimination_ILUMatrix(unsigned long block_i, double* rhs);
-  
   /*!
 	 * \fn void CSysMatrix::ProdBlockVector(unsigned long block_i, unsigned long block_j, double* vec);
 	 * \brief Performs the product of the block (i,j) by vector vec.
@@ -345,13 +549,6 @@ public:
 	 */
 	void InverseDiagonalBlock(unsigned long block_i, double *invBlock);
   
- 	/*!
-	 * \brief Inverse diagonal block.
-	 * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
-	 * \param[out] invBlock - Inverse block.
-	 */
-	void InverseDiagonalBlock_ILUMatrix(unsigned long block_i, double *invBlock);
-  
 	/*!
 	 * \brief Inverse a block.
 	 * \param[in] Block - block matrix.
@@ -360,21 +557,33 @@ public:
 	void InverseBlock(double *Block, double *invBlock);
   
 	/*!
-	 * \brief Build the Jacobi preconditioner.
+	 * \brief Build the Jacobi preconditioner, and the block Thomas factors of the linelets if
+	 *        they have been defined (see BuildLineletPreconditioner).
 	 */
 	void BuildJacobiPreconditioner(void);
   
 	/*!
-	 * \brief Build the Jacobi preconditioner.
+	 * \brief Build the ILU(0) preconditioner, the block factorization is computed
+	 *        once and stored in ILU_matrix (with the inverse of the diagonal blocks of U).
 	 */
 	void BuildILUPreconditioner(void);
   
 	/*!
-	 * \brief Build the Linelet preconditioner.
+	 * \brief Build the Linelet preconditioner, the linelets are grouped in batches of LINELET_LANES
+	 *        linelets of similar length that are solved together.
 	 * \param[in] geometry - Geometrical definition of the problem.
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	unsigned short BuildLineletPreconditioner(CGeometry *geometry, CConfig *config);
+  
+  /*!
+	 * \brief Set the matrix to the Galerkin coarse operator of a finer matrix, for the agglomeration
+	 *        multigrid (piecewise constant prolongation): the block (I,J) is the sum of the blocks (i,j)
+	 *        of the fine matrix with i in the control volume I and j in J.
+	 * \param[in] fine - Matrix of the finer grid.
+	 * \param[in] fine_geometry - Geometry of the finer grid (parents of the fine points).
+	 */
+  void SetGalerkinOperator(const CSysMatrix & fine, CGeometry *fine_geometry);
 	
 	/*!
 	 * \brief Multiply CSysVector by the preconditioner
@@ -384,7 +593,8 @@ public:
 	void ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
   
 	/*!
-	 * \brief Multiply CSysVector by the preconditioner
+	 * \brief Multiply CSysVector by the preconditioner (forward and backward substitution
+	 *        using the factors of BuildILUPreconditioner).
 	 * \param[in] vec - CSysVector to be multiplied by the preconditioner.
 	 * \param[out] prod - Result of the product A*vec.
 	 */
@@ -403,6 +613,52 @@ public:
 	 * \param[out] prod - Result of the product A*vec.
 	 */
 	void ComputeLineletPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
+  /*!
+	 * \brief Get the index memory saved by the compact (32-bit) indices, which replace the wide
+	 *        ones in the matrices with less than 2^32 points and nonzero blocks.
+	 * \return Bytes of row_ptr and col_ind saved by this matrix.
+	 */
+  unsigned long GetIndex_Memory_Saved(void) const;
+  
+  /*!
+	 * \brief Get the index memory saved by the compact (32-bit) indices of all the matrices.
+	 * \return Bytes of row_ptr and col_ind saved by the matrices that are allocated.
+	 */
+  static unsigned long GetTotal_Index_Memory_Saved(void);
+  
+  /*!
+	 * \brief Write a snapshot of the linear system to a binary file (see SU2_BENCH): the sparsity
+	 *        pattern, the blocks, the right hand side and the linelets (they are found for the
+	 *        snapshot if the matrix doesn't use them), the arrays are written with spVec_utils.
+	 * \param[in] rhs - Right hand side of the system.
+	 * \param[in] geometry - Geometrical definition of the problem (to find the linelets).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] filename - Name of the file.
+	 */
+  void Write_System(const CSysVector & rhs, CGeometry *geometry, CConfig *config, string filename);
+  
+  /*!
+	 * \brief Initialize the matrix and the right hand side with a snapshot of Write_System, the
+	 *        storage of the preconditioners is set by the config as in Initialize.
+	 * \param[out] rhs - Right hand side of the system.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] filename - Name of the file.
+	 */
+  void Read_System(CSysVector & rhs, CConfig *config, string filename);
+  
+  /*!
+	 * \brief Estimate of the memory traffic of a matrix-vector product (each value read once).
+	 * \return Bytes of the blocks, indices and vectors.
+	 */
+  unsigned long GetProduct_Bytes(void);
+  
+  /*!
+	 * \brief Estimate of the memory traffic of an application of a preconditioner (each value read once).
+	 * \param[in] kind_prec - Kind of preconditioner (JACOBI, ILU, LU_SGS or LINELET).
+	 * \return Bytes of the factors, indices and vectors.
+	 */
+  unsigned long GetPreconditioner_Bytes(unsigned short kind_prec);
 	
   /*!
 	 * \brief Compute the residual Ax-b
@@ -22,9 +22,62 @@
  
 #pragma once
 
-inline void CSysMatrix::SetValZero(void) { 
-	for (unsigned long index = 0; index < nnz*nVar*nEqn; index++) 
-		matrix[index] = 0.0;
+inline unsigned long CSysMatrix::GetIndex_Memory_Saved(void) const { return Index_Memory_Saved; }
+
+inline unsigned long CSysMatrix::GetTotal_Index_Memory_Saved(void) { return Total_Index_Memory_Saved; }
+
+inline unsigned long CSysMatrix::GetRow_Ptr(unsigned long iPoint) const { return (row_ptr_32 != NULL ? row_ptr_32[iPoint] : row_ptr[iPoint]); }
+
+inline unsigned long CSysMatrix::GetCol_Ind(unsigned long index) const { return (col_ind_32 != NULL ? col_ind_32[index] : col_ind[index]); }
+
+inline void CSysMatrix::AddBlock2Diag(unsigned long block_i, double **val_block) {
+  double *Block = &matrix[dia_ptr[block_i]*nVar*nEqn];
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    for (unsigned short jVar = 0; jVar < nEqn; jVar++)
+      Block[iVar*nEqn+jVar] += val_block[iVar][jVar];
+}
+
+inline void CSysMatrix::SubtractBlock2Diag(unsigned long block_i, double **val_block) {
+  double *Block = &matrix[dia_ptr[block_i]*nVar*nEqn];
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    for (unsigned short jVar = 0; jVar < nEqn; jVar++)
+      Block[iVar*nEqn+jVar] -= val_block[iVar][jVar];
+}
+
+inline void CSysMatrix::UpdateBlocks(unsigned long iEdge, double **block_i, double **block_j) {
+  double *Block_ii = &matrix[edge_ptr[4*iEdge  ]*nVar*nEqn];
+  double *Block_ij = &matrix[edge_ptr[4*iEdge+1]*nVar*nEqn];
+  double *Block_ji = &matrix[edge_ptr[4*iEdge+2]*nVar*nEqn];
+  double *Block_jj = &matrix[edge_ptr[4*iEdge+3]*nVar*nEqn];
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    for (unsigned short jVar = 0; jVar < nEqn; jVar++) {
+      Block_ii[iVar*nEqn+jVar] += block_i[iVar][jVar];
+      Block_ij[iVar*nEqn+jVar] += block_j[iVar][jVar];
+      Block_ji[iVar*nEqn+jVar] -= block_i[iVar][jVar];
+      Block_jj[iVar*nEqn+jVar] -= block_j[iVar][jVar];
+    }
+}
+
+inline void CSysMatrix::UpdateBlocksSub(unsigned long iEdge, double **block_i, double **block_j) {
+  double *Block_ii = &matrix[edge_ptr[4*iEdge  ]*nVar*nEqn];
+  double *Block_ij = &matrix[edge_ptr[4*iEdge+1]*nVar*nEqn];
+  double *Block_ji = &matrix[edge_ptr[4*iEdge+2]*nVar*nEqn];
+  double *Block_jj = &matrix[edge_ptr[4*iEdge+3]*nVar*nEqn];
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    for (unsigned short jVar = 0; jVar < nEqn; jVar++) {
+      Block_ii[iVar*nEqn+jVar] -= block_i[iVar][jVar];
+      Block_ij[iVar*nEqn+jVar] -= block_j[iVar][jVar];
+      Block_ji[iVar*nEqn+jVar] += block_i[iVar][jVar];
+      Block_jj[iVar*nEqn+jVar] += block_j[iVar][jVar];
+    }
+}
+
+inline unsigned short CSysMatrix::GetKind_Sweep(void) { return Kind_Sweep; }
+
+inline unsigned long CSysMatrix::GetnSweepGroup(void) { return nSweepGroup; }
+
+inline double CSysMatrix::GetSweep_Reversed(void) {
+  return (nSweepCoupling > 0 ? 100.0*double(nSweepReversed)/double(nSweepCoupling) : 0.0);
 }
 
 inline CSysMatrixVectorProduct::CSysMatrixVectorProduct(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
@@ -35,6 +35,8 @@
 
 using namespace std;
 
+const unsigned short NUMERICS_LANES = 8;  /*!< \brief Edges computed together by the batched upwind schemes (SIMD lanes, see ComputeResidual_Lanes). */
+
 /*!
  * \class CNumerics
  * \brief Class for defining the numerical methods.
@@ -51,6 +53,7 @@ protected:
   double *Vector; /*!< \brief Auxiliary vector. */
   double *Enthalpy_formation;
 	unsigned short nDiatomics, nMonatomics;
+	bool implicit;		/*!< \brief Compute the Jacobians of the residual (implicit integration). */
     
 public:
 	
@@ -161,6 +164,7 @@ public:
 	*Coord_1,			/*!< \brief Cartesians coordinates of point 1 (Galerkin method, tetrahedra). */
 	*Coord_2,			/*!< \brief Cartesians coordinates of point 2 (Galerkin method, triangle). */
 	*Coord_3;			/*!< \brief Cartesians coordinates of point 3 (Galerkin method, tetrahedra). */
+	double *Edge_Geometry;	/*!< \brief Geometric factors of the edge i-j (see CGeometry::GetEdge_Geometry), NULL if they must be computed from the coordinates. */
 	unsigned short Neighbor_i,	/*!< \brief Number of neighbors of the point i. */
 	Neighbor_j;					/*!< \brief Number of neighbors of the point j. */
 	double *Normal,	/*!< \brief Normal vector, it norm is the area of the face. */
@@ -185,6 +189,8 @@ public:
   unsigned short RHOS_INDEX, T_INDEX, TVE_INDEX, VEL_INDEX, P_INDEX,
   RHO_INDEX, H_INDEX, A_INDEX, RHOCVTR_INDEX, RHOCVVE_INDEX;
   CVariable *var;
+  CNumerics **Thread_Numerics;  /*!< \brief Numerics of each thread of the edge loops (the first one is this object). */
+  unsigned short nThread_Numerics;  /*!< \brief Number of threads with their own numerics. */
     
 	/*!
 	 * \brief Constructor of the class.
@@ -203,6 +209,21 @@ public:
 	 * \brief Destructor of the class.
 	 */
 	virtual ~CNumerics(void);
+  
+  /*!
+   * \brief Set the copies of these numerics used by the threads of the edge loops (see CGeometry::Run_EdgeLoop),
+   *        the numerics keep the state of the edge (normal, variables...), so each thread needs its own.
+   * \param[in] val_nThread - Number of threads.
+   * \param[in] val_numerics - Numerics of each thread, the first one must be this object (the array is owned by this object).
+   */
+  void SetThread_Numerics(unsigned short val_nThread, CNumerics **val_numerics);
+  
+  /*!
+   * \brief Get the numerics of a thread of the edge loops.
+   * \param[in] val_iThread - Index of the thread.
+   * \return Numerics of the thread (this object if there are no copies).
+   */
+  CNumerics *GetThread_Numerics(unsigned short val_iThread);
     
 	/*!
 	 * \brief Compute the determinant of a 3 by 3 matrix.
@@ -520,6 +541,13 @@ public:
 	 */
 	void SetCoord(double *val_coord_i, double *val_coord_j);
     
+	/*!
+	 * \brief Set the stored geometric factors of the edge i-j, they replace the ones computed from the
+	 *        coordinates by the average of gradients numerics (must be called after SetCoord, which clears them).
+	 * \param[in] val_edge_geometry - Geometric factors of the edge (see CGeometry::GetEdge_Geometry).
+	 */
+	void SetEdge_Geometry(double *val_edge_geometry);
+    
 	/*!
 	 * \overload
 	 * \param[in] val_coord_0 - Coordinates of the point 0.
@@ -628,6 +656,19 @@ public:
 	 */
 	void SetNormal(double *val_normal);
     
+	/*!
+	 * \brief Switch on or off the computation of the Jacobians, the residual is computed anyway
+	 *        (also for the numerics of the other threads).
+	 * \param[in] val_implicit - <code>TRUE</code> if the Jacobians must be computed.
+	 */
+	void SetImplicit(bool val_implicit);
+    
+	/*!
+	 * \brief Check if the Jacobians are computed.
+	 * \return <code>TRUE</code> if the Jacobians are computed.
+	 */
+	bool GetImplicit(void);
+    
 	/*!
 	 * \brief Set the value of the volume of the control volume.
 	 * \param[in] val_volume Volume of the control volume.
@@ -1088,6 +1129,74 @@ public:
                       double *val_soundspeed, double *val_normal,
                       double **val_invp_tensor);
     
+	/*!
+	 * \brief Projected inviscid flux of NUMERICS_LANES states (see GetInviscidProjFlux), the vectors and
+	 *        the matrices are interleaved by lanes: val_velocity[iDim*NUMERICS_LANES+iLane],
+	 *        val_Proj_Flux[iVar*NUMERICS_LANES+iLane].
+	 * \param[in] val_density - Density of each lane.
+	 * \param[in] val_velocity - Velocity of each lane.
+	 * \param[in] val_pressure - Pressure of each lane.
+	 * \param[in] val_enthalpy - Enthalpy of each lane.
+	 * \param[in] val_normal - Normal vector of each lane.
+	 * \param[out] val_Proj_Flux - Projected flux of each lane.
+	 */
+	void GetInviscidProjFlux_Lanes(double *val_density, double *val_velocity, double *val_pressure,
+                                 double *val_enthalpy, double *val_normal, double *val_Proj_Flux);
+    
+	/*!
+	 * \brief Projected inviscid Jacobian of NUMERICS_LANES states (see GetInviscidProjJac), interleaved by
+	 *        lanes, val_Proj_Jac_Tensor[(iVar*nVar+jVar)*NUMERICS_LANES+iLane].
+	 * \param[in] val_velocity - Velocity of each lane.
+	 * \param[in] val_energy - Energy of each lane.
+	 * \param[in] val_normal - Normal vector of each lane.
+	 * \param[in] val_scale - Scale of the Jacobian.
+	 * \param[out] val_Proj_Jac_Tensor - Projected Jacobian of each lane.
+	 */
+	void GetInviscidProjJac_Lanes(double *val_velocity, double *val_energy, double *val_normal,
+                                double val_scale, double *val_Proj_Jac_Tensor);
+    
+	/*!
+	 * \brief Matrices P and P^{-1} of NUMERICS_LANES states (see GetPMatrix and GetPMatrix_inv),
+	 *        interleaved by lanes.
+	 * \param[in] val_density - Density of each lane.
+	 * \param[in] val_velocity - Velocity of each lane.
+	 * \param[in] val_soundspeed - Speed of sound of each lane.
+	 * \param[in] val_normal - Unit normal vector of each lane.
+	 * \param[out] val_p_tensor - P matrix of each lane.
+	 * \param[out] val_invp_tensor - Inverse of the P matrix of each lane (not computed if NULL).
+	 */
+	void GetPMatrix_Lanes(double *val_density, double *val_velocity, double *val_soundspeed,
+                        double *val_normal, double *val_p_tensor, double *val_invp_tensor);
+    
+	/*!
+	 * \brief Absolute value of the projected Jacobian, P x |Lambda| x P^{-1}, of NUMERICS_LANES states,
+	 *        interleaved by lanes.
+	 * \param[in] val_p_tensor - P matrix of each lane.
+	 * \param[in] val_lambda - Absolute value of the eigenvalues of each lane.
+	 * \param[in] val_invp_tensor - Inverse of the P matrix of each lane.
+	 * \param[out] val_abs_jac - |A| of each lane.
+	 */
+	void GetAbsJacobian_Lanes(double *val_p_tensor, double *val_lambda, double *val_invp_tensor, double *val_abs_jac);
+    
+	/*!
+	 * \brief Jacobians of Roe's scheme (projected Jacobians plus/minus |A| with the Roe averages) of
+	 *        NUMERICS_LANES edges, used as the Jacobians of the AUSM and HLLC schemes. Interleaved by lanes.
+	 * \param[in] val_density_i - Density at the points i.
+	 * \param[in] val_velocity_i - Velocity at the points i.
+	 * \param[in] val_enthalpy_i - Enthalpy at the points i.
+	 * \param[in] val_energy_i - Energy at the points i.
+	 * \param[in] val_density_j - Density at the points j.
+	 * \param[in] val_velocity_j - Velocity at the points j.
+	 * \param[in] val_enthalpy_j - Enthalpy at the points j.
+	 * \param[in] val_energy_j - Energy at the points j.
+	 * \param[in] val_normal - Normal vectors of the edges.
+	 * \param[out] val_Jacobian_i - Jacobians with respect to the points i.
+	 * \param[out] val_Jacobian_j - Jacobians with respect to the points j.
+	 */
+	void GetRoeJacobians_Lanes(double *val_density_i, double *val_velocity_i, double *val_enthalpy_i, double *val_energy_i,
+                             double *val_density_j, double *val_velocity_j, double *val_enthalpy_j, double *val_energy_j,
+                             double *val_normal, double *val_Jacobian_i, double *val_Jacobian_j);
+    
 	/*!
 	 * \overload
 	 * \brief Computation of the matrix P^{-1}, this matrix diagonalize the conservative Jacobians
@@ -1196,6 +1305,28 @@ public:
 	virtual void ComputeResidual(double *val_residual, double **val_Jacobian_i,
                                double **val_Jacobian_j, CConfig *config);
     
+	/*!
+	 * \brief The numerics has a batched residual (ComputeResidual_Lanes) for the current problem.
+	 * \return <code>TRUE</code> if the edges can be computed by batches of NUMERICS_LANES.
+	 */
+	virtual bool GetLanes(void);
+    
+	/*!
+	 * \brief Residual and Jacobians of NUMERICS_LANES edges at once (batched upwind schemes). The inputs and
+	 *        the outputs are interleaved by lanes, val_V_i[iVar*NUMERICS_LANES+iLane] (the first nDim+4
+	 *        primitive variables), val_Jacobian_i[(iVar*nVar+jVar)*NUMERICS_LANES+iLane]; the Jacobians
+	 *        are overwritten. The loops over the lanes are written for the compiler to vectorize.
+	 * \param[in] val_V_i - Primitive variables at the points i.
+	 * \param[in] val_V_j - Primitive variables at the points j.
+	 * \param[in] val_normal - Normal vectors of the edges.
+	 * \param[out] val_residual - Residuals.
+	 * \param[out] val_Jacobian_i - Jacobians with respect to the points i (implicit computation).
+	 * \param[out] val_Jacobian_j - Jacobians with respect to the points j (implicit computation).
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	virtual void ComputeResidual_Lanes(double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                                     double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config);
+    
     /*!
 	 * \overload
 	 * \param[out] val_residual - Pointer to the total residual.
@@ -1429,8 +1560,7 @@ private:
 	Epsilon_2, Epsilon_4, cte_0, cte_1, /*!< \brief Artificial dissipation values. */
   LamdaNeg, LamdaPos, ModVelocity, Beta, Nu_c, U_i[5], U_j[5], MeanSoundSpeed, Mach,
   ProjGridVel_i, ProjGridVel_j, ProjGridVel, **Jacobian;  /*!< \brief Projected grid velocity. */
-	bool implicit, /*!< \brief Implicit calculation. */
-	grid_movement, /*!< \brief Modification for grid movement. */
+	bool grid_movement, /*!< \brief Modification for grid movement. */
 	stretching; /*!< \brief Stretching factor. */
   
   
@@ -1470,7 +1600,7 @@ public:
  */
 class CUpwRoe_Flow : public CNumerics {
 private:
-	bool implicit, grid_movement;
+	bool grid_movement;
 	double *Diff_U;
 	double *Velocity_i, *Velocity_j, *RoeVelocity;
 	double *ProjFlux_i, *ProjFlux_j;
@@ -1505,6 +1635,25 @@ public:
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	void ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, CConfig *config);
+    
+	/*!
+	 * \brief The batched Roe's flux is used without grid movement.
+	 * \return <code>TRUE</code> if the edges can be computed by batches of NUMERICS_LANES.
+	 */
+	bool GetLanes(void);
+    
+	/*!
+	 * \brief Roe's flux of NUMERICS_LANES edges at once (see CNumerics::ComputeResidual_Lanes).
+	 * \param[in] val_V_i - Primitive variables at the points i.
+	 * \param[in] val_V_j - Primitive variables at the points j.
+	 * \param[in] val_normal - Normal vectors of the edges.
+	 * \param[out] val_residual - Residuals.
+	 * \param[out] val_Jacobian_i - Jacobians with respect to the points i (implicit computation).
+	 * \param[out] val_Jacobian_j - Jacobians with respect to the points j (implicit computation).
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void ComputeResidual_Lanes(double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                             double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config);
 };
 
 /*!
@@ -1516,7 +1665,6 @@ public:
  */
 class CUpwMSW_Flow : public CNumerics {
 private:
-	bool implicit;
 	double *Diff_U;
 	double *u_i, *u_j, *ust_i, *ust_j;
 	double *Fc_i, *Fc_j;
@@ -1561,7 +1709,7 @@ public:
  */
 class CUpwTurkel_Flow : public CNumerics {
 private:
-	bool implicit, grid_movement;
+	bool grid_movement;
 	double *Diff_U;
 	double *Velocity_i, *Velocity_j, *RoeVelocity;
 	double *ProjFlux_i, *ProjFlux_j;
@@ -1616,7 +1764,6 @@ public:
  */
 class CUpwArtComp_Flow : public CNumerics {
 private:
-	bool implicit;
 	double Froude;
 	double *Diff_U;
 	double *Velocity_i, *Velocity_j, *MeanVelocity;
@@ -1662,7 +1809,6 @@ public:
  */
 class CUpwArtComp_FreeSurf_Flow : public CNumerics {
 private:
-	bool implicit;
 	double Froude;
 	double *Diff_U;
 	double *Velocity_i, *Velocity_j, *MeanVelocity;
@@ -1719,7 +1865,7 @@ private:
 	double RoeDensity, RoeSoundSpeed, *RoeVelocity, *Lambda, *Velocity_i, *Velocity_j, **ProjFlux_i, **ProjFlux_j,
 	Proj_ModJac_Tensor_ij, **Proj_ModJac_Tensor, Energy_i, Energy_j, **P_Tensor, **invP_Tensor;
 	unsigned short iDim, iVar, jVar, kVar;
-	bool implicit, grid_movement;
+	bool grid_movement;
     
 public:
     
@@ -1764,7 +1910,6 @@ private:
 	Proj_ModJac_Tensor_ij, **Proj_ModJac_Tensor, **P_Tensor, **invP_Tensor, MeanDensity,
 	MeanPressure, MeanBetaInc2, ProjVelocity, *MeanVelocity, MeanSoundSpeed;
 	unsigned short iDim, iVar, jVar, kVar;
-	bool implicit;
     
 public:
     
@@ -1804,7 +1949,6 @@ public:
  */
 class CUpwAUSM_Flow : public CNumerics {
 private:
-	bool implicit;
 	double *Diff_U;
 	double *Velocity_i, *Velocity_j, *RoeVelocity;
 	double *ProjFlux_i, *ProjFlux_j;
@@ -1840,6 +1984,25 @@ public:
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	void ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, CConfig *config);
+    
+	/*!
+	 * \brief The batched AUSM flux is always available.
+	 * \return <code>TRUE</code> if the edges can be computed by batches of NUMERICS_LANES.
+	 */
+	bool GetLanes(void);
+    
+	/*!
+	 * \brief AUSM flux of NUMERICS_LANES edges at once (see CNumerics::ComputeResidual_Lanes).
+	 * \param[in] val_V_i - Primitive variables at the points i.
+	 * \param[in] val_V_j - Primitive variables at the points j.
+	 * \param[in] val_normal - Normal vectors of the edges.
+	 * \param[out] val_residual - Residuals.
+	 * \param[out] val_Jacobian_i - Jacobians with respect to the points i (implicit computation).
+	 * \param[out] val_Jacobian_j - Jacobians with respect to the points j (implicit computation).
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void ComputeResidual_Lanes(double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                             double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config);
 };
 
 /*!
@@ -1851,7 +2014,6 @@ public:
  */
 class CUpwHLLC_Flow : public CNumerics {
 private:
-	bool implicit;
 	double *Diff_U;
 	double *Velocity_i, *Velocity_j, *RoeVelocity;
 	double *ProjFlux_i, *ProjFlux_j;
@@ -1888,6 +2050,25 @@ public:
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	void ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, CConfig *config);
+    
+	/*!
+	 * \brief The batched HLLC flux is always available.
+	 * \return <code>TRUE</code> if the edges can be computed by batches of NUMERICS_LANES.
+	 */
+	bool GetLanes(void);
+    
+	/*!
+	 * \brief HLLC flux of NUMERICS_LANES edges at once (see CNumerics::ComputeResidual_Lanes).
+	 * \param[in] val_V_i - Primitive variables at the points i.
+	 * \param[in] val_V_j - Primitive variables at the points j.
+	 * \param[in] val_normal - Normal vectors of the edges.
+	 * \param[out] val_residual - Residuals.
+	 * \param[out] val_Jacobian_i - Jacobians with respect to the points i (implicit computation).
+	 * \param[out] val_Jacobian_j - Jacobians with respect to the points j (implicit computation).
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void ComputeResidual_Lanes(double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                             double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config);
 };
 
 /*!
@@ -1901,7 +2082,7 @@ class CUpwLin_TransLM : public CNumerics {
 private:
 	double *Velocity_i;
 	double *Velocity_j;
-	bool implicit, grid_movement;
+	bool grid_movement;
 	double Density_i, Density_j, q_ij, a0, a1;
 	unsigned short iDim;
     
@@ -1939,7 +2120,6 @@ public:
  */
 class CUpwLin_LevelSet : public CNumerics {
 private:
-	bool implicit;
 	double *Velocity_i;
 	double *Velocity_j;
     
@@ -1979,7 +2159,6 @@ public:
  */
 class CUpwLin_AdjLevelSet : public CNumerics {
 private:
-	bool implicit;
 	double *Velocity_i;
 	double *Velocity_j;
     
@@ -2058,7 +2237,7 @@ public:
 class CUpwSca_TurbSA : public CNumerics {
 private:
 	double *Velocity_i, *Velocity_j;
-	bool implicit, grid_movement;
+	bool grid_movement;
 	double Density_i, Density_j, q_ij, a0, a1;
 	unsigned short iDim;
     
@@ -2097,7 +2276,7 @@ public:
 class CUpwSca_TurbSST : public CNumerics {
 private:
 	double *Velocity_i, *Velocity_j;
-	bool implicit, grid_movement;
+	bool grid_movement;
 	double Density_i, Density_j,
 	q_ij,
 	a0, a1;
@@ -2138,7 +2317,7 @@ public:
 class CUpwSca_TransLM : public CNumerics {
 private:
 	double *Velocity_i, *Velocity_j;
-	bool implicit, grid_movement;
+	bool grid_movement;
 	double Density_i, Density_j,
 	q_ij,
 	a0, a1;
@@ -2232,8 +2411,7 @@ private:
         *ProjFlux,  /*!< \brief Projected inviscid flux tensor. */
         Epsilon_2, Epsilon_4, cte_0, cte_1, /*!< \brief Artificial dissipation values. */
     ProjGridVel_i, ProjGridVel_j, ProjGridVel;  /*!< \brief Projected grid velocity. */
-        bool implicit, /*!< \brief Implicit calculation. */
-        grid_movement, /*!< \brief Modification for grid movement. */
+        bool grid_movement, /*!< \brief Modification for grid movement. */
         stretching; /*!< \brief Stretching factor. */
 
 
@@ -2287,8 +2465,7 @@ private:
 	*ProjFlux,  /*!< \brief Projected inviscid flux tensor. */
 	Epsilon_2, Epsilon_4, cte_0, cte_1, /*!< \brief Artificial dissipation values. */
     ProjGridVel_i, ProjGridVel_j, ProjGridVel;  /*!< \brief Projected grid velocity. */
-	bool implicit, /*!< \brief Implicit calculation. */
-	grid_movement, /*!< \brief Modification for grid movement. */
+	bool grid_movement, /*!< \brief Modification for grid movement. */
 	stretching; /*!< \brief Stretching factor. */
     
     
@@ -2340,8 +2517,7 @@ private:
 	Phi_i, Phi_j, sc2, sc4, StretchingFactor, /*!< \brief Streching parameters. */
 	*ProjFlux,  /*!< \brief Projected inviscid flux tensor. */
 	Epsilon_2, Epsilon_4, cte_0, cte_1; /*!< \brief Artificial dissipation values. */
-	bool implicit, /*!< \brief Implicit calculation. */
-	grid_movement, /*!< \brief Modification for grid movement. */
+	bool grid_movement, /*!< \brief Modification for grid movement. */
 	stretching; /*!< \brief Stretching factor. */
 	double Froude; /*!< \brief Froude number. */
     
@@ -2388,7 +2564,7 @@ private:
 	double Residual, ProjVelocity_i, ProjVelocity_j, ProjPhi, ProjPhi_Vel, sq_vel, phis1, phis2;
 	double MeanPsiRho, MeanPsiE, Param_p, Param_Kappa_4, Param_Kappa_2, Local_Lambda_i, Local_Lambda_j, MeanLambda;
 	double Phi_i, Phi_j, sc4, StretchingFactor, Epsilon_4, Epsilon_2;
-	bool implicit, stretching, grid_movement;
+	bool stretching, grid_movement;
     
 public:
     
@@ -2438,7 +2614,7 @@ private:
 	double Residual, ProjVelocity_i, ProjVelocity_j, ProjPhi, ProjPhi_Vel, sq_vel, phis1, phis2;
 	double MeanPsiRho, MeanPsiE, Param_p, Param_Kappa_4, Param_Kappa_2, Local_Lambda_i, Local_Lambda_j, MeanLambda;
 	double Phi_i, Phi_j, sc4, StretchingFactor, Epsilon_4, Epsilon_2;
-	bool implicit, stretching, grid_movement;
+	bool stretching, grid_movement;
     
 public:
     
@@ -2542,8 +2718,7 @@ private:
 	Local_Lambda_i, Local_Lambda_j, MeanLambda, /*!< \brief Local eingenvalues. */
 	Phi_i, Phi_j, sc0, StretchingFactor, /*!< \brief Streching parameters. */
 	Epsilon_0, cte; /*!< \brief Artificial dissipation values. */
-	bool implicit, /*!< \brief Implicit calculation. */
-	grid_movement, /*!< \brief Modification for grid movement. */
+	bool grid_movement, /*!< \brief Modification for grid movement. */
 	stretching, ProjGridVel;
     
 public:
@@ -2593,8 +2768,7 @@ private:
 	Local_Lambda_i, Local_Lambda_j, MeanLambda, /*!< \brief Local eingenvalues. */
 	Phi_i, Phi_j, sc0, StretchingFactor, /*!< \brief Streching parameters. */
 	Epsilon_0, cte; /*!< \brief Artificial dissipation values. */
-	bool implicit, /*!< \brief Implicit calculation. */
-	grid_movement; /*!< \brief Modification for grid movement. */
+	bool grid_movement; /*!< \brief Modification for grid movement. */
 	bool stretching;
 	double Froude;
     
@@ -2641,7 +2815,7 @@ private:
 	double Residual, ProjVelocity_i, ProjVelocity_j, ProjPhi, ProjPhi_Vel, sq_vel, phis1, phis2,
 	MeanPsiRho, MeanPsiE, Param_p, Param_Kappa_0, Local_Lambda_i, Local_Lambda_j, MeanLambda,
 	Phi_i, Phi_j, sc2, StretchingFactor, Epsilon_0, cte_0;
-	bool implicit, stretching, grid_movement;
+	bool stretching, grid_movement;
     
 public:
     
@@ -2691,7 +2865,7 @@ private:
 	double Residual, ProjVelocity_i, ProjVelocity_j, ProjPhi, ProjPhi_Vel, sq_vel, phis1, phis2,
 	MeanPsiRho, MeanPsiE, Param_p, Param_Kappa_0, Local_Lambda_i, Local_Lambda_j, MeanLambda,
 	Phi_i, Phi_j, sc2, StretchingFactor, Epsilon_0, cte_0;
-	bool implicit, stretching;
+	bool stretching;
     
 public:
     
@@ -2793,7 +2967,6 @@ private:
 	Mean_turb_ke,				/*!< \brief Mean value of the turbulent kinetic energy. */
 	*ProjFlux,	/*!< \brief Projection of the viscous fluxes. */
 	dist_ij;						/*!< \brief Length of the edge and face. */
-	bool implicit; /*!< \brief Implicit calculus. */
     
 public:
     
@@ -2836,7 +3009,6 @@ private:
 	Mean_Laminar_Viscosity, Mean_Eddy_Viscosity, /*!< \brief Mean value of the viscosity. */
 	*ProjFlux,		/*!< \brief Projection of the viscous fluxes. */
 	dist_ij;							/*!< \brief Length of the edge and face. */
-	bool implicit;				/*!< \brief Implicit calculus. */
     
 public:
     
@@ -2874,7 +3046,6 @@ private:
 	double **Mean_GradTurbVar;
 	double *Proj_Mean_GradTurbVar_Kappa, *Proj_Mean_GradTurbVar_Edge;
 	double *Edge_Vector;
-	bool implicit;
 	double sigma;
 	double nu_i, nu_j, nu_e;
 	double dist_ij_2;
@@ -2926,7 +3097,6 @@ private:
 	Mean_turb_ke,				/*!< \brief Mean value of the turbulent kinetic energy. */
 	dist_ij_2,					/*!< \brief Length of the edge and face. */
 	*ProjFlux;	/*!< \brief Projection of the viscous fluxes. */
-	bool implicit;			/*!< \brief Implicit calculus. */
     
 public:
     
@@ -2970,7 +3140,6 @@ private:
 	Mean_Laminar_Viscosity, Mean_Eddy_Viscosity,			/*!< \brief Mean value of the viscosity. */
 	dist_ij_2,					/*!< \brief Length of the edge and face. */
 	*ProjFlux;	/*!< \brief Projection of the viscous fluxes. */
-	bool implicit;			/*!< \brief Implicit calculus. */
     
 public:
     
@@ -3009,7 +3178,6 @@ private:
 	double **Mean_GradTurbVar;
 	double *Proj_Mean_GradTurbVar_Kappa, *Proj_Mean_GradTurbVar_Edge, *Proj_Mean_GradTurbVar_Corrected;
 	double *Edge_Vector;
-	bool implicit;
 	double sigma, nu_i, nu_j, nu_e, dist_ij_2, proj_vector_ij, nu_hat_i, nu_hat_j;
 	unsigned short iVar, iDim;
     
@@ -3051,7 +3219,6 @@ private:
 	double **Mean_GradTurbVar;
 	double *Proj_Mean_GradTurbVar_Kappa, *Proj_Mean_GradTurbVar_Edge, *Proj_Mean_GradTurbVar_Corrected;
 	double *Edge_Vector;
-	bool implicit;
 	double sigma, nu_i, nu_j, nu_e, dist_ij_2, proj_vector_ij, nu_hat_i, nu_hat_j;
 	unsigned short iVar, iDim;
   
@@ -3092,7 +3259,6 @@ private:
 	double **Mean_GradTurbVar;
 	double *Proj_Mean_GradTurbVar_Kappa, *Proj_Mean_GradTurbVar_Edge, *Proj_Mean_GradTurbVar_Corrected;
 	double *Edge_Vector;
-	bool implicit;
 	double sigma, nu_i, nu_j, nu_e, dist_ij_2, proj_vector_ij, nu_hat_i, nu_hat_j;
 	unsigned short iVar, iDim;
     
@@ -3149,7 +3315,6 @@ private:
     
 	double F1_i, F1_j;                    /*!< \brief Menter's first blending function */
     
-	bool implicit;
 	unsigned short iVar, iDim;
     
 public:
@@ -3211,7 +3376,6 @@ private:
     
 	double F1_i, F1_j;                    /*!< \brief Menter's first blending function */
     
-	bool implicit;
 	unsigned short iVar, iDim;
     
 public:
@@ -3262,7 +3426,6 @@ private:
 	double *Proj_Mean_GradPsiVar_Edge;	/*!< \brief Projection of Mean_GradPsiVar onto Edge_Vector. */
 	double *Mean_GradPsiE;	/*!< \brief Counter for dimensions of the problem. */
 	double **Mean_GradPhi;	/*!< \brief Counter for dimensions of the problem. */
-    bool implicit;          /*!< \brief Boolean controlling Jacobian calculations. */
     
 public:
     
@@ -3310,7 +3473,6 @@ private:
 	double *Proj_Mean_GradPsiVar_Edge;	/*!< \brief Projection of Mean_GradPsiVar onto Edge_Vector. */
 	double *Mean_GradPsiE;	/*!< \brief Counter for dimensions of the problem. */
 	double **Mean_GradPhi;	/*!< \brief Counter for dimensions of the problem. */
-    bool implicit;
     
 public:
     
@@ -3753,7 +3915,6 @@ private:
 	double nu_hat_i;
 	double grad_nu_hat;
 	double prod_grads;
-	bool implicit;
     
 public:
     bool debugme; // For debugging only, remove this. -AA
@@ -3872,7 +4033,6 @@ public:
  */
 class CSourcePieceWise_FreeSurface : public CNumerics {
 	double U_ref, L_ref, Froude;
-	bool implicit;
     
 public:
     
@@ -4241,7 +4401,6 @@ public:
  */
 class CSource_Magnet : public CNumerics {
 private:
-	bool implicit;
 	double *MagneticField, *MagneticDipole,*velocity, *VcrossB;
 	double poisson_Conductivity,Stagnation_B;
 	double *Current_Density, *JcrossB,	*dpcenter, *vector_r;
@@ -4283,7 +4442,6 @@ class CConvective_Template : public CNumerics {
 private:
     
 	/* define private variables here */
-	bool implicit;
 	double *Diff_U;
 	double *Velocity_i, *Velocity_j, *RoeVelocity;
 	double *ProjFlux_i, *ProjFlux_j;
@@ -4364,7 +4522,7 @@ public:
  */
 class CUpwRoe_TNE2 : public CNumerics {
 private:
-	bool implicit, ionization;
+	bool ionization;
 	double *Diff_U;
   double *RoeU, *RoeV;
 	double *ProjFlux_i, *ProjFlux_j;
@@ -4415,7 +4573,7 @@ public:
  */
 class CUpwMSW_TNE2 : public CNumerics {
 private:
-	bool ionization, implicit;
+	bool ionization;
 	double *Diff_U;
 	double *u_i, *u_j, *ust_i, *ust_j;
 	double *Fc_i, *Fc_j;
@@ -4468,7 +4626,7 @@ public:
  */
 class CUpwAUSM_TNE2 : public CNumerics {
 private:
-	bool implicit, ionization;
+	bool ionization;
 	double *FcL, *FcR, *FcLR;
     double *dmLP, *dmRM, *dpLP, *dpRM;
     double *daL, *daR;
@@ -4513,7 +4671,7 @@ public:
  */
 class CUpwAUSMPWplus_TNE2 : public CNumerics {
 private:
-	bool implicit, ionization;
+	bool ionization;
 	double *FcL, *FcR;
   double *dmLdL, *dmLdR, *dmRdL, *dmRdR;
   double *dmLPdL, *dmLPdR, *dmRMdL, *dmRMdR;
@@ -4571,7 +4729,6 @@ private:
 	double Phi_i, Phi_j, sc0, StretchingFactor; /*!< \brief Streching parameters. */
 	double Epsilon_0, cte; /*!< \brief Artificial dissipation values. */
   //    double *dPdrhos, dPdrhoE, dPdrhoEve; /*!< \brief Partial derivative of pressure w.r.t. conserved quantities. */
-	bool implicit; /*!< \brief Implicit time integration. */
   bool ionization;  /*!< \brief Charged species with the mixture. */
 	bool stretching;
   unsigned short nSpecies, nVar, nPrimVar, nPrimVarGrad, nDim;
@@ -4627,7 +4784,6 @@ private:
     
 	*ProjFlux,	/*!< \brief Projection of the viscous fluxes. */
 	dist_ij;						/*!< \brief Length of the edge and face. */
-	bool implicit; /*!< \brief Implicit calculus. */
     
 public:
     
@@ -4686,7 +4842,6 @@ private:
   
 	*ProjFlux,	/*!< \brief Projection of the viscous fluxes. */
 	dist_ij;						/*!< \brief Length of the edge and face. */
-	bool implicit; /*!< \brief Implicit calculus. */
   
 public:
   
@@ -4732,7 +4887,7 @@ public:
  */
 class CSource_TNE2 : public CNumerics {
 private:
-  bool   implicit, ionization;
+  bool   ionization;
   unsigned short nSpecies, nVar, nPrimVar, nPrimVarGrad;
   int    *alphak, *betak;
   double *X; // Mole fraction
@@ -4796,7 +4951,6 @@ public:
  */
 class CUpwRoe_AdjTNE2 : public CNumerics {
 private:
-  bool implicit;
   unsigned short nVar, nPrimVar, nPrimVarGrad, nSpecies;
   double *MeanU, *MeanV, *MeandPdU;
   double *DiffPsi;
@@ -4850,7 +5004,6 @@ public:
  */
 class CUpwSW_AdjTNE2 : public CNumerics {
 private:
-  bool implicit;
   unsigned short nVar, nPrimVar, nPrimVarGrad, nSpecies;
   double *DiffPsi;
   double *UnitNormal;
@@ -4910,7 +5063,7 @@ private:
 	double Residual, ProjVelocity_i, ProjVelocity_j, ProjPhi, ProjPhi_Vel, sq_vel, phis1, phis2;
 	double MeanPsiRho, MeanPsiE, Param_p, Param_Kappa_4, Param_Kappa_2, Local_Lambda_i, Local_Lambda_j, MeanLambda;
 	double Phi_i, Phi_j, sc4, StretchingFactor, Epsilon_4, Epsilon_2;
-	bool implicit, stretching, grid_movement;
+	bool stretching, grid_movement;
     
 public:
     
@@ -4954,7 +5107,6 @@ public:
  */
 class CCentLax_AdjTNE2 : public CNumerics {
 private:
-  bool implicit;
   unsigned short nVar, nPrimVar, nPrimVarGrad, nSpecies, nDim;
 	double *DiffPsi, *MeanPsi;
   double Param_p, Param_Kappa_0;
@@ -5013,7 +5165,6 @@ private:
 	double *Edge_Vector;	/*!< \brief Vector going from node i to node j. */
   double **SigmaPhi;
   double **SigmaPsiE;
-  bool implicit;			/*!< \brief Implicit calculus. */
 public:
   
 	/*!
@@ -5048,7 +5199,6 @@ public:
  */
 class CSource_AdjTNE2 : public CNumerics {
 private:
-  bool   implicit;
   unsigned short nSpecies, nVar, nPrimVar, nPrimVarGrad;
   double *rhos, *vel;
   double *GInvRho, **GVeloRho, **tau, **eta, **pi, **zeta;
@@ -5088,5 +5238,42 @@ public:
 	void ComputeSourceConservative(double *val_residual, CConfig *config);
 };
 
+/*!
+ * \brief Residual of a numerics whose class is fixed when the loop is compiled (the edge and point loops
+ *        of the solvers are instantiated on the class of their numerics). The call is resolved statically,
+ *        except for Num = CNumerics (classes without their own instantiation), which keeps the virtual call.
+ * \param[in] numerics - Numerics of the loop.
+ * \param[out] val_residual - Pointer to the total residual.
+ * \param[out] val_Jacobian_i - Jacobian of the numerical method at node i (implicit computation).
+ * \param[out] val_Jacobian_j - Jacobian of the numerical method at node j (implicit computation).
+ * \param[in] config - Definition of the particular problem.
+ */
+template <class Num>
+void ComputeResidual_Static(Num *numerics, double *val_residual, double **val_Jacobian_i,
+                            double **val_Jacobian_j, CConfig *config);
+
+/*!
+ * \brief CNumerics::GetLanes of a numerics whose class is fixed when the loop is compiled (see ComputeResidual_Static).
+ * \param[in] numerics - Numerics of the loop.
+ * \return <code>TRUE</code> if the edges can be computed by batches of NUMERICS_LANES.
+ */
+template <class Num>
+bool GetLanes_Static(Num *numerics);
+
+/*!
+ * \brief CNumerics::ComputeResidual_Lanes of a numerics whose class is fixed when the loop is compiled
+ *        (see ComputeResidual_Static).
+ * \param[in] numerics - Numerics of the loop.
+ * \param[in] val_V_i - Primitive variables at the points i.
+ * \param[in] val_V_j - Primitive variables at the points j.
+ * \param[in] val_normal - Normal vectors of the edges.
+ * \param[out] val_residual - Residuals.
+ * \param[out] val_Jacobian_i - Jacobians with respect to the points i (implicit computation).
+ * \param[out] val_Jacobian_j - Jacobians with respect to the points j (implicit computation).
+ * \param[in] config - Definition of the particular problem.
+ */
+template <class Num>
+void ComputeResidual_Lanes_Static(Num *numerics, double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                                  double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config);
 
 #include "numerics_structure.inl"
@@ -57,6 +57,11 @@ inline void CNumerics::ComputeResidual(double *val_resconv_i, double *val_resvis
 							
 inline void CNumerics::ComputeResidual(double **val_stiffmatrix_elem, CConfig *config) { }
 
+inline bool CNumerics::GetLanes(void) { return false; }
+
+inline void CNumerics::ComputeResidual_Lanes(double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                                             double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config) { }
+
 inline void CNumerics::GetEq_Rxn_Coefficients(double **EqnRxnConstants, CConfig *config) { };
 														
 inline void CNumerics::ComputeResidual(double *val_residual, double **val_Jacobian_i, CConfig *config) { }
@@ -269,8 +274,11 @@ inline void CNumerics::SetConsVarGradient(double **val_consvar_grad) {
 inline void CNumerics::SetCoord(double *val_coord_i, double *val_coord_j) {
 	Coord_i = val_coord_i;
 	Coord_j = val_coord_j;
+	Edge_Geometry = NULL;
 }
 
+inline void CNumerics::SetEdge_Geometry(double *val_edge_geometry) { Edge_Geometry = val_edge_geometry; }
+
 inline void CNumerics::SetCoord(double *val_coord_0, double *val_coord_1, 
 									 double *val_coord_2) {
 	Coord_0 = val_coord_0;
@@ -348,6 +356,18 @@ inline void CNumerics::SetAuxVarGrad(double *val_auxvargrad_i, double *val_auxva
 
 inline void CNumerics::SetNormal(double *val_normal) { Normal = val_normal; }
 
+inline CNumerics *CNumerics::GetThread_Numerics(unsigned short val_iThread) {
+  return (val_iThread < nThread_Numerics ? Thread_Numerics[val_iThread] : this);
+}
+
+inline void CNumerics::SetImplicit(bool val_implicit) {
+  implicit = val_implicit;
+  for (unsigned short iThread = 1; iThread < nThread_Numerics; iThread++)
+    Thread_Numerics[iThread]->SetImplicit(val_implicit);
+}
+
+inline bool CNumerics::GetImplicit(void) { return implicit; }
+
 inline void CNumerics::SetVolume(double val_volume) { Volume = val_volume; }
 
 inline void CSourcePieceWise_TurbSST::SetF1blending(double val_F1_i, double val_F1_j){ 
@@ -392,3 +412,39 @@ inline void CNumerics::ComputeResidual(double **val_Jacobian_i, double *val_Jaco
 
 inline void CNumerics::ComputeResidual(double **val_Jacobian_i, double *val_Jacobian_mui, double ***val_Jacobian_gradi, 
 									double **val_Jacobian_j, double *val_Jacobian_muj, double ***val_Jacobian_gradj, CConfig *config) { }
+
+inline bool CUpwRoe_Flow::GetLanes(void) { return !grid_movement; }
+
+inline bool CUpwAUSM_Flow::GetLanes(void) { return true; }
+
+inline bool CUpwHLLC_Flow::GetLanes(void) { return true; }
+
+template <class Num>
+inline void ComputeResidual_Static(Num *numerics, double *val_residual, double **val_Jacobian_i,
+                                   double **val_Jacobian_j, CConfig *config) {
+  numerics->Num::ComputeResidual(val_residual, val_Jacobian_i, val_Jacobian_j, config);
+}
+
+template <>
+inline void ComputeResidual_Static<CNumerics>(CNumerics *numerics, double *val_residual, double **val_Jacobian_i,
+                                              double **val_Jacobian_j, CConfig *config) {
+  numerics->ComputeResidual(val_residual, val_Jacobian_i, val_Jacobian_j, config);
+}
+
+template <class Num>
+inline bool GetLanes_Static(Num *numerics) { return numerics->Num::GetLanes(); }
+
+template <>
+inline bool GetLanes_Static<CNumerics>(CNumerics *numerics) { return numerics->GetLanes(); }
+
+template <class Num>
+inline void ComputeResidual_Lanes_Static(Num *numerics, double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                                         double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config) {
+  numerics->Num::ComputeResidual_Lanes(val_V_i, val_V_j, val_normal, val_residual, val_Jacobian_i, val_Jacobian_j, config);
+}
+
+template <>
+inline void ComputeResidual_Lanes_Static<CNumerics>(CNumerics *numerics, double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                                                    double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config) {
+  numerics->ComputeResidual_Lanes(val_V_i, val_V_j, val_normal, val_residual, val_Jacobian_i, val_Jacobian_j, config);
+}
@@ -948,14 +948,71 @@ enum ENUM_LINEAR_SOLVER_PREC {
   JACOBI = 1,		/*!< \brief Jacobi preconditioner. */
   LU_SGS = 2,		/*!< \brief LU SGS preconditioner. */
   LINELET = 3,  /*!< \brief Line implicit preconditioner. */
-  ILU = 4       /*!< \brief ILU(0) preconditioner. */
+  ILU = 4,      /*!< \brief ILU(0) preconditioner. */
+  MULTIGRID_PREC = 5  /*!< \brief One cycle of agglomeration multigrid (smoother given by LINEAR_SOLVER_SMOOTHER). */
 };
 static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = CCreateMap<string, ENUM_LINEAR_SOLVER_PREC>
 ("JACOBI", JACOBI)
 ("LU_SGS", LU_SGS)
 ("LINELET", LINELET)
+("ILU0", ILU)
+("MULTIGRID", MULTIGRID_PREC);
+static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Smoother_Map = CCreateMap<string, ENUM_LINEAR_SOLVER_PREC>
+("JACOBI", JACOBI)
+("LU_SGS", LU_SGS)
+("LINELET", LINELET)
 ("ILU0", ILU);
 
+/*!
+ * \brief types of coarse operators of the multigrid preconditioner
+ */
+enum ENUM_MG_OPERATOR {
+  MG_REDISCRETIZED = 0,  /*!< \brief Jacobians assembled on the coarse grids. */
+  MG_GALERKIN = 1        /*!< \brief Galerkin operators, sum of the fine blocks of the agglomerated points. */
+};
+static const map<string, ENUM_MG_OPERATOR> MG_Operator_Map = CCreateMap<string, ENUM_MG_OPERATOR>
+("REDISCRETIZED", MG_REDISCRETIZED)
+("GALERKIN", MG_GALERKIN);
+
+/*!
+ * \brief types of schedules of the triangular sweeps of the LU-SGS and ILU preconditioners
+ */
+enum ENUM_SWEEP_SCHEDULE {
+  SWEEP_SEQUENTIAL = 0,   /*!< \brief One row after the other (natural ordering). */
+  SWEEP_LEVEL_SETS = 1,   /*!< \brief Parallel level sets of independent rows (same preconditioner as the natural ordering). */
+  SWEEP_MULTICOLOR = 2    /*!< \brief Parallel colors of independent rows (the rows are reordered, different preconditioner). */
+};
+static const map<string, ENUM_SWEEP_SCHEDULE> Sweep_Schedule_Map = CCreateMap<string, ENUM_SWEEP_SCHEDULE>
+("SEQUENTIAL", SWEEP_SEQUENTIAL)
+("LEVEL_SETS", SWEEP_LEVEL_SETS)
+("MULTICOLOR", SWEEP_MULTICOLOR);
+
+/*!
+ * \brief types of renumbering of the points of the grid
+ */
+enum ENUM_POINT_ORDERING {
+  ORDERING_NONE = 0,      /*!< \brief Order of the grid file. */
+  ORDERING_RCM = 1,       /*!< \brief Reverse Cuthill-McKee (minimum bandwidth). */
+  ORDERING_HILBERT = 2,   /*!< \brief Hilbert space-filling curve of the coordinates. */
+  ORDERING_MORTON = 3     /*!< \brief Morton (Z-order) space-filling curve of the coordinates. */
+};
+static const map<string, ENUM_POINT_ORDERING> Point_Ordering_Map = CCreateMap<string, ENUM_POINT_ORDERING>
+("NONE", ORDERING_NONE)
+("RCM", ORDERING_RCM)
+("HILBERT", ORDERING_HILBERT)
+("MORTON", ORDERING_MORTON);
+
+/*!
+ * \brief types of orthogonalization of the Krylov vectors of FGMRES
+ */
+enum ENUM_GRAM_SCHMIDT {
+  MODIFIED_GRAM_SCHMIDT = 0,    /*!< \brief Modified Gram-Schmidt, one vector after the other (selective reorthogonalization). */
+  CLASSICAL_GRAM_SCHMIDT_2 = 1  /*!< \brief Classical Gram-Schmidt applied twice, all the vectors at once (fused passes). */
+};
+static const map<string, ENUM_GRAM_SCHMIDT> Gram_Schmidt_Map = CCreateMap<string, ENUM_GRAM_SCHMIDT>
+("MGS", MODIFIED_GRAM_SCHMIDT)
+("CGS2", CLASSICAL_GRAM_SCHMIDT_2);
+
 /*!
  * \brief types of analytic definitions for various geometries
  */
@@ -30,6 +30,7 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <typeinfo>
 #include <iostream>
 #include <stdlib.h>
 #include <stdio.h>
@@ -54,6 +55,8 @@ using namespace std;
 class CSolver {
 protected:
 	unsigned short IterLinSolver;	/*!< \brief Linear solver iterations. */
+  unsigned long nResidual_Eval;   /*!< \brief Residual evaluations of the Jacobian-free products of the last linear solver call. */
+  double TolLinSolver;   /*!< \brief Tolerance of the last linear solver call. */
 	unsigned short nVar,					/*!< \brief Number of variables of the problem. */
   nPrimVar,                     /*!< \brief Number of primitive variables of the problem. */
   nPrimVarGrad,                 /*!< \brief Number of primitive variables of the problem in the gradient computation. */
@@ -92,6 +95,75 @@ protected:
 	**cvector;			 /*!< \brief Auxiliary structure for computing gradients by least-squares */
 
     unsigned short nOutputVariables;  /*!< \brief Number of variables to write. */
+  
+  /*!
+	 * \brief Auxiliary vectors and matrices of one thread of the edge loops.
+	 */
+  struct CSolver_Work {
+    double *Residual,    /*!< \brief Auxiliary nVar vector for the residual of an edge. */
+    *Primitive_i,        /*!< \brief Auxiliary vector for the reconstructed primitive variables at point i. */
+    *Primitive_j,        /*!< \brief Auxiliary vector for the reconstructed primitive variables at point j. */
+    *Solution_i,         /*!< \brief Auxiliary nVar vector for the reconstructed solution at point i. */
+    *Solution_j,         /*!< \brief Auxiliary nVar vector for the reconstructed solution at point j. */
+    *Vector_i,           /*!< \brief Auxiliary nDim vector for the reconstruction at point i. */
+    *Vector_j;           /*!< \brief Auxiliary nDim vector for the reconstruction at point j. */
+    double **Jacobian_i, /*!< \brief Auxiliary matrix for the Jacobian of an edge at point i. */
+    **Jacobian_j;        /*!< \brief Auxiliary matrix for the Jacobian of an edge at point j. */
+    double *Lanes_V_i,   /*!< \brief Primitive variables at the points i of a batch of NUMERICS_LANES edges (interleaved by lanes). */
+    *Lanes_V_j,          /*!< \brief Primitive variables at the points j of a batch of edges. */
+    *Lanes_Normal,       /*!< \brief Normal vectors of a batch of edges. */
+    *Lanes_Residual,     /*!< \brief Residuals of a batch of edges. */
+    *Lanes_Jacobian_i,   /*!< \brief Jacobians at the points i of a batch of edges. */
+    *Lanes_Jacobian_j;   /*!< \brief Jacobians at the points j of a batch of edges. */
+    unsigned long *Lanes_Edge;  /*!< \brief Edges of the lanes of a batch. */
+  };
+  CSolver_Work *Thread_Work;    /*!< \brief Auxiliary structures of each thread of the edge loops (see SetThread_Work). */
+  unsigned short nThread_Work;  /*!< \brief Number of threads with auxiliary structures. */
+  CVariableStorage *Variable_Storage;  /*!< \brief Contiguous fields of the variables of node (NULL if they are allocated point by point). */
+  
+  /*!
+	 * \brief Arguments of the threaded edge loops of the solvers (see CGeometry::Run_EdgeLoop).
+	 */
+  struct CSolver_Loop {
+    CSolver *solver;             /*!< \brief Solver of the loop. */
+    CGeometry *geometry;         /*!< \brief Grid of the loop. */
+    CSolver **solver_container;  /*!< \brief Solvers of the grid (other equations). */
+    CNumerics *numerics;         /*!< \brief Numerics of the first thread. */
+    CConfig *config;             /*!< \brief Definition of the problem. */
+    unsigned short iMesh;        /*!< \brief Index of the grid. */
+  };
+  
+  /*!
+	 * \brief Allocate the auxiliary structures of each thread of the edge loops (only the first time).
+	 * \param[in] val_nPrimVar - Size of the vectors of primitive variables.
+	 */
+  void SetThread_Work(unsigned short val_nPrimVar);
+  
+  /*!
+	 * \brief Move the arrays of the variables of all the points (node) to contiguous fields, called
+   *        once the variables are created. The accessors of the variables are views of the fields.
+	 */
+  void SetVariable_Storage(void);
+  
+  /*!
+	 * \brief Loop over the edges with the threads of the pool (see CGeometry::Run_EdgeLoop), the
+   *        arguments are passed to the kernel in a CSolver_Loop.
+	 * \param[in] kernel - Kernel of the loop.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] numerics - Description of the numerical method (each thread uses its own copy).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Index of the mesh in multigrid computations.
+	 */
+  void Run_EdgeLoop(CGeometry::EdgeKernel kernel, CGeometry *geometry, CSolver **solver_container,
+                    CNumerics *numerics, CConfig *config, unsigned short iMesh);
+  
+  /*!
+	 * \brief Threaded edge loops (see Run_EdgeLoop) of the Green-Gauss gradient and of the limiter of the solution.
+	 */
+  static void SetSolution_Gradient_GG_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  static void SetSolution_Limiter_Bounds_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  static void SetSolution_Limiter_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
 
 public:
   
@@ -99,6 +171,14 @@ public:
   CSysVector LinSysRes;		/*!< \brief vector to store iterative residual of implicit linear system. */
   CSysVector LinSysAux;		/*!< \brief vector to store iterative residual of implicit linear system. */
 	CSysMatrix Jacobian; /*!< \brief Complete sparse Jacobian structure for implicit computations. */
+  CSysSolve System;    /*!< \brief Linear solver of the implicit system, its Krylov workspace is kept between iterations. */
+  CSysMatrix **Jacobian_Array;   /*!< \brief Jacobians of the multigrid levels, as seen by the linear solver. */
+  CSysVector **LinSysRes_Array;  /*!< \brief Residuals of the multigrid levels, as seen by the linear solver. */
+  CSysVector **LinSysSol_Array;  /*!< \brief Solutions of the multigrid levels, as seen by the linear solver. */
+  bool Jacobian_Update;          /*!< \brief The Jacobian is assembled in this iteration (otherwise the lagged one is reused). */
+  double *Jacobian_Delta;        /*!< \brief Time step term (Vol/dt) added to the diagonal of the Jacobian since it was assembled. */
+  bool Jacobian_Identity;        /*!< \brief Diagonal blocks of the assembled Jacobian have been replaced by the identity (points without time step). */
+  double *Edge_Primitive;        /*!< \brief Reconstructed primitive variables at both sides of each edge (fused reconstruction, otherwise NULL). */
   
 	CSysMatrix StiffMatrix; /*!< \brief Sparse structure for storing the stiffness matrix in Galerkin computations, and grid movement. */
 
@@ -130,11 +210,61 @@ public:
 	 */
 	void SetResidual_RMS(CGeometry *geometry, CConfig *config);
   
+  /*!
+	 * \brief Add the time step term (Vol/dt) to the diagonal of the Jacobian. A lagged Jacobian only
+	 *        receives the change since the last iteration, so its diagonal follows the time step.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 */
+	void SetTime_Step_Diagonal(CGeometry *geometry);
+  
 	/*!
 	 * \brief Get number of linear solver iterations.
 	 * \return Number of linear solver iterations.
 	 */
 	unsigned short GetIterLinSolver(void);
+  
+  /*!
+	 * \brief Set the number of residual evaluations of the Jacobian-free matrix-vector products.
+	 * \param[in] val_nresidual_eval - Number of residual evaluations of the last linear solver call.
+	 */
+	void SetnResidual_Eval(unsigned long val_nresidual_eval);
+  
+  /*!
+	 * \brief Get the number of residual evaluations of the Jacobian-free matrix-vector products.
+	 * \return Number of residual evaluations of the last linear solver call.
+	 */
+	unsigned long GetnResidual_Eval(void);
+  
+  /*!
+	 * \brief Set the tolerance of the linear solver (adaptive with LINEAR_SOLVER_FORCING).
+	 * \param[in] val_tollinsolver - Tolerance of the last linear solver call.
+	 */
+	void SetTolLinSolver(double val_tollinsolver);
+  
+  /*!
+	 * \brief Get the tolerance of the linear solver.
+	 * \return Tolerance of the last linear solver call.
+	 */
+	double GetTolLinSolver(void);
+  
+  /*!
+	 * \brief Set if the Jacobian is assembled in this iteration, or the lagged Jacobian (and its preconditioner) is reused.
+	 * \param[in] val_update - <code>TRUE</code> if the Jacobian is assembled.
+	 */
+	void SetJacobian_Update(bool val_update);
+  
+  /*!
+	 * \brief Check if the Jacobian is assembled in this iteration.
+	 * \return <code>FALSE</code> if only the residual is computed, and the lagged Jacobian is reused.
+	 */
+	bool GetJacobian_Update(void);
+  
+  /*!
+	 * \brief Check if diagonal blocks of the last assembled Jacobian have been replaced by the identity (points without
+	 *        time step). The assembled blocks are lost, so the Jacobian can't be lagged in the next iteration.
+	 * \return <code>TRUE</code> if the Jacobian must be assembled in the next iteration.
+	 */
+	bool GetJacobian_Identity(void);
     
 	/*!
 	 * \brief Get the value of the maximum delta time.
@@ -175,6 +305,13 @@ public:
 	 */
 	unsigned short GetnPrimVarGrad(void);
   
+  /*!
+	 * \brief Get the reconstructed primitive variables of the edges, nPrimVarGrad values at the side of the
+   *        first point and then nPrimVarGrad at the side of the second point, edge by edge.
+	 * \return Face states of the last preprocessing of the finest grid, <code>NULL</code> if they are not stored.
+	 */
+	double *GetEdge_Primitive(void);
+  
   /*!
 	 * \brief Get the number of variables of the problem.
 	 */
@@ -1617,6 +1754,61 @@ protected:
 	New_Func;			/*!< \brief Current value of the objective function (the function which is monitored). */
   double AoA_old;  /*!< \brief Old value of the angle of attack (monitored). */
   
+  /*!
+	 * \brief Threaded edge loops (see CSolver::Run_EdgeLoop) of the residuals, time step, eigenvalues,
+   *        sensors, gradients and limiters of the flow.
+	 */
+  static void SetTime_Step_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  template <class Num, bool second_order, bool implicit, bool grid_movement>
+  static void Centered_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  template <class Num, bool second_order, bool limiter, bool implicit, bool grid_movement, bool roe_turkel>
+  static void Upwind_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  static void SetMax_Eigenvalue_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  static void SetUndivided_Laplacian_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  static void SetDissipation_Switch_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  template <bool bounds>
+  static void SetPrimVar_Gradient_GG_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  static void SetPrimVar_Limiter_Bounds_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  static void SetPrimVar_Limiter_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  static void SetPrimVar_Edge_States_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  
+  /*!
+	 * \brief Gradients, limiter and face states of the second order reconstruction of the finest grid. With
+   *        FUSED_RECONSTRUCTION the bounds of the limiter are found in the pass of the gradients, and the
+   *        reconstructed states are stored for each edge (see CSolver::GetEdge_Primitive).
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_limiter - Compute the limiter.
+	 */
+  void SetPrimVar_Reconstruction(CGeometry *geometry, CConfig *config, bool val_limiter);
+  
+  /*!
+	 * \brief Gradients of the primitive variables (see the public versions), which can also initialize
+   *        the limiter and find its bounds, the maximum and minimum differences with the neighbours.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_bounds - Find the bounds of the limiter in the same pass.
+	 */
+  void SetPrimVar_Gradient_GG(CGeometry *geometry, CConfig *config, bool val_bounds);
+  void SetPrimVar_Gradient_LS(CGeometry *geometry, CConfig *config, bool val_bounds);
+  
+  /*!
+	 * \brief Limiter of the primitive variables.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_bounds - Initialize the limiter and find its bounds (<code>FALSE</code> if the pass of the gradients did it).
+	 */
+  void SetPrimVar_Limiter(CGeometry *geometry, CConfig *config, bool val_bounds);
+  
+  /*!
+	 * \brief Instantiations of the residual loops for the class of the numerics (see ComputeResidual_Static),
+   *        so the options are not tested and the residual is not a virtual call edge by edge.
+	 */
+  template <class Num>
+  static CGeometry::EdgeKernel Centered_Residual_Kernel(bool second_order, bool implicit, bool grid_movement);
+  template <class Num, bool roe_turkel>
+  static CGeometry::EdgeKernel Upwind_Residual_Kernel(bool second_order, bool limiter, bool implicit, bool grid_movement);
+  
 public:
     
 	/*!
@@ -2372,6 +2564,13 @@ private:
   AllBound_HeatFlux_Visc,		/*!< \brief Heat load (viscous contribution) for all the boundaries. */
   AllBound_MaxHeatFlux_Visc; /*!< \brief Maximum heat flux (viscous contribution) for all boundaries. */
   
+  /*!
+	 * \brief Threaded edge loops (see CSolver::Run_EdgeLoop) of the time step and of the viscous residual.
+	 */
+  static void SetTime_Step_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  template <class Num, bool implicit, bool sst>
+  static void Viscous_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  
 public:
   
 	/*!
@@ -2566,6 +2765,20 @@ protected:
 	*upperlimit;            /*!< \brief contains upper limits for turbulence variables. */
 	double Gamma;									/*!< \brief Fluid's Gamma constant (ratio of specific heats). */
 	double Gamma_Minus_One;				/*!< \brief Fluids's Gamma - 1.0  . */
+  
+  /*!
+	 * \brief Threaded edge loops (see CSolver::Run_EdgeLoop) of the convective and viscous residuals.
+	 */
+  template <class Num, bool second_order, bool limiter>
+  static void Upwind_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  template <class Num, bool sst>
+  static void Viscous_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end);
+  
+  /*!
+	 * \brief Instantiation of the convective loop for the class of the numerics (see ComputeResidual_Static).
+	 */
+  template <class Num>
+  static CGeometry::EdgeKernel Upwind_Residual_Kernel(bool second_order, bool limiter);
     
 public:
     
@@ -2662,6 +2875,12 @@ public:
 class CTurbSASolver: public CTurbSolver {
 private:
 	double nu_tilde_Inf;
+  
+  /*!
+	 * \brief Point loop of the source term, instantiated on the class of the numerics (see ComputeResidual_Static).
+	 */
+  template <class Num>
+  void Source_Residual_Points(Num *numerics, CGeometry *geometry, CSolver **solver_container, CConfig *config);
 	
 public:
 	/*!
@@ -2793,6 +3012,12 @@ private:
 	double *constants,  /*!< \brief Constants for the model. */
 	kine_Inf,           /*!< \brief Free-stream turbulent kinetic energy. */
 	omega_Inf;          /*!< \brief Free-stream specific dissipation. */
+  
+  /*!
+	 * \brief Point loop of the source term, instantiated on the class of the numerics (see ComputeResidual_Static).
+	 */
+  template <class Num>
+  void Source_Residual_Points(Num *numerics, CGeometry *geometry, CSolver **solver_container, CConfig *config);
     
 public:
 	/*!
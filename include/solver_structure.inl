@@ -28,6 +28,20 @@ inline unsigned short CSolver::GetnSpecies(void) { return 0; }
 
 inline unsigned short CSolver::GetIterLinSolver(void) { return IterLinSolver; }
 
+inline void CSolver::SetnResidual_Eval(unsigned long val_nresidual_eval) { nResidual_Eval = val_nresidual_eval; }
+
+inline unsigned long CSolver::GetnResidual_Eval(void) { return nResidual_Eval; }
+
+inline void CSolver::SetTolLinSolver(double val_tollinsolver) { TolLinSolver = val_tollinsolver; }
+
+inline double CSolver::GetTolLinSolver(void) { return TolLinSolver; }
+
+inline void CSolver::SetJacobian_Update(bool val_update) { Jacobian_Update = val_update; }
+
+inline bool CSolver::GetJacobian_Update(void) { return Jacobian_Update; }
+
+inline bool CSolver::GetJacobian_Identity(void) { return Jacobian_Identity; }
+
 inline double CSolver::GetCSensitivity(unsigned short val_marker, unsigned short val_vertex) { return 0; }
 
 inline void CSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep, 
@@ -370,6 +384,10 @@ inline double CSolver::GetRes_Max(unsigned short val_var) { return Residual_Max[
 inline unsigned long CSolver::GetPoint_Max(unsigned short val_var) { return Point_Max[val_var]; }
 
 inline void CSolver::Set_OldSolution(CGeometry *geometry) {
+  if (Variable_Storage != NULL) {
+    Variable_Storage->CopyField(FIELD_SOLUTION, FIELD_SOLUTION_OLD, geometry->GetnPoint());
+    return;
+  }
 	for(unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) 
 		node[iPoint]->Set_OldSolution(); // The loop should be over nPoints 
                                      //  to guarantee that the boundaries are
@@ -384,6 +402,8 @@ inline unsigned short CSolver::GetnPrimVar(void) { return nPrimVar; }
 
 inline unsigned short CSolver::GetnPrimVarGrad(void) { return nPrimVarGrad; }
 
+inline double *CSolver::GetEdge_Primitive(void) { return Edge_Primitive; }
+
 inline double CSolver::GetMax_Delta_Time(void) { return Max_Delta_Time; }
 
 inline double CSolver::GetMin_Delta_Time(void) { return Min_Delta_Time; }
@@ -0,0 +1,128 @@
+/*!
+ * \file thread_structure.hpp
+ * \brief Headers of the shared memory thread pool used by the linear algebra (and other) loops.
+ *        The subroutines and functions are in the <i>thread_structure.cpp</i> file.
+ * \author Aerospace Design Laboratory (Stanford University).
+ * \version 1.2.0
+ *
+ * SU2 EDU, Copyright (C) 2014 Aerospace Design Laboratory (Stanford University).
+ *
+ * SU2 EDU is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 EDU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2 EDU. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <iostream>
+#include <cstdlib>
+
+using namespace std;
+
+const unsigned long THREAD_MIN_WORK = 8192; /*!< \brief Minimum amount of work (entries of a vector, rows...) to wake up the threads. */
+const unsigned long REDUCTION_SIZE = 1024;  /*!< \brief Number of entries of each fixed partial sum of a reduction. */
+
+/*!
+ * \class CThreadPool
+ * \brief Persistent pool of POSIX threads for the shared memory parallel loops.
+ * \author Aerospace Design Laboratory (Stanford University).
+ * \version 1.2.0
+ *
+ * The threads are created once (see Initialize) and sleep between jobs. A job is a
+ * kernel that receives its thread index and the number of threads, the calling thread
+ * works as thread 0. The work is always split in the same static contiguous chunks
+ * (see GetChunk), so each thread touches the same part of the arrays in every loop
+ * (first touch places the pages close to it on NUMA nodes), and the reductions are
+ * done over fixed chunks of REDUCTION_SIZE entries, so their result doesn't depend
+ * on the number of threads.
+ */
+class CThreadPool {
+
+public:
+
+  /*!
+   * \brief Kernel executed by each thread of the pool.
+   * \param[in] data - Arguments of the kernel.
+   * \param[in] iThread - Index of the thread.
+   * \param[in] nThread - Number of threads that execute the kernel.
+   */
+  typedef void (*Kernel)(void *data, unsigned short iThread, unsigned short nThread);
+
+  /*!
+   * \brief Start the threads of the pool.
+   * \param[in] val_nThread - Number of threads, if 0 the environment variable SU2_NUM_THREADS
+   *            is used (one thread if it is not defined).
+   */
+  static void Initialize(unsigned short val_nThread);
+
+  /*!
+   * \brief Stop and join the threads of the pool.
+   */
+  static void Finalize(void);
+
+  /*!
+   * \brief Get the number of threads of the pool.
+   * \return Number of threads (1 if the pool has not been initialized).
+   */
+  static unsigned short GetnThread(void);
+
+  /*!
+   * \brief Execute a kernel with all the threads of the pool, and wait for them.
+   * \param[in] kernel - Kernel to be executed.
+   * \param[in] data - Arguments of the kernel.
+   * \param[in] nWork - Size of the job, small jobs are done by the calling thread alone.
+   */
+  static void Run(Kernel kernel, void *data, unsigned long nWork);
+
+  /*!
+   * \brief Static partition of a loop in contiguous chunks.
+   * \param[in] nItem - Number of items of the loop.
+   * \param[in] val_iThread - Index of the thread.
+   * \param[in] val_nThread - Number of threads.
+   * \param[out] begin - First item of the chunk.
+   * \param[out] end - Last item (not included) of the chunk.
+   */
+  static void GetChunk(unsigned long nItem, unsigned short val_iThread, unsigned short val_nThread,
+                       unsigned long & begin, unsigned long & end);
+
+  /*!
+   * \brief Wait until all the threads of a kernel have reached this point (for kernels with
+   *        several dependent phases, like the colors of the edge loops).
+   * \param[in] val_nThread - Number of threads that execute the kernel (nothing is done with 1).
+   */
+  static void Barrier(unsigned short val_nThread);
+
+private:
+
+  static unsigned short nThread;         /*!< \brief Number of threads (including the calling one). */
+  static pthread_t *Threads;             /*!< \brief Worker threads. */
+  static pthread_mutex_t Mutex;          /*!< \brief Lock of the state of the pool. */
+  static pthread_cond_t Cond_Start;      /*!< \brief Signal of a new job to the workers. */
+  static pthread_cond_t Cond_Done;       /*!< \brief Signal of the end of the job to the calling thread. */
+  static pthread_cond_t Cond_Barrier;    /*!< \brief Signal of the last thread that reaches a barrier. */
+  static unsigned long Generation;       /*!< \brief Counter of jobs, to identify a new one. */
+  static unsigned short nBusy;           /*!< \brief Number of workers still running the job. */
+  static unsigned short nBarrier;        /*!< \brief Number of threads waiting at the current barrier. */
+  static unsigned long Barrier_Generation; /*!< \brief Counter of barriers, to identify the release of the current one. */
+  static bool Running;                   /*!< \brief A job is being executed (nested jobs are serial). */
+  static bool Stop;                      /*!< \brief The workers must finish. */
+  static Kernel Job;                     /*!< \brief Kernel of the current job. */
+  static void *Job_Data;                 /*!< \brief Arguments of the current job. */
+
+  /*!
+   * \brief Main loop of the worker threads.
+   * \param[in] arg - Index of the thread.
+   */
+  static void *Worker(void *arg);
+
+};
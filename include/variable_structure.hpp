@@ -32,6 +32,8 @@
 
 using namespace std;
 
+class CVariableStorage;
+
 /*! 
  * \class CVariable
  * \brief Main class for defining the variables.
@@ -96,6 +98,13 @@ public:
 	 */
 	virtual ~CVariable(void);
 
+	/*!
+	 * \brief Hand the arrays of the variable to the contiguous storage of the solver (or take them back),
+	 *        see CVariableStorage. The derived classes add their own arrays.
+	 * \param[in] storage - Storage of the fields of all the points.
+	 */
+	virtual void SetStorage(CVariableStorage *storage);
+
 	/*!
 	 * \brief Set the value of the solution.
 	 * \param[in] val_solution - Solution of the problem.
@@ -1573,6 +1582,12 @@ public:
 	 */
 	virtual ~CEulerVariable(void);
 
+	/*!
+	 * \brief Hand the arrays of the variable (including the primitive ones) to the contiguous storage.
+	 * \param[in] storage - Storage of the fields of all the points.
+	 */
+	void SetStorage(CVariableStorage *storage);
+
 	/*!
 	 * \brief Set to zero the gradient of the primitive variables.
 	 */
@@ -2008,6 +2023,12 @@ public:
 	 */
 	virtual ~CTurbVariable(void);
 
+	/*!
+	 * \brief Hand the arrays of the variable to the contiguous storage.
+	 * \param[in] storage - Storage of the fields of all the points.
+	 */
+	void SetStorage(CVariableStorage *storage);
+
 	/*!
 	 * \brief Get the value of the eddy viscosity.
 	 * \return the value of the eddy viscosity.
@@ -2115,4 +2136,130 @@ public:
 	double GetCrossDiff(void);
 };
 
+/*!
+ * \brief Fields of the variables kept by CVariableStorage.
+ */
+enum ENUM_VARIABLE_FIELD {
+  FIELD_SOLUTION = 0,             /*!< \brief Solution. */
+  FIELD_SOLUTION_OLD = 1,         /*!< \brief Old solution. */
+  FIELD_SOLUTION_TIME_N = 2,      /*!< \brief Solution at time n (dual time). */
+  FIELD_SOLUTION_TIME_N1 = 3,     /*!< \brief Solution at time n-1 (dual time). */
+  FIELD_GRADIENT = 4,             /*!< \brief Gradient of the solution. */
+  FIELD_LIMITER = 5,              /*!< \brief Limiter of the solution. */
+  FIELD_SOLUTION_MAX = 6,         /*!< \brief Max of the neighbors for the limiters. */
+  FIELD_SOLUTION_MIN = 7,         /*!< \brief Min of the neighbors for the limiters. */
+  FIELD_GRAD_AUXVAR = 8,          /*!< \brief Gradient of the auxiliar variable. */
+  FIELD_UNDIVIDED_LAPLACIAN = 9,  /*!< \brief Undivided Laplacian. */
+  FIELD_RES_TRUNC_ERROR = 10,     /*!< \brief Truncation error of the multigrid. */
+  FIELD_RESIDUAL_OLD = 11,        /*!< \brief Residual smoothing. */
+  FIELD_RESIDUAL_SUM = 12,        /*!< \brief Residual smoothing. */
+  FIELD_TS_SOURCE = 13,           /*!< \brief Time spectral source term. */
+  FIELD_WIND_GUST = 14,           /*!< \brief Wind gust. */
+  FIELD_WIND_GUST_DER = 15,       /*!< \brief Derivatives of the wind gust. */
+  FIELD_PRIMITIVE = 16,           /*!< \brief Primitive variables. */
+  FIELD_GRADIENT_PRIMITIVE = 17,  /*!< \brief Gradient of the primitive variables. */
+  FIELD_LIMITER_PRIMITIVE = 18    /*!< \brief Limiter of the primitive variables. */
+};
+const unsigned short MAX_FIELDS = 19;  /*!< \brief Number of fields of the variables. */
+const unsigned long VARIABLE_ALIGNMENT = 64;  /*!< \brief Alignment (bytes) of the fields, one cache line. */
+
+/*!
+ * \class CVariableStorage
+ * \brief Contiguous storage of the variables of a solver: each field (solution, primitive variables,
+ *        gradients...) of all the points is one flat array, point-major, so the field of the point
+ *        iPoint starts at iPoint*size. The arrays of the CVariable objects become views of these ones,
+ *        and the accessors (GetSolution, GetPrimVar, GetGradient_Primitive...) don't change.
+ * \author Aerospace Design Laboratory (Stanford University).
+ * \version 1.2.0
+ */
+class CVariableStorage {
+private:
+  unsigned long nPoint,               /*!< \brief Number of points. */
+  iPoint;                             /*!< \brief Point being gathered (or released). */
+  bool Release_Fields;                /*!< \brief The views are being given back (instead of gathered). */
+  double *Field[MAX_FIELDS];          /*!< \brief Values of each field, NULL if the variables don't have it. */
+  double **Field_Row[MAX_FIELDS];     /*!< \brief Row pointers of the fields that are matrices (gradients). */
+  unsigned short Field_Size[MAX_FIELDS], /*!< \brief Values of each field per point. */
+  Field_nRow[MAX_FIELDS];             /*!< \brief Rows of each field per point (1 for the vectors). */
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nPoint - Number of points.
+   */
+  CVariableStorage(unsigned long val_nPoint);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CVariableStorage(void);
+  
+  /*!
+   * \brief Move the arrays of all the variables to the flat fields (the per-point arrays are freed).
+   *        All the points must have the same arrays, with the same sizes.
+   * \param[in] node - Variables of the points.
+   */
+  void Gather(CVariable **node);
+  
+  /*!
+   * \brief Detach the views of the variables, so they can be deleted before the storage.
+   * \param[in] node - Variables of the points.
+   */
+  void Release(CVariable **node);
+  
+  /*!
+   * \brief Move a vector of the current point into its field (called from CVariable::SetStorage).
+   * \param[in] val_field - Field (ENUM_VARIABLE_FIELD).
+   * \param[in,out] val_array - Array of the variable, it becomes a view of the field.
+   * \param[in] val_size - Size of the array.
+   */
+  void SetField(unsigned short val_field, double *&val_array, unsigned short val_size);
+  
+  /*!
+   * \overload
+   * \param[in] val_field - Field (ENUM_VARIABLE_FIELD).
+   * \param[in,out] val_array - Matrix of the variable (array of rows), it becomes a view of the field.
+   * \param[in] val_nRow - Rows of the matrix.
+   * \param[in] val_nCol - Columns of the matrix.
+   */
+  void SetField(unsigned short val_field, double **&val_array, unsigned short val_nRow, unsigned short val_nCol);
+  
+  /*!
+   * \brief Set to zero a field in the first points, one flat loop instead of a call per point.
+   * \param[in] val_field - Field (ENUM_VARIABLE_FIELD).
+   * \param[in] val_nPoint - Number of points.
+   */
+  void SetField_Zero(unsigned short val_field, unsigned long val_nPoint);
+  
+  /*!
+   * \brief Copy a field to another one of the same size in the first points (e.g. the old solution).
+   * \param[in] val_source - Field that is copied (ENUM_VARIABLE_FIELD).
+   * \param[in] val_target - Field that is overwritten (ENUM_VARIABLE_FIELD).
+   * \param[in] val_nPoint - Number of points.
+   */
+  void CopyField(unsigned short val_source, unsigned short val_target, unsigned long val_nPoint);
+  
+  /*!
+   * \brief Get the flat array of a field.
+   * \param[in] val_field - Field (ENUM_VARIABLE_FIELD).
+   * \return Values of the field, point-major (NULL if the variables don't have it).
+   */
+  double *GetField(unsigned short val_field);
+  
+  /*!
+   * \brief Get the number of values of a field per point.
+   * \param[in] val_field - Field (ENUM_VARIABLE_FIELD).
+   * \return Values per point (rows times columns for the gradients).
+   */
+  unsigned short GetField_Size(unsigned short val_field);
+  
+  /*!
+   * \brief Get the number of points.
+   * \return Number of points.
+   */
+  unsigned long GetnPoint(void);
+  
+};
+
 #include "variable_structure.inl"
@@ -568,3 +568,9 @@ inline double CTurbSSTVariable::GetF1blending(){ return F1; }
 inline double CTurbSSTVariable::GetF2blending(){ return F2; }
 
 inline double CTurbSSTVariable::GetCrossDiff(){ return CDkw; }
+
+inline double *CVariableStorage::GetField(unsigned short val_field) { return Field[val_field]; }
+
+inline unsigned short CVariableStorage::GetField_Size(unsigned short val_field) { return Field_Size[val_field]; }
+
+inline unsigned long CVariableStorage::GetnPoint(void) { return nPoint; }
@@ -33,9 +33,12 @@
 #include <cstdlib>
 #include <stdio.h>
 
+#include "thread_structure.hpp"
+
 using namespace std;
 
 const double eps = numeric_limits<double>::epsilon(); /*!< \brief machine epsilon */
+const unsigned long VECTOR_ALIGNMENT = 64;  /*!< \brief Alignment (bytes) of the values of the vectors, one cache line. */
 
 /*!
  * \class CSysVector
@@ -177,6 +180,15 @@ public:
    */
   void Equals_AX_Plus_BY(const double & a, CSysVector & x, const double & b, CSysVector & y);
   
+  /*!
+   * \brief adds a linear combination of several CSysVectors to the calling CSysVector,
+   *        in a single pass over the values (u = u + sum_k a[k]*x[k])
+   * \param[in] nVec - number of CSysVectors in the combination (the first nVec of x)
+   * \param[in] a - scalar factors of the CSysVectors
+   * \param[in] x - CSysVectors of the linear combination
+   */
+  void Plus_Multi_AX(unsigned long nVec, const double *a, vector<CSysVector> & x);
+  
   /*!
    * \brief assignment operator with deep copy
    * \param[in] u - CSysVector whose values are being assigned
@@ -333,6 +345,16 @@ public:
    */
   friend double dotProd(const CSysVector & u, const CSysVector & v);
   
+  /*!
+   * \brief dot-products of one CSysVector with several CSysVectors, in a single
+   *        pass over the values (each chunk of u is reused from the cache for all the v)
+   * \param[in] u - CSysVector that multiplies all the others
+   * \param[in] nVec - number of CSysVectors (the first nVec of v)
+   * \param[in] v - CSysVectors of the dot-products
+   * \param[out] prod - the nVec dot-products (u,v[k])
+   */
+  friend void multiDotProd(const CSysVector & u, unsigned long nVec, vector<CSysVector> & v, double *prod);
+  
 };
 
 /*!
@@ -379,7 +401,7 @@ inline CPreconditioner::~CPreconditioner() {}
 
 /*!
  * \class spVec_utils
- * \brief Class to output a vector
+ * \brief Class to output a vector, the values are preceded by the number of rows (binary format).
  */
 class spVec_utils {
 private:
@@ -390,7 +412,27 @@ public:
                  char* filename);
   
   void bsr_write(unsigned short bdim, unsigned long nbrows, double* bvalues, char* filename);
- 
+  
+  /*!
+   * \brief Write the values to a file that is already open (for files with several arrays).
+   * \param[in] fp - Open binary file.
+   * \param[in] bdim - Size of the blocks (1 for csr_write).
+   * \param[in] nbrows - Number of (block) rows.
+   * \param[in] bvalues - Values.
+   */
+  void csr_write(FILE *fp, unsigned long nrows, const double* values);
+  void bsr_write(FILE *fp, unsigned short bdim, unsigned long nbrows, const double* bvalues);
+  
+  /*!
+   * \brief Read the values written by csr_write or bsr_write from an open file.
+   * \param[in] fp - Open binary file.
+   * \param[in] bdim - Size of the blocks (1 for csr_read).
+   * \param[in] nbrows - Expected number of (block) rows, it is checked against the file.
+   * \param[out] bvalues - Values.
+   */
+  void csr_read(FILE *fp, unsigned long nrows, double* values);
+  void bsr_read(FILE *fp, unsigned short bdim, unsigned long nbrows, double* bvalues);
+  
 };
 
 #include "vector_structure.inl"
@@ -0,0 +1,139 @@
+/*!
+ * \file SU2_BENCH.cpp
+ * \brief Benchmark of the linear solvers: a snapshot of the linear system of the flow (written by
+ *        SU2_EDU at the iteration LINEAR_SOLVER_DUMP_ITER) is solved with every Krylov solver
+ *        and preconditioner, so their settings can be tuned without running the whole case.
+ * \author Aerospace Design Laboratory (Stanford University).
+ * \version 1.2.0
+ *
+ * SU2 EDU, Copyright (C) 2014 Aerospace Design Laboratory (Stanford University).
+ *
+ * SU2 EDU is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 EDU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2 EDU. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/SU2_BENCH.hpp"
+
+using namespace std;
+
+static double GetWallTime(void) {
+
+  struct timeval WallTime;
+  gettimeofday(&WallTime, NULL);
+  return double(WallTime.tv_sec) + 1E-6*double(WallTime.tv_usec);
+
+}
+
+int main(int argc, char *argv[]) {
+
+  const unsigned short nSolver = 3, nPrec = 4;
+  const unsigned short Solver[nSolver] = {FGMRES, BCGSTAB, RFGMRES};
+  const unsigned short Prec[nPrec] = {JACOBI, ILU, LU_SGS, LINELET};
+  const string Solver_Name[nSolver] = {"FGMRES", "BCGSTAB", "RFGMRES"};
+  const string Prec_Name[nPrec] = {"JACOBI", "ILU0", "LU_SGS", "LINELET"};
+
+  unsigned short iSolver, iPrec;
+  unsigned long IterLinSol, iRepeat, nRepeat = 5;
+  double StartTime, First_Time, Best_Time, Bytes, Res_Norm;
+  char config_file_name[200];
+  string system_file_name;
+  CConfig *config = NULL;
+  CGeometry *geometry[1] = {NULL};
+
+  /*--- Arguments: the config file (tolerance, iterations, threads... of the linear solvers),
+   the snapshot of the linear system, and the number of timed solutions of each combination ---*/
+
+  if (argc < 3) {
+    cout << "Usage: SU2_BENCH config_file system_file [repetitions]" << endl;
+    exit(1);
+  }
+  strncpy(config_file_name, argv[1], 199); config_file_name[199] = '\0';
+  system_file_name = argv[2];
+  if ((argc > 3) && (atoi(argv[3]) > 0)) nRepeat = atoi(argv[3]);
+
+  config = new CConfig(config_file_name, SU2_EDU, ZONE_0, 1, 2, VERB_NONE);
+  CThreadPool::Initialize(config->GetnThreads());
+
+  cout << endl << "Linear system " << system_file_name << ", " << nRepeat << " timed solution(s) of each combination on "
+  << CThreadPool::GetnThread() << " thread(s)." << endl;
+  cout << "Tolerance " << config->GetLinear_Solver_Error() << ", at most " << config->GetLinear_Solver_Iter() << " iterations";
+  if (config->GetLinear_Solver_Prec_Float()) cout << ", single precision preconditioners";
+  if (config->GetLinear_Solver_Recycle() > 0) cout << ", the repeated FGMRES solutions reuse the recycled vectors";
+  cout << "." << endl << endl;
+
+  cout << setw(9) << "Solver" << setw(9) << "Prec" << setw(7) << "Iter" << setw(12) << "Res/Res0"
+  << setw(12) << "First(s)" << setw(12) << "Best(s)" << setw(12) << "ms/Iter" << setw(9) << "GB/s" << endl;
+
+  for (iPrec = 0; iPrec < nPrec; iPrec++) {
+
+    /*--- The system is read again for each preconditioner, it sets the storage of the preconditioner ---*/
+
+    config->SetKind_Linear_Solver_Prec(Prec[iPrec]);
+
+    CSysMatrix Jacobian;
+    CSysVector LinSysRes;
+    Jacobian.Read_System(LinSysRes, config, system_file_name);
+    CSysVector LinSysSol(LinSysRes), Residual(LinSysRes);
+
+    CSysMatrix *Jacobian_Array[1] = {&Jacobian};
+    CSysVector *LinSysRes_Array[1] = {&LinSysRes}, *LinSysSol_Array[1] = {&LinSysSol};
+
+    for (iSolver = 0; iSolver < nSolver; iSolver++) {
+
+      config->SetKind_Linear_Solver(Solver[iSolver]);
+      CSysSolve System;
+
+      /*--- The first solution builds the preconditioner (and the images of the recycled vectors), the others reuse it ---*/
+
+      LinSysSol = 0.0;
+      StartTime = GetWallTime();
+      IterLinSol = System.Solve(Jacobian_Array, LinSysRes_Array, LinSysSol_Array, geometry, config, MESH_0);
+      First_Time = GetWallTime() - StartTime;
+
+      System.SetNew_Matrix(false);
+      System.SetNew_Operator(false);
+      Best_Time = First_Time;
+      for (iRepeat = 0; iRepeat < nRepeat; iRepeat++) {
+        LinSysSol = 0.0;
+        StartTime = GetWallTime();
+        IterLinSol = System.Solve(Jacobian_Array, LinSysRes_Array, LinSysSol_Array, geometry, config, MESH_0);
+        Best_Time = min(Best_Time, GetWallTime() - StartTime);
+      }
+
+      /*--- Relative residual of the solution, and memory traffic of the products and the preconditioner
+       (one of each per iteration, two for BCGSTAB) over the best time ---*/
+
+      Jacobian.ComputeResidual(LinSysSol, LinSysRes, Residual);
+      Res_Norm = Residual.norm()/max(LinSysRes.norm(), EPS);
+
+      Bytes = double(IterLinSol)*(Solver[iSolver] == BCGSTAB ? 2.0 : 1.0)*
+      double(Jacobian.GetProduct_Bytes() + Jacobian.GetPreconditioner_Bytes(Prec[iPrec]));
+
+      cout << setw(9) << Solver_Name[iSolver] << setw(9) << Prec_Name[iPrec] << setw(7) << IterLinSol
+      << setw(12) << scientific << setprecision(3) << Res_Norm << fixed << setprecision(5)
+      << setw(12) << First_Time << setw(12) << Best_Time
+      << setw(12) << setprecision(3) << 1000.0*Best_Time/double(max(IterLinSol, 1UL))
+      << setw(9) << setprecision(2) << 1E-9*Bytes/max(Best_Time, EPS) << endl;
+
+    }
+
+  }
+
+  /*--- Stop the threads and exit cleanly ---*/
+
+  CThreadPool::Finalize();
+  delete config;
+
+  return EXIT_SUCCESS;
+
+}
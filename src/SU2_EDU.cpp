@@ -29,6 +29,7 @@ int main(int argc, char *argv[]) {
   bool StopCalc = false;
   unsigned long ExtIter = 0;
   double StartTime = 0.0, StopTime = 0.0, UsedTime = 0.0;
+  struct timeval WallTime;
   unsigned short iMesh, iSol, nDim;
   ofstream ConvHist_file;
   
@@ -115,6 +116,12 @@ int main(int argc, char *argv[]) {
   
   config_container->SetNondimensionalization(nDim);
   
+  /*--- Start the pool of shared memory threads used by the linear solvers,
+   the size is given by NUM_THREADS (or the SU2_NUM_THREADS variable). ---*/
+  
+  CThreadPool::Initialize(config_container->GetnThreads());
+  cout << "Shared memory parallelism with " << CThreadPool::GetnThread() << " thread(s)." << endl;
+  
   /*--- Definition of the geometry class. Within this constructor, the
    mesh file is read and the primal grid is stored (node coords, connectivity,
    & boundary markers). MESH_0 is the index of the original (finest) mesh in
@@ -173,10 +180,12 @@ int main(int argc, char *argv[]) {
    The numerics class contains the implementation of the numerical methods for
    evaluating convective or viscous fluxes between any two nodes in the edge-based
    data structure (centered, upwind, galerkin), as well as any source terms
-   (piecewise constant reconstruction) evaluated in each dual mesh volume. ---*/
+   (piecewise constant reconstruction) evaluated in each dual mesh volume.
+   Each thread of the edge loops gets its own copy of the numerics. ---*/
   
   numerics_container = new CNumerics***[config_container->GetMGLevels()+1];
   Numerics_Preprocessing(numerics_container, solver_container, geometry_container, config_container);
+  Numerics_Thread_Preprocessing(numerics_container, solver_container, geometry_container, config_container);
   
   /*--- Surface grid deformation using design variables ---*/
   cout << endl << "------------------------- Surface grid deformation ----------------------" << endl;
@@ -216,7 +225,8 @@ int main(int argc, char *argv[]) {
   
   cout << endl <<"------------------------------ Begin Solver -----------------------------" << endl;
   
-  StartTime = double(clock())/double(CLOCKS_PER_SEC);
+  gettimeofday(&WallTime, NULL);
+  StartTime = double(WallTime.tv_sec) + 1E-6*double(WallTime.tv_usec);
   
   while (ExtIter < config_container->GetnExtIter()) {
     
@@ -235,7 +245,8 @@ int main(int argc, char *argv[]) {
     /*--- Synchronization point after a single solver iteration. Compute the
      wall clock time required. ---*/
     
-    StopTime = double(clock())/double(CLOCKS_PER_SEC);
+    gettimeofday(&WallTime, NULL);
+    StopTime = double(WallTime.tv_sec) + 1E-6*double(WallTime.tv_usec);
     
     UsedTime = (StopTime - StartTime);
     
@@ -276,14 +287,19 @@ int main(int argc, char *argv[]) {
   ConvHist_file.close();
   cout << endl <<"History file, closed." << endl;
   
-  StopTime = double(clock())/double(CLOCKS_PER_SEC);
+  gettimeofday(&WallTime, NULL);
+  StopTime = double(WallTime.tv_sec) + 1E-6*double(WallTime.tv_usec);
   
   /*--- Compute/print the total time for performance benchmarking. ---*/
   
   UsedTime = StopTime-StartTime;
-  cout << "\nCompleted in " << fixed << UsedTime << " seconds on 1 core." << endl;
+  cout << "\nCompleted in " << fixed << UsedTime << " seconds on " << CThreadPool::GetnThread() << " thread(s)." << endl;
+  cout << "Peak memory of the Krylov workspaces: " << double(CSysSolve::GetPeak_Workspace_Memory())/1048576.0 << " MB." << endl;
+  cout << "Index memory saved by the 32-bit indices of the matrices: " << double(CSysMatrix::GetTotal_Index_Memory_Saved())/1048576.0 << " MB." << endl;
+  
+  /*--- Stop the threads and exit the solver cleanly ---*/
   
-  /*--- Exit the solver cleanly ---*/
+  CThreadPool::Finalize();
   
   cout << endl <<"------------------------- Exit Success (SU2_EDU) ------------------------" << endl << endl;
   
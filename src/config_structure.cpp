@@ -95,6 +95,7 @@ void CConfig::SetPointersNull(void){
   Velocity_FreeStream=NULL;
   RefOriginMoment=NULL;     RefOriginMoment_X=NULL;  RefOriginMoment_Y=NULL;
   RefOriginMoment_Z=NULL;   CFLRamp=NULL;            CFL=NULL;
+  Linear_Solver_Forcing_Coeff=NULL;
   PlaneTag=NULL;
   Kappa_Flow=NULL;    Kappa_AdjFlow=NULL;  Kappa_TNE2=NULL;
   Kappa_AdjTNE2=NULL;  Kappa_LinFlow=NULL;
@@ -298,6 +299,11 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("ADAPT_BOUNDARY", AdaptBoundary, true);
   /* DESCRIPTION: Divide rectangles into triangles */
   addBoolOption("DIVIDE_ELEMENTS", Divide_Element, false);
+  /* DESCRIPTION: Renumbering of the points (NONE, RCM, HILBERT, MORTON), the bandwidth, profile and cache misses of
+   the edge loops of each ordering are reported */
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, ORDERING_RCM);
+  /* DESCRIPTION: Renumber the agglomerated multigrid levels in the order of the fine grid (it changes the sweeps of the coarse levels) */
+  addBoolOption("COARSE_POINT_ORDERING", Coarse_Point_Ordering, false);
   
   /* CONFIG_CATEGORY: Time-marching */
   /*--- Options related to time-marching ---*/
@@ -376,6 +382,43 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation of the linear solver for the implicit formulation */
   addDoubleOption("LINEAR_SOLVER_RELAX", Linear_Solver_Relax, 1.0);
+  /* DESCRIPTION: Number of shared memory threads (0 uses the environment variable SU2_NUM_THREADS, or 1 thread) */
+  addUnsignedShortOption("NUM_THREADS", nThreads, 0);
+  /* DESCRIPTION: Schedule of the LU_SGS and ILU0 triangular sweeps (SEQUENTIAL, LEVEL_SETS, MULTICOLOR) */
+  addEnumOption("LINEAR_SOLVER_SWEEP", Kind_Linear_Solver_Sweep, Sweep_Schedule_Map, SWEEP_LEVEL_SETS);
+  /* DESCRIPTION: Store the ILU0, Jacobi and linelet preconditioners in single precision (the Krylov solver stays in double precision) */
+  addBoolOption("LINEAR_SOLVER_PREC_FLOAT", Linear_Solver_Prec_Float, false);
+  /* DESCRIPTION: Jacobian-free Newton-Krylov for the flow (Krylov linear solvers): the matrix-vector products are finite differences
+   of the residual of the finest grid, the assembled Jacobian is only the preconditioner */
+  addBoolOption("JACOBIAN_FREE_NEWTON", Jacobian_Free, false);
+  /* DESCRIPTION: Relative perturbation of the Jacobian-free products, eps = delta.sqrt(1+|U|)/|v| (0 uses the square root of the machine epsilon) */
+  addDoubleOption("JACOBIAN_FREE_PERTURBATION", Jacobian_Free_Perturbation, 0.0);
+  /* DESCRIPTION: Iterations between assemblies of the Jacobian (and factorizations of the preconditioner) of the implicit flow
+   system, in the other iterations only the residual is computed and the lagged Jacobian is reused (1 assembles it in every iteration) */
+  addUnsignedLongOption("JACOBIAN_LAG_ITER", Jacobian_Lag_Iter, 1);
+  /* DESCRIPTION: The lagged Jacobian is assembled again if the flow residual of one iteration is not reduced by this factor */
+  addDoubleOption("JACOBIAN_LAG_STALL", Jacobian_Lag_Stall, 1.0);
+  /* DESCRIPTION: Adaptive tolerance of the linear solvers (inexact Newton), set in each iteration from the reduction of the
+   nonlinear residual with the Eisenstat-Walker forcing terms, LINEAR_SOLVER_ERROR is the minimum tolerance */
+  addBoolOption("LINEAR_SOLVER_FORCING", Linear_Solver_Forcing, false);
+  default_vec_3d[0] = 0.9; default_vec_3d[1] = 2.0; default_vec_3d[2] = 0.1;
+  /* DESCRIPTION: Coefficients of the forcing terms, tol = gamma.(Res/Res_old)^alpha (gamma, alpha, maximum tolerance) */
+  addDoubleArrayOption("LINEAR_SOLVER_FORCING_COEFF", 3, Linear_Solver_Forcing_Coeff, default_vec_3d);
+  /* DESCRIPTION: Orthogonalization of the FGMRES Krylov vectors (MGS, CGS2: classical Gram-Schmidt twice, in fused passes for long restarts) */
+  addEnumOption("LINEAR_SOLVER_ORTHOGONALIZATION", Kind_Linear_Solver_Ortho, Gram_Schmidt_Map, MODIFIED_GRAM_SCHMIDT);
+  /* DESCRIPTION: Number of vectors that FGMRES recycles (deflates) between nonlinear iterations, per solver and grid level: the last
+   correction plus approximate eigenvectors of the smallest eigenvalues (0 disables it, 1 only recycles the last correction) */
+  addUnsignedShortOption("LINEAR_SOLVER_RECYCLE", Linear_Solver_Recycle, 0);
+  /* DESCRIPTION: Smoother of the MULTIGRID preconditioner, one pre- and one post-smoothing on each level (JACOBI, LU_SGS, LINELET, ILU0).
+   LU_SGS in the natural ordering (SEQUENTIAL or LEVEL_SETS sweeps) may amplify the residual, MULTICOLOR sweeps are better smoothers */
+  addEnumOption("LINEAR_SOLVER_SMOOTHER", Kind_Linear_Solver_Smoother, Linear_Solver_Smoother_Map, ILU);
+  /* DESCRIPTION: Coarse operators of the MULTIGRID preconditioner (REDISCRETIZED Jacobians of the coarse grids, or GALERKIN) */
+  addEnumOption("LINEAR_SOLVER_MG_OPERATOR", Kind_Linear_Solver_MG_Operator, MG_Operator_Map, MG_REDISCRETIZED);
+  /* DESCRIPTION: Write the Jacobian, right hand side and linelets of the flow system of this iteration, for the
+   linear solver benchmark SU2_BENCH (-1 never writes them) */
+  addLongOption("LINEAR_SOLVER_DUMP_ITER", Linear_Solver_Dump_Iter, -1);
+  /* DESCRIPTION: File of the snapshot of the linear system of the flow */
+  addStringOption("LINEAR_SOLVER_DUMP_FILENAME", Linear_Solver_Dump_FileName, string("linear_system.dat"));
   /* DESCRIPTION: Roe-Turkel preconditioning for low Mach number flows */
   addBoolOption("ROE_TURKEL_PREC", Low_Mach_Precon, false);
   /* DESCRIPTION: Time Step for dual time stepping simulations (s) */
@@ -538,6 +581,9 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("LIMITER_COEFF", LimiterCoeff, 0.5);
   /* DESCRIPTION: Freeze the value of the limiter after a number of iterations */
   addUnsignedLongOption("LIMITER_ITER", LimiterIter, 999999);
+  /* DESCRIPTION: Find the bounds of the limiter in the pass of the gradients, and store the reconstructed
+   states of each edge (used by the flow and by the turbulence upwind residuals) */
+  addBoolOption("FUSED_RECONSTRUCTION", Fused_Reconstruction, false);
   /* DESCRIPTION: Coefficient for detecting the limit of the sharp edges */
   addDoubleOption("SHARP_EDGES_COEFF", SharpEdgesCoeff, 3.0);
   
@@ -3472,6 +3518,7 @@ CConfig::~CConfig(void)
   if (MG_CorrecSmooth!=NULL    )    delete[] MG_CorrecSmooth;
   if (Section_Location!=NULL)    delete[] Section_Location;
   if (Kappa_Flow!=NULL      )    delete[] Kappa_Flow;
+  if (Linear_Solver_Forcing_Coeff!=NULL)    delete[] Linear_Solver_Forcing_Coeff;
   if (Kappa_AdjFlow!=NULL             )    delete[] Kappa_AdjFlow;
   if (Kappa_TNE2!=NULL   )    delete[] Kappa_TNE2;
   if (Kappa_AdjTNE2!=NULL        )    delete[] Kappa_AdjTNE2;
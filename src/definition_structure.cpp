@@ -176,10 +176,12 @@ void Geometrical_Preprocessing(CGeometry **geometry, CConfig *config) {
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
   
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points (Reverse Cuthill McKee or space-filling curve ordering), the
+   coarse multigrid levels inherit the ordering of the fine grid only with COARSE_POINT_ORDERING= YES
+   (see CMultiGridGeometry::SetCoarse_Ordering) ---*/
   
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  if (rank == MASTER_NODE) cout << "Renumbering points." << endl;
+  geometry[MESH_0]->SetPoint_Ordering(config);
   
   /*--- recompute elements surrounding points, points surrounding points ---*/
   
@@ -251,6 +253,16 @@ void Geometrical_Preprocessing(CGeometry **geometry, CConfig *config) {
     
   }
   
+  /*--- Color the groups of edges of every grid for the threaded edge loops ---*/
+  
+  for (iMGlevel = 0; iMGlevel <= config->GetMGLevels(); iMGlevel++) {
+    geometry[iMGlevel]->SetEdge_Coloring();
+    if (rank == MASTER_NODE)
+      cout << "Edge coloring of grid " << iMGlevel << ": " << geometry[iMGlevel]->GetnEdgeColor() << " colors, "
+      << int(100.0*geometry[iMGlevel]->GetEdgeColor_Efficiency(CThreadPool::GetnThread())+0.5)
+      << "% parallel efficiency on " << CThreadPool::GetnThread() << " thread(s)." << endl;
+  }
+  
   /*--- For unsteady simulations, initialize the grid volumes
    and coordinates for previous solutions. Loop over all zones/grids ---*/
   
@@ -401,7 +413,7 @@ void Numerics_Preprocessing(CNumerics ****numerics_container,
                             CSolver ***solver_container, CGeometry **geometry,
                             CConfig *config) {
   
-  unsigned short iMGlevel, iSol, nDim,
+  unsigned short iMGlevel, iSol, iTerm, nDim,
   
   nVar_Flow             = 0,
   nVar_Turb             = 0;
@@ -463,8 +475,11 @@ void Numerics_Preprocessing(CNumerics ****numerics_container,
   /*--- Definition of the Class for the numerical method: numerics_container[MESH_LEVEL][EQUATION][EQ_TERM] ---*/
   for (iMGlevel = 0; iMGlevel <= config->GetMGLevels(); iMGlevel++) {
     numerics_container[iMGlevel] = new CNumerics** [MAX_SOLS];
-    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+    for (iSol = 0; iSol < MAX_SOLS; iSol++) {
       numerics_container[iMGlevel][iSol] = new CNumerics* [MAX_TERMS];
+      for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+        numerics_container[iMGlevel][iSol][iTerm] = NULL;
+    }
   }
   
   /*--- Solver definition for the Potential, Euler, Navier-Stokes problems ---*/
@@ -673,3 +688,44 @@ void Numerics_Preprocessing(CNumerics ****numerics_container,
   }
   
 }
+
+void Numerics_Thread_Preprocessing(CNumerics ****numerics_container, CSolver ***solver_container, CGeometry **geometry,
+                                   CConfig *config) {
+  
+  unsigned short iThread, iMGlevel, iSol, iTerm, nThread = CThreadPool::GetnThread();
+  CNumerics *****thread_container, **Thread_Numerics;
+  
+  if (nThread == 1) return;
+  
+  /*--- The numerics of the other threads are defined in the same way as the main ones ---*/
+  
+  thread_container = new CNumerics**** [nThread];
+  for (iThread = 1; iThread < nThread; iThread++) {
+    thread_container[iThread] = new CNumerics*** [config->GetMGLevels()+1];
+    Numerics_Preprocessing(thread_container[iThread], solver_container, geometry, config);
+  }
+  
+  /*--- Each main numerics keeps the copies, the solvers get them with GetThread_Numerics ---*/
+  
+  for (iMGlevel = 0; iMGlevel <= config->GetMGLevels(); iMGlevel++)
+    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+        if (numerics_container[iMGlevel][iSol][iTerm] != NULL) {
+          Thread_Numerics = new CNumerics* [nThread];
+          Thread_Numerics[0] = numerics_container[iMGlevel][iSol][iTerm];
+          for (iThread = 1; iThread < nThread; iThread++)
+            Thread_Numerics[iThread] = thread_container[iThread][iMGlevel][iSol][iTerm];
+          numerics_container[iMGlevel][iSol][iTerm]->SetThread_Numerics(nThread, Thread_Numerics);
+        }
+  
+  for (iThread = 1; iThread < nThread; iThread++) {
+    for (iMGlevel = 0; iMGlevel <= config->GetMGLevels(); iMGlevel++) {
+      for (iSol = 0; iSol < MAX_SOLS; iSol++)
+        delete [] thread_container[iThread][iMGlevel][iSol];
+      delete [] thread_container[iThread][iMGlevel];
+    }
+    delete [] thread_container[iThread];
+  }
+  delete [] thread_container;
+  
+}
@@ -183,26 +183,31 @@ bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point)
 }
 
 void CGeometry::SetEdges(void) {
-  unsigned long iPoint, jPoint;
+  unsigned long iPoint, jPoint, iNeighbor;
   long iEdge;
   unsigned short jNode, iNode;
-  long TestEdge = 0;
+  vector<pair<unsigned long, unsigned short> > Neighbor;
+  
+  /*--- The edges are sorted by their first (lowest) point, and then by the second one,
+   so the edge loops stream through the points in the order of the renumbering ---*/
   
   nEdge = 0;
-  for(iPoint = 0; iPoint < nPoint; iPoint++)
+  for(iPoint = 0; iPoint < nPoint; iPoint++) {
+    Neighbor.clear();
     for(iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
       jPoint = node[iPoint]->GetPoint(iNode);
+      if (iPoint < jPoint) Neighbor.push_back(make_pair(jPoint, iNode));
+    }
+    sort(Neighbor.begin(), Neighbor.end());
+    for(iNeighbor = 0; iNeighbor < Neighbor.size(); iNeighbor++) {
+      jPoint = Neighbor[iNeighbor].first; iNode = Neighbor[iNeighbor].second;
       for(jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++)
-        if (node[jPoint]->GetPoint(jNode) == iPoint) {
-          TestEdge = node[jPoint]->GetEdge(jNode);
-          break;
-        }
-      if (TestEdge == -1) {
-        node[iPoint]->SetEdge(nEdge, iNode);
-        node[jPoint]->SetEdge(nEdge, jNode);
-        nEdge++;
-      }
+        if (node[jPoint]->GetPoint(jNode) == iPoint) break;
+      node[iPoint]->SetEdge(nEdge, iNode);
+      node[jPoint]->SetEdge(nEdge, jNode);
+      nEdge++;
     }
+  }
   
   edge = new CEdge*[nEdge];
   
@@ -214,6 +219,311 @@ void CGeometry::SetEdges(void) {
     }
 }
 
+void CGeometry::GetOrdering_Quality(const vector<unsigned long> & Result, unsigned long & Bandwidth, double & Profile, double & Misses) {
+  
+  unsigned long iPoint, iNew, jNew, MinPoint, iEdge, nMiss = 0, nCache = 0, Access[2];
+  unsigned short iNode, iAccess;
+  vector<unsigned long> InvResult(nPoint);
+  vector<pair<unsigned long, unsigned long> > Edges;
+  list<unsigned long> Cache;
+  vector<list<unsigned long>::iterator> Position(nPoint);
+  vector<bool> inCache(nPoint, false);
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    InvResult[(Result.empty() ? iPoint : Result[iPoint])] = iPoint;
+  
+  /*--- Bandwidth and profile of the renumbered adjacency, and edges in the new numbering ---*/
+  
+  Bandwidth = 0; Profile = 0.0;
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    iNew = InvResult[iPoint]; MinPoint = iNew;
+    for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
+      jNew = InvResult[node[iPoint]->GetPoint(iNode)];
+      MinPoint = min(MinPoint, jNew);
+      if (iNew < jNew) {
+        Bandwidth = max(Bandwidth, jNew-iNew);
+        Edges.push_back(make_pair(iNew, jNew));
+      }
+    }
+    Profile += double(iNew-MinPoint);
+  }
+  Profile /= double(max(nPoint, 1UL));
+  
+  /*--- Loop over the edges (numbered as in SetEdges) with a least recently used cache of points ---*/
+  
+  sort(Edges.begin(), Edges.end());
+  
+  for (iEdge = 0; iEdge < Edges.size(); iEdge++) {
+    Access[0] = Edges[iEdge].first; Access[1] = Edges[iEdge].second;
+    for (iAccess = 0; iAccess < 2; iAccess++) {
+      iPoint = Access[iAccess];
+      if (inCache[iPoint]) Cache.erase(Position[iPoint]);
+      else {
+        nMiss++;
+        if (nCache == ORDERING_CACHE_POINTS) { inCache[Cache.back()] = false; Cache.pop_back(); }
+        else nCache++;
+        inCache[iPoint] = true;
+      }
+      Cache.push_front(iPoint);
+      Position[iPoint] = Cache.begin();
+    }
+  }
+  
+  Misses = double(nMiss)/double(max((unsigned long)Edges.size(), 1UL));
+  
+}
+
+void CGeometry::SetEdge_Coloring(void) {
+  
+  unsigned long iEdge, iGroup, iPoint, jPoint, nGroup = (nEdge+EDGE_COLOR_GROUP-1)/EDGE_COLOR_GROUP;
+  unsigned short iColor, nColor = 0;
+  bool Free;
+  vector<unsigned short> Group_Color(nGroup);
+  vector<unsigned long> Position;
+  vector<vector<bool> > Point_Color;
+  
+  /*--- Each group takes the first color in which none of its points has been used yet,
+   the consecutive edges of a group share points, but they are done by the same thread ---*/
+  
+  for (iGroup = 0; iGroup < nGroup; iGroup++) {
+    for (iColor = 0; ; iColor++) {
+      if (iColor == nColor) { Point_Color.push_back(vector<bool>(nPoint, false)); nColor++; }
+      Free = true;
+      for (iEdge = iGroup*EDGE_COLOR_GROUP; (iEdge < min((iGroup+1)*EDGE_COLOR_GROUP, nEdge)) && Free; iEdge++) {
+        iPoint = edge[iEdge]->GetNode(0); jPoint = edge[iEdge]->GetNode(1);
+        Free = (!Point_Color[iColor][iPoint]) && (!Point_Color[iColor][jPoint]);
+      }
+      if (Free) break;
+    }
+    for (iEdge = iGroup*EDGE_COLOR_GROUP; iEdge < min((iGroup+1)*EDGE_COLOR_GROUP, nEdge); iEdge++) {
+      Point_Color[iColor][edge[iEdge]->GetNode(0)] = true;
+      Point_Color[iColor][edge[iEdge]->GetNode(1)] = true;
+    }
+    Group_Color[iGroup] = iColor;
+  }
+  
+  /*--- Sort the groups by color, keeping the order of the edges inside each color ---*/
+  
+  EdgeColor_Begin.assign(nColor+1, 0);
+  for (iGroup = 0; iGroup < nGroup; iGroup++) EdgeColor_Begin[Group_Color[iGroup]+1]++;
+  for (iColor = 0; iColor < nColor; iColor++) EdgeColor_Begin[iColor+1] += EdgeColor_Begin[iColor];
+  
+  EdgeColor_Group.resize(nGroup);
+  Position.assign(EdgeColor_Begin.begin(), EdgeColor_Begin.end()-1);
+  for (iGroup = 0; iGroup < nGroup; iGroup++)
+    EdgeColor_Group[Position[Group_Color[iGroup]]++] = iGroup;
+  
+}
+
+double CGeometry::GetEdgeColor_Efficiency(unsigned short val_nThread) {
+  
+  unsigned long Largest, Begin, End, Work = 0;
+  unsigned short iColor, iThread;
+  
+  /*--- Edges over the time of the slowest thread of each color (all the groups full) ---*/
+  
+  for (iColor = 0; iColor < GetnEdgeColor(); iColor++) {
+    Largest = 0;
+    for (iThread = 0; iThread < val_nThread; iThread++) {
+      CThreadPool::GetChunk(EdgeColor_Begin[iColor+1]-EdgeColor_Begin[iColor], iThread, val_nThread, Begin, End);
+      Largest = max(Largest, End-Begin);
+    }
+    Work += Largest*val_nThread;
+  }
+  
+  return (Work > 0 ? double(EdgeColor_Group.size())/double(Work) : 1.0);
+  
+}
+
+void CGeometry::EdgeColor_Thread(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CEdgeColor_Loop *loop = (CEdgeColor_Loop *)data;
+  CGeometry *geometry = loop->geometry;
+  unsigned long iGroup, Group, Begin, End;
+  unsigned short iColor;
+  
+  for (iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+    
+    CThreadPool::GetChunk(geometry->EdgeColor_Begin[iColor+1]-geometry->EdgeColor_Begin[iColor], iThread, nThread, Begin, End);
+    
+    for (iGroup = geometry->EdgeColor_Begin[iColor]+Begin; iGroup < geometry->EdgeColor_Begin[iColor]+End; iGroup++) {
+      Group = geometry->EdgeColor_Group[iGroup];
+      loop->kernel(loop->data, iThread, Group*EDGE_COLOR_GROUP, min((Group+1)*EDGE_COLOR_GROUP, geometry->nEdge));
+    }
+    
+    /*--- The next color can share points with the groups of the other threads ---*/
+    
+    CThreadPool::Barrier(nThread);
+    
+  }
+  
+}
+
+void CGeometry::Run_EdgeLoop(EdgeKernel kernel, void *data) {
+  
+  CEdgeColor_Loop loop;
+  
+  /*--- Without coloring, the loop is done by the calling thread in the order of the edges ---*/
+  
+  if (EdgeColor_Begin.empty()) { kernel(data, 0, 0, nEdge); return; }
+  
+  loop.geometry = this; loop.kernel = kernel; loop.data = data;
+  CThreadPool::Run(EdgeColor_Thread, &loop, nEdge);
+  
+}
+
+void CGeometry::SetLS_Coeff(void) {
+  
+  unsigned short iDim, jDim, iNeigh;
+  unsigned long iPoint, jPoint;
+  double *Coord_i, *Coord_j, *Coeff, Delta[3], Smatrix[3][3], r11, r12, r13, r22, r23, r23_a, r23_b, r33,
+  weight, z11, z12, z13, z22, z23, z33, detR2;
+  
+  if (!LS_Coeff_Begin.empty()) return;
+  
+  LS_Coeff_Begin.resize(nPoint+1);
+  LS_Coeff_Begin[0] = 0;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    LS_Coeff_Begin[iPoint+1] = LS_Coeff_Begin[iPoint] + node[iPoint]->GetnPoint();
+  LS_Coeff.assign(LS_Coeff_Begin[nPoint]*nDim, 0.0);
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    Coord_i = node[iPoint]->GetCoord();
+    
+    /*--- Entries of the upper triangular matrix R (the same factorization as the former
+     gradient routines of the solvers) ---*/
+    
+    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
+    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
+    
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = node[iPoint]->GetPoint(iNeigh);
+      Coord_j = node[jPoint]->GetCoord();
+      
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+      
+      if (weight != 0.0) {
+        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
+        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
+        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
+        if (nDim == 3) {
+          r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+        }
+      }
+    }
+    
+    if (r11 >= 0.0) r11 = sqrt(r11); else r11 = 0.0;
+    if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
+    if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
+    
+    if (nDim == 3) {
+      if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
+      if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
+      if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
+    }
+    
+    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
+    else detR2 = (r11*r22*r33)*(r11*r22*r33);
+    
+    /*--- S matrix := inv(R)*traspose(inv(R)), the gradient of a singular point is zero ---*/
+    
+    if (fabs(detR2) <= EPS) continue;
+    
+    if (nDim == 2) {
+      Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+      Smatrix[0][1] = -r11*r12/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = r11*r11/detR2;
+    }
+    else {
+      z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
+      z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
+      Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+      Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+      Smatrix[0][2] = (z13*z33)/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+      Smatrix[1][2] = (z23*z33)/detR2;
+      Smatrix[2][0] = Smatrix[0][2];
+      Smatrix[2][1] = Smatrix[1][2];
+      Smatrix[2][2] = (z33*z33)/detR2;
+    }
+    
+    /*--- Coefficient of each neighbour, S*(x_j-x_i)/weight ---*/
+    
+    Coeff = GetLS_Coeff(iPoint);
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = node[iPoint]->GetPoint(iNeigh);
+      Coord_j = node[jPoint]->GetCoord();
+      
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Delta[iDim] = Coord_j[iDim]-Coord_i[iDim];
+        weight += Delta[iDim]*Delta[iDim];
+      }
+      if (weight == 0.0) continue;
+      
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Coeff[iNeigh*nDim+iDim] = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          Coeff[iNeigh*nDim+iDim] += Smatrix[iDim][jDim]*Delta[jDim]/weight;
+      }
+    }
+    
+  }
+  
+}
+
+void CGeometry::SetEdge_Geometry(void) {
+  
+  unsigned short iDim;
+  unsigned long iEdge;
+  double *Coord_i, *Coord_j, *Normal, *Factor, Area, Dist_2, Proj;
+  
+  if (!Edge_Geometry.empty()) return;
+  
+  Edge_Geometry.resize(nEdge*(2*nDim+4));
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    
+    Coord_i = node[edge[iEdge]->GetNode(0)]->GetCoord();
+    Coord_j = node[edge[iEdge]->GetNode(1)]->GetCoord();
+    Normal = edge[iEdge]->GetNormal();
+    Factor = GetEdge_Geometry(iEdge);
+    
+    /*--- Area and unit normal of the face ---*/
+    
+    Area = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Area += Normal[iDim]*Normal[iDim];
+    Area = sqrt(Area);
+    
+    for (iDim = 0; iDim < nDim; iDim++)
+      Factor[iDim] = Normal[iDim]/Area;
+    Factor[nDim] = Area;
+    
+    /*--- Vector going from iPoint to jPoint, its length and the projection of the normal ---*/
+    
+    Dist_2 = 0.0; Proj = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Factor[nDim+1+iDim] = Coord_j[iDim]-Coord_i[iDim];
+      Dist_2 += Factor[nDim+1+iDim]*Factor[nDim+1+iDim];
+      Proj += Factor[nDim+1+iDim]*Normal[iDim];
+    }
+    Factor[2*nDim+1] = sqrt(Dist_2);
+    Factor[2*nDim+2] = (Dist_2 != 0.0 ? 1.0/Dist_2 : 0.0);
+    Factor[2*nDim+3] = (Dist_2 != 0.0 ? Proj/Dist_2 : 0.0);
+    
+  }
+  
+}
+
 void CGeometry::SetFaces(void) {
   //	unsigned long iPoint, jPoint, iFace;
   //	unsigned short jNode, iNode;
@@ -3008,11 +3318,21 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
 }
 
 void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem, iNode, jNode;
-  vector<unsigned long> Queue, AuxQueue, Result;
-  unsigned short Degree, MinDegree, iDim, iMarker;
+  
+  vector<unsigned long> Result;
+  
+  GetRCM_Ordering(Result);
+  SetReordering(config, Result);
+  
+}
+
+void CPhysicalGeometry::GetRCM_Ordering(vector<unsigned long> & Result) {
+  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iNode, jNode;
+  vector<unsigned long> Queue, AuxQueue;
+  unsigned short Degree, MinDegree;
   bool *inQueue;
   
+  Result.clear();
   inQueue = new bool [nPoint];
   
   for(iPoint = 0; iPoint < nPoint; iPoint++)
@@ -3098,6 +3418,12 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
   
+}
+
+void CPhysicalGeometry::SetReordering(CConfig *config, const vector<unsigned long> & Result) {
+  unsigned long iPoint, iElem, iNode;
+  unsigned short iDim, iMarker;
+  
   /*--- Reset old data structures ---*/
   
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -3185,6 +3511,105 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
 
 }
 
+void CPhysicalGeometry::GetSFC_Ordering(unsigned short val_kind, vector<unsigned long> & Result) {
+  
+  const unsigned short nBits = 21;
+  unsigned long iPoint, Index[3], Key, P, Q, t;
+  unsigned short iDim, iBit;
+  double Coord_Min[3], Coord_Max[3], Scale = 0.0;
+  vector<pair<unsigned long, unsigned long> > Keys(nPointDomain);
+  
+  /*--- Bounding box of the domain points, the cells are cubes (same scale in all the directions) ---*/
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Coord_Min[iDim] = 1E300; Coord_Max[iDim] = -1E300;
+  }
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Coord_Min[iDim] = min(Coord_Min[iDim], node[iPoint]->GetCoord(iDim));
+      Coord_Max[iDim] = max(Coord_Max[iDim], node[iPoint]->GetCoord(iDim));
+    }
+  for (iDim = 0; iDim < nDim; iDim++)
+    Scale = max(Scale, Coord_Max[iDim]-Coord_Min[iDim]);
+  if (Scale > 0.0) Scale = double((1UL << nBits)-1)/Scale;
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    for (iDim = 0; iDim < nDim; iDim++)
+      Index[iDim] = (unsigned long)((node[iPoint]->GetCoord(iDim)-Coord_Min[iDim])*Scale);
+    
+    /*--- Hilbert curve, the cell indices are transformed into the transposed Hilbert
+     index (J. Skilling, "Programming the Hilbert curve", 2004) ---*/
+    
+    if (val_kind == ORDERING_HILBERT) {
+      for (Q = 1UL << (nBits-1); Q > 1; Q >>= 1) {
+        P = Q-1;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          if (Index[iDim] & Q) Index[0] ^= P;
+          else { t = (Index[0]^Index[iDim]) & P; Index[0] ^= t; Index[iDim] ^= t; }
+        }
+      }
+      for (iDim = 1; iDim < nDim; iDim++) Index[iDim] ^= Index[iDim-1];
+      t = 0;
+      for (Q = 1UL << (nBits-1); Q > 1; Q >>= 1)
+        if (Index[nDim-1] & Q) t ^= Q-1;
+      for (iDim = 0; iDim < nDim; iDim++) Index[iDim] ^= t;
+    }
+    
+    /*--- Index along the curve, the bits of the directions are interleaved (Morton) ---*/
+    
+    Key = 0;
+    for (iBit = nBits; iBit > 0; iBit--)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Key = (Key << 1) | ((Index[iDim] >> (iBit-1)) & 1UL);
+    
+    Keys[iPoint] = make_pair(Key, iPoint);
+    
+  }
+  
+  sort(Keys.begin(), Keys.end());
+  
+  Result.clear();
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Result.push_back(Keys[iPoint].second);
+  
+  /*--- Add the MPI points ---*/
+  
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    Result.push_back(iPoint);
+  
+}
+
+void CPhysicalGeometry::SetPoint_Ordering(CConfig *config) {
+  
+  unsigned short iKind, Kind_Ordering = config->GetKind_Point_Ordering();
+  unsigned long Bandwidth;
+  double Profile, Misses;
+  vector<unsigned long> Result[4];
+  const string Name[4] = {"NONE", "RCM", "HILBERT", "MORTON"};
+  int rank = MASTER_NODE;
+  
+  /*--- Compute all the orderings, and estimate the locality of the edge loops with each of them ---*/
+  
+  GetRCM_Ordering(Result[ORDERING_RCM]);
+  GetSFC_Ordering(ORDERING_HILBERT, Result[ORDERING_HILBERT]);
+  GetSFC_Ordering(ORDERING_MORTON, Result[ORDERING_MORTON]);
+  
+  if (rank == MASTER_NODE)
+    cout << setw(12) << "Ordering" << setw(12) << "Bandwidth" << setw(12) << "Profile" << setw(14) << "Misses/Edge" << endl;
+  
+  for (iKind = ORDERING_NONE; iKind <= ORDERING_MORTON; iKind++) {
+    GetOrdering_Quality(Result[iKind], Bandwidth, Profile, Misses);
+    if (rank == MASTER_NODE)
+      cout << setw(12) << Name[iKind] << setw(12) << Bandwidth << setw(12) << fixed << setprecision(1) << Profile
+      << setw(14) << setprecision(3) << Misses << (iKind == Kind_Ordering ? "  (selected)" : "") << endl;
+  }
+  cout.unsetf(ios::floatfield); cout << setprecision(6);
+  
+  if (Kind_Ordering != ORDERING_NONE) SetReordering(config, Result[Kind_Ordering]);
+  
+}
+
 
 void CPhysicalGeometry::SetElement_Connectivity(void) {
   unsigned short first_elem_face, second_elem_face, iFace, iNode, jElem;
@@ -3490,7 +3915,8 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
   
   rank = MASTER_NODE;
   
-  /*--- Update values of faces of the edge ---*/
+  /*--- Update values of faces of the edge (the geometric factors of the edges are computed again) ---*/
+  ResetEdge_Geometry();
   if (action != ALLOCATE) {
     for(iEdge = 0; iEdge < nEdge; iEdge++)
       edge[iEdge]->SetZeroValues();
@@ -3959,6 +4385,8 @@ void CPhysicalGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, double v
   }
   
   delete[] Coord;
+  ResetLS_Coeff();
+  ResetEdge_Geometry();
 }
 
 bool CPhysicalGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem,
@@ -5527,6 +5955,10 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
     node[iCoarsePoint]->ResetPoint();
   }
   
+  /*--- Renumber the control volumes following the ordering of the fine grid (optional) ---*/
+  
+  if (config->GetCoarse_Point_Ordering()) SetCoarse_Ordering(fine_grid, config);
+  
   /*--- Console output with the summary of the agglomeration ---*/
   
   Local_nPointCoarse = nPoint;
@@ -5561,6 +5993,49 @@ CMultiGridGeometry::~CMultiGridGeometry(void) {
   
 }
 
+void CMultiGridGeometry::SetCoarse_Ordering(CGeometry *fine_grid, CConfig *config) {
+  
+  unsigned long iPoint, iRange, Point_Begin, Point_End, FirstChild;
+  unsigned short iChildren;
+  vector<pair<unsigned long, unsigned long> > Keys;
+  vector<unsigned long> Result(nPoint);
+  CPoint **AuxNode;
+  
+  if (config->GetKind_Point_Ordering() == ORDERING_NONE) return;
+  
+  /*--- The domain points and the others are sorted separately, by their first child
+   (the control volumes without children, merged with a neighbor, go last) ---*/
+  
+  for (iRange = 0; iRange < 2; iRange++) {
+    Point_Begin = (iRange == 0 ? 0 : nPointDomain);
+    Point_End = (iRange == 0 ? nPointDomain : nPoint);
+    Keys.clear();
+    for (iPoint = Point_Begin; iPoint < Point_End; iPoint++) {
+      FirstChild = fine_grid->GetnPoint();
+      for (iChildren = 0; iChildren < node[iPoint]->GetnChildren_CV(); iChildren++)
+        FirstChild = min(FirstChild, node[iPoint]->GetChildren_CV(iChildren));
+      Keys.push_back(make_pair(FirstChild, iPoint));
+    }
+    sort(Keys.begin(), Keys.end());
+    for (iPoint = Point_Begin; iPoint < Point_End; iPoint++)
+      Result[iPoint] = Keys[iPoint-Point_Begin].second;
+  }
+  
+  /*--- The control volumes are moved, and the parents of the fine ones updated ---*/
+  
+  AuxNode = new CPoint* [nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    AuxNode[iPoint] = node[Result[iPoint]];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    node[iPoint] = AuxNode[iPoint];
+    node[iPoint]->SetGlobalIndex(iPoint);
+    for (iChildren = 0; iChildren < node[iPoint]->GetnChildren_CV(); iChildren++)
+      fine_grid->node[node[iPoint]->GetChildren_CV(iChildren)]->SetParent_CV(iPoint);
+  }
+  delete [] AuxNode;
+  
+}
+
 bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, CGeometry *fine_grid, CConfig *config) {
   
   bool agglomerate_CV = false;
@@ -5916,6 +6391,9 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
   double *Normal, Coarse_Volume, Area, *NormalFace = NULL;
   Normal = new double [nDim];
   
+  /*--- The normals of the edges change, their geometric factors are computed again ---*/
+  ResetEdge_Geometry();
+  
   /*--- Compute the area of the coarse volume ---*/
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
     node[iCoarsePoint]->SetVolume(0.0);
@@ -6034,6 +6512,8 @@ void CMultiGridGeometry::SetCoord(CGeometry *geometry) {
       node[Point_Coarse]->SetCoord(iDim,Coordinates[iDim]);
   }
   delete[] Coordinates;
+  ResetLS_Coeff();
+  ResetEdge_Geometry();
 }
 
 void CMultiGridGeometry::SetRotationalVelocity(CConfig *config) {
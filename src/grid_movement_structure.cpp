@@ -57,6 +57,11 @@ void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config)
       geometry->node[iPoint]->SetCoord(iDim, new_coord);
     }
   
+  /*--- The least squares gradient coefficients and the geometric factors of the edges depend on the coordinates ---*/
+  
+  geometry->ResetLS_Coeff();
+  geometry->ResetEdge_Geometry();
+  
 }
 
 void CVolumetricMovement::UpdateDualGrid(CGeometry *geometry, CConfig *config) {
@@ -89,6 +94,7 @@ void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
 void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo) {
   
 	unsigned long IterLinSol, Smoothing_Iter, iNonlinear_Iter;
+  unsigned short Kind_Linear_Solver_Prec;
   double MinVolume, NumError, Tol_Factor;
   bool Screen_Output;
   
@@ -115,12 +121,16 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   nPoint = geometry->GetnPoint();
   nPointDomain = geometry->GetnPointDomain();
   
-  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver. ---*/
+  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver.
+   The stiffness matrix is always preconditioned with LU_SGS, the preconditioner
+   of the flow solver is restored afterwards. ---*/
   
+  Kind_Linear_Solver_Prec = config->GetKind_Linear_Solver_Prec();
   config->SetKind_Linear_Solver_Prec(LU_SGS);
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
   StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  config->SetKind_Linear_Solver_Prec(Kind_Linear_Solver_Prec);
   
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
@@ -161,6 +171,7 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     CMatrixVectorProduct* mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     CPreconditioner* precond      = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
     CSysSolve *system             = new CSysSolve();
+    system->SetKind_GramSchmidt(config->GetKind_Linear_Solver_Ortho());
     
     /*--- Solve the linear system ---*/
     IterLinSol = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, Screen_Output);
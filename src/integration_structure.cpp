@@ -32,10 +32,15 @@ CIntegration::CIntegration(CConfig *config) {
 	Convergence_OneShot = false;
 	Convergence_FullMG = false;
 	Cauchy_Serie = new double [config->GetCauchy_Elems()+1];
+	JacobianFree = NULL;
+	Jacobian_Age = 0;
+	Jacobian_Mesh = MESH_0;
+	Jacobian_Res_Old = 0.0;
 }
 
 CIntegration::~CIntegration(void) {
 	delete [] Cauchy_Serie;
+	if (JacobianFree != NULL) delete JacobianFree;
 }
 
 void CIntegration::Space_Integration(CGeometry *geometry,
@@ -44,10 +49,24 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                                      CConfig *config, unsigned short iMesh,
                                      unsigned short iRKStep,
                                      unsigned short RunTime_EqSystem) {
-	unsigned short iMarker;
+	unsigned short iMarker, iTerm;
 	unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  bool Implicit_Term[MAX_TERMS];
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  bool lagged = !solver_container[MainSolver]->GetJacobian_Update();
+  
+  /*--- With a lagged Jacobian only the residual is computed, the residual and boundary
+   routines of the solver check its Jacobian_Update, and the numerics (and their copies
+   for the threads) don't compute their Jacobians, they are restored at the end ---*/
+  
+  if (lagged) {
+    for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+      if (numerics[iTerm] != NULL) {
+        Implicit_Term[iTerm] = numerics[iTerm]->GetImplicit();
+        numerics[iTerm]->SetImplicit(false);
+      }
+  }
   
 	/*--- Compute inviscid residuals ---*/
   
@@ -117,6 +136,11 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 				break;
 		}
   
+  if (lagged) {
+    for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+      if (numerics[iTerm] != NULL) numerics[iTerm]->SetImplicit(Implicit_Term[iTerm]);
+  }
+  
 }
 
 void CIntegration::Adjoint_Setup(CGeometry ***geometry, CSolver ****solver_container, CConfig **config,
@@ -185,12 +209,172 @@ void CIntegration::Time_Integration(CGeometry **geometry, CSolver ***solver_cont
       solver_container[iMesh][MainSolver]->ExplicitEuler_Iteration(geometry[iMesh], solver_container[iMesh], config);
       break;
     case (EULER_IMPLICIT):
+      
+      /*--- The base of the Jacobian-free products is the residual that has just been computed ---*/
+      
+      if ((JacobianFree != NULL) && (iMesh == MESH_0)) JacobianFree->SetBase();
       solver_container[iMesh][MainSolver]->ImplicitEuler_Iteration(geometry, solver_container, config, iMesh);
+      if ((JacobianFree != NULL) && (iMesh == MESH_0))
+        solver_container[iMesh][MainSolver]->SetnResidual_Eval(JacobianFree->GetnResidual_Eval());
       break;
   }
   
 }
 
+void CIntegration::SetJacobianFree(CGeometry **geometry, CSolver ***solver_container, CNumerics ****numerics_container,
+                                   CConfig *config, unsigned short RunTime_EqSystem) {
+  
+  unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  
+  /*--- Only the implicit flow system of the finest grid, the products don't include the
+   low Mach number preconditioning of the diagonal (Roe-Turkel scheme) ---*/
+  
+  if ((JacobianFree != NULL) || (!config->GetJacobian_Free()) || (RunTime_EqSystem != RUNTIME_FLOW_SYS) ||
+      (config->GetKind_TimeIntScheme_Flow() != EULER_IMPLICIT) || (config->GetKind_Upwind_Flow() == TURKEL) ||
+      config->Low_Mach_Preconditioning()) return;
+  
+  JacobianFree = new CJacobianFreeProduct(this, geometry[MESH_0], solver_container[MESH_0],
+                                          numerics_container[MESH_0][MainSolver], config, MESH_0, RunTime_EqSystem);
+  solver_container[MESH_0][MainSolver]->System.SetMatrixVectorProduct(JacobianFree);
+  
+}
+
+void CIntegration::SetJacobian_Update(CSolver ***solver_container, CConfig *config, unsigned short RunTime_EqSystem) {
+  
+  unsigned short iMGLevel, MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  unsigned long nLag = config->GetJacobian_Lag_Iter();
+  double Res = solver_container[MESH_0][MainSolver]->GetRes_RMS(0);
+  bool update = true;
+  
+  /*--- Only the implicit flow system can be lagged, and not with the low Mach number
+   preconditioning of the diagonal (Roe-Turkel adds a block that changes with the solution,
+   and that is not removed from a lagged matrix). The Jacobians are
+   assembled in the first iteration, when the finest grid changes (full multigrid),
+   after nLag iterations, if the residual doesn't decrease fast enough, and if
+   diagonal blocks were replaced by the identity (points without time step) ---*/
+  
+  if ((nLag > 1) && (RunTime_EqSystem == RUNTIME_FLOW_SYS) &&
+      (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && (config->GetKind_Upwind_Flow() != TURKEL) &&
+      (!config->Low_Mach_Preconditioning())) {
+    update = ((Jacobian_Age == 0) || (Jacobian_Age >= nLag) || (Jacobian_Mesh != config->GetFinestMesh()) ||
+              ((Jacobian_Res_Old > 0.0) && (Res > config->GetJacobian_Lag_Stall()*Jacobian_Res_Old)));
+    for (iMGLevel = 0; iMGLevel <= config->GetMGLevels(); iMGLevel++)
+      if (solver_container[iMGLevel][MainSolver]->GetJacobian_Identity()) update = true;
+  }
+  
+  if (update) { Jacobian_Age = 1; Jacobian_Mesh = config->GetFinestMesh(); }
+  else Jacobian_Age++;
+  Jacobian_Res_Old = Res;
+  
+  for (iMGLevel = 0; iMGLevel <= config->GetMGLevels(); iMGLevel++)
+    solver_container[iMGLevel][MainSolver]->SetJacobian_Update(update);
+  
+}
+
+CJacobianFreeProduct::CJacobianFreeProduct(CIntegration *val_integration, CGeometry *val_geometry, CSolver **val_solver_container,
+                                           CNumerics **val_numerics, CConfig *val_config, unsigned short val_iMesh,
+                                           unsigned short val_RunTime_EqSystem) {
+  
+  integration = val_integration;
+  geometry = val_geometry;
+  solver_container = val_solver_container;
+  numerics = val_numerics;
+  config = val_config;
+  iMesh = val_iMesh;
+  RunTime_EqSystem = val_RunTime_EqSystem;
+  MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  
+  Perturbation = config->GetJacobian_Free_Perturbation();
+  if (Perturbation <= 0.0) Perturbation = sqrt(numeric_limits<double>::epsilon());
+  Norm_Base = 0.0;
+  
+  CSysVector & LinSysRes = solver_container[MainSolver]->LinSysRes;
+  Solution_Base = new CSysVector(LinSysRes);
+  Residual_Base = new CSysVector(LinSysRes);
+  Residual_Backup = new CSysVector(LinSysRes);
+  nEval = 0;
+  
+}
+
+CJacobianFreeProduct::~CJacobianFreeProduct(void) {
+  
+  delete Solution_Base;
+  delete Residual_Base;
+  delete Residual_Backup;
+  
+}
+
+void CJacobianFreeProduct::SetBase(void) {
+  
+  CSolver *solver = solver_container[MainSolver];
+  unsigned long iPoint;
+  unsigned short iVar, nVar = solver->GetnVar();
+  
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      (*Solution_Base)[iPoint*nVar+iVar] = solver->node[iPoint]->GetSolution(iVar);
+  (*Residual_Base) = solver->LinSysRes;
+  Norm_Base = Solution_Base->norm();
+  nEval = 0;
+  
+}
+
+unsigned long CJacobianFreeProduct::GetnResidual_Eval(void) { return nEval; }
+
+void CJacobianFreeProduct::operator()(const CSysVector & u, CSysVector & v) const {
+  
+  CSolver *solver = solver_container[MainSolver];
+  unsigned long iPoint, index, nPointDomain = geometry->GetnPointDomain();
+  unsigned short iVar, nVar = solver->GetnVar();
+  double eps, Delta_Time, Vol, norm_u = u.norm();
+  bool update = solver->GetJacobian_Update();
+  
+  if (norm_u == 0.0) { v = 0.0; return; }
+  eps = Perturbation*sqrt(1.0 + Norm_Base)/norm_u;
+  
+  /*--- Keep the right hand side of the linear system, LinSysRes is overwritten ---*/
+  
+  (*Residual_Backup) = solver->LinSysRes;
+  
+  /*--- Residual of the perturbed state, R(U+eps.u), without the Jacobians ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++) {
+      index = iPoint*nVar+iVar;
+      solver->node[iPoint]->SetSolution(iVar, (*Solution_Base)[index] + eps*u[index]);
+    }
+  
+  solver->SetJacobian_Update(false);
+  solver->Preprocessing(geometry, solver_container, config, iMesh, NO_RK_ITER, RunTime_EqSystem, false);
+  integration->Space_Integration(geometry, solver_container, numerics, config, iMesh, NO_RK_ITER, RunTime_EqSystem);
+  solver->SetJacobian_Update(update);
+  nEval++;
+  
+  /*--- v = Vol/dt.u + (R(U+eps.u) - R(U))/eps, the rows without time step (see
+   ImplicitEuler_Iteration) are the identity ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Delta_Time = solver->node[iPoint]->GetDelta_Time();
+    Vol = geometry->node[iPoint]->GetVolume();
+    for (iVar = 0; iVar < nVar; iVar++) {
+      index = iPoint*nVar+iVar;
+      if (Delta_Time != 0.0)
+        v[index] = Vol/Delta_Time*u[index] + (solver->LinSysRes[index] - (*Residual_Base)[index])/eps;
+      else
+        v[index] = u[index];
+    }
+  }
+  for (index = nPointDomain*nVar; index < geometry->GetnPoint()*nVar; index++) v[index] = u[index];
+  
+  /*--- Restore the state and the right hand side (not the primitive variables, see the class) ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      solver->node[iPoint]->SetSolution(iVar, (*Solution_Base)[iPoint*nVar+iVar]);
+  solver->LinSysRes = (*Residual_Backup);
+  
+}
+
 void CIntegration::Convergence_Monitoring(CGeometry *geometry, CConfig *config, unsigned long Iteration, double monitor) {
   
   unsigned short iCounter;
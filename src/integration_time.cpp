@@ -73,9 +73,23 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry **geometry,
   
   FinestMesh = config->GetFinestMesh();
   
-  /*--- Perform the Full Approximation Scheme multigrid ---*/
+  /*--- Jacobian-free matrix-vector products of the flow system (set up in the first iteration) ---*/
   
-  if (config->GetKind_Linear_Solver() != MULTIGRID)
+  SetJacobianFree(geometry, solver_container, numerics_container, config, RunTime_EqSystem);
+  
+  /*--- Assemble the Jacobians, or reuse the lagged ones ---*/
+  
+  SetJacobian_Update(solver_container, config, RunTime_EqSystem);
+  
+  /*--- Perform the Full Approximation Scheme multigrid, unless the linear system
+   is solved (or preconditioned) by multigrid with the Jacobians of the coarse
+   grids, which are assembled at every iteration by SingleGrid_Iteration ---*/
+  
+  bool linear_mg = ((config->GetKind_Linear_Solver() == MULTIGRID) ||
+                    ((config->GetKind_Linear_Solver_Prec() == MULTIGRID_PREC) &&
+                     (config->GetKind_Linear_Solver_MG_Operator() == MG_REDISCRETIZED)));
+  
+  if (!linear_mg)
     MultiGrid_Cycle(geometry, solver_container, numerics_container, config,
                     FinestMesh, config->GetMGCycle(), RunTime_EqSystem,
                     Iteration);
@@ -83,6 +97,12 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry **geometry,
     SingleGrid_Iteration(geometry, solver_container, numerics_container, config,
                          RunTime_EqSystem, Iteration);
   
+  /*--- Keep the Jacobians for the next iterations, the preprocessing below must not reset them ---*/
+  
+  if ((RunTime_EqSystem == RUNTIME_FLOW_SYS) && (config->GetJacobian_Lag_Iter() > 1))
+    for (iMGLevel = 0; iMGLevel <= config->GetMGLevels(); iMGLevel++)
+      solver_container[iMGLevel][SolContainer_Position]->SetJacobian_Update(false);
+  
   /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
   
   solver_container[MESH_0][SolContainer_Position]->Preprocessing(geometry[MESH_0],
@@ -127,15 +147,11 @@ void CMultiGridIntegration::SingleGrid_Iteration(CGeometry **geometry, CSolver *
                       config, iMesh, NO_RK_ITER, RunTime_EqSystem);
     
     
-    /*--- Modify matrix diagonal to assure diagonal dominance on the coarse levels ---*/
+    /*--- Modify matrix diagonal to assure diagonal dominance on the coarse levels (a lagged
+     Jacobian is corrected for the change of the time step) ---*/
     
-    if (iMesh != MESH_0) {
-      for (unsigned long iPoint = 0; iPoint < geometry[iMesh]->GetnPointDomain(); iPoint++) {
-        double Vol = geometry[iMesh]->node[iPoint]->GetVolume();
-        double Delta = Vol / solver_container[iMesh][SolContainer_Position]->node[iPoint]->GetDelta_Time();
-        solver_container[iMesh][SolContainer_Position]->Jacobian.AddVal2Diag(iPoint, Delta);
-      }
-    }
+    if (iMesh != MESH_0)
+      solver_container[iMesh][SolContainer_Position]->SetTime_Step_Diagonal(geometry[iMesh]);
     
     /*--- Copy the solution to the coarse level ---*/
 
@@ -22,6 +22,94 @@
 
 #include "../include/linear_solvers_structure.hpp"
 
+unsigned long CSysSolve::Total_Workspace_Memory = 0;
+unsigned long CSysSolve::Peak_Workspace_Memory = 0;
+
+CSysSolve::CSysSolve(void) {
+  
+  Workspace_Memory = 0;
+  Kind_GramSchmidt = MODIFIED_GRAM_SCHMIDT;
+  nRecycle = 0; nRecycle_Set = 0;
+  Recycle_NewMatrix = true;
+  
+  MG_nLevel = 0;
+  MG_Operator = NULL; MG_Galerkin = NULL;
+  MG_Res = NULL; MG_Sol = NULL; MG_Aux = NULL; MG_Cor = NULL;
+  Coarse_Jacobian = true;
+  MatVec_Product = NULL;
+  New_Matrix = true; New_Operator = true; Prec_Built = false;
+  Forcing_Res = 0.0; Forcing_Tol = 0.0;
+  
+}
+
+CSysSolve::~CSysSolve(void) {
+  
+  unsigned short iMGlevel;
+  
+  Total_Workspace_Memory -= Workspace_Memory;
+  
+  for (iMGlevel = 0; iMGlevel < MG_nLevel; iMGlevel++) {
+    if (MG_Galerkin[iMGlevel] != NULL) delete MG_Galerkin[iMGlevel];
+    if (MG_Res[iMGlevel] != NULL) delete MG_Res[iMGlevel];
+    if (MG_Sol[iMGlevel] != NULL) delete MG_Sol[iMGlevel];
+    if (MG_Aux[iMGlevel] != NULL) delete MG_Aux[iMGlevel];
+    if (MG_Cor[iMGlevel] != NULL) delete MG_Cor[iMGlevel];
+  }
+  if (MG_Operator != NULL) {
+    delete [] MG_Operator; delete [] MG_Galerkin;
+    delete [] MG_Res; delete [] MG_Sol; delete [] MG_Aux; delete [] MG_Cor;
+  }
+  
+}
+
+void CSysSolve::SetWorkspace(const CSysVector & x, unsigned long val_nW, unsigned long val_nZ, unsigned long m) {
+  
+  unsigned long iRow;
+  
+  /*--- A system of a different size needs new vectors ---*/
+  
+  if ((W.size() > 0) && (W[0].GetLocSize() != x.GetLocSize())) W.clear();
+  if ((Z.size() > 0) && (Z[0].GetLocSize() != x.GetLocSize())) Z.clear();
+  if ((Rec_U.size() > 0) && (Rec_U[0].GetLocSize() != x.GetLocSize())) {
+    Rec_U.clear(); Rec_C.clear(); Rec_Aux.clear(); nRecycle_Set = 0;
+  }
+  
+  /*--- The workspace only grows, the new vectors are copies of x ---*/
+  
+  if (W.size() < val_nW) W.resize(val_nW, x);
+  if (Z.size() < val_nZ) Z.resize(val_nZ, x);
+  if (H.size() < m+1) H.resize(m+1);
+  for (iRow = 0; iRow < H.size(); iRow++)
+    if (H[iRow].size() < m) H[iRow].resize(m, 0.0);
+  if (g.size() < m+1) { g.resize(m+1, 0.0); sn.resize(m+1, 0.0); cs.resize(m+1, 0.0); }
+  if (y.size() < m) y.resize(m, 0.0);
+  if (proj.size() < m+1) proj.resize(m+1, 0.0);
+  
+  /*--- Recycled vectors of the subspace methods ---*/
+  
+  if ((m > 0) && (nRecycle > 0)) {
+    if (Rec_U.size() < nRecycle) { Rec_U.resize(nRecycle, x); Rec_C.resize(nRecycle, x); Rec_Aux.resize(2*nRecycle, x); }
+    if (Rec_B.size() < nRecycle) Rec_B.resize(nRecycle);
+    for (iRow = 0; iRow < Rec_B.size(); iRow++)
+      if (Rec_B[iRow].size() < m) Rec_B[iRow].resize(m, 0.0);
+    if (Rec_H.size() < m+1) Rec_H.resize(m+1);
+    for (iRow = 0; iRow < Rec_H.size(); iRow++)
+      if (Rec_H[iRow].size() < m) Rec_H[iRow].resize(m, 0.0);
+    if (proj.size() < nRecycle) proj.resize(nRecycle, 0.0);
+    if (Rec_Sol.size() < nRecycle+m) Rec_Sol.resize(nRecycle+m, 0.0);
+  }
+  
+  /*--- Memory accounting ---*/
+  
+  Total_Workspace_Memory -= Workspace_Memory;
+  Workspace_Memory = (W.size()+Z.size()+Rec_U.size()+Rec_C.size()+Rec_Aux.size())*x.GetLocSize()*sizeof(double);
+  Workspace_Memory += (H.size()*(H.size() > 0 ? H[0].size() : 0) + 3*g.size() + y.size() + proj.size())*sizeof(double);
+  Workspace_Memory += (Rec_B.size()*(Rec_B.size() > 0 ? Rec_B[0].size() : 0) + Rec_H.size()*(Rec_H.size() > 0 ? Rec_H[0].size() : 0))*sizeof(double);
+  Total_Workspace_Memory += Workspace_Memory;
+  Peak_Workspace_Memory = max(Peak_Workspace_Memory, Total_Workspace_Memory);
+  
+}
+
 void CSysSolve::ApplyGivens(const double & s, const double & c, double & h1, double & h2) {
   
   double temp = c*h1 + s*h2;
@@ -125,6 +213,229 @@ void CSysSolve::ModGramSchmidt(int i, vector<vector<double> > & Hsbg, vector<CSy
   w[i+1] /= nrm;
 }
 
+void CSysSolve::ClassicalGramSchmidt2(int i, vector<vector<double> > & Hsbg, vector<CSysVector> & w) {
+  
+  int k, iPass;
+  
+  /*--- Check the norm of the vector being orthogonalized ---*/
+  double nrm = dotProd(w[i+1],w[i+1]);
+  if (nrm <= 0.0) {
+    cerr << "CSysSolve::ClassicalGramSchmidt2: dotProd(w[i+1],w[i+1]) < 0.0" << endl;
+    throw(-1);
+  }
+  else if (nrm != nrm) {
+    cerr << "CSysSolve::ClassicalGramSchmidt2: w[i+1] = NaN" << endl;
+    throw(-1);
+  }
+  
+  /*--- Two passes of classical Gram-Schmidt, the second one removes
+   the components left by the round-off of the first one ---*/
+  for (k = 0; k < i+1; k++) Hsbg[k][i] = 0.0;
+  for (iPass = 0; iPass < 2; iPass++) {
+    multiDotProd(w[i+1], i+1, w, &proj[0]);
+    for (k = 0; k < i+1; k++) {
+      Hsbg[k][i] += proj[k];
+      proj[k] = -proj[k];
+    }
+    w[i+1].Plus_Multi_AX(i+1, &proj[0], w);
+  }
+  
+  /*--- Test the resulting vector ---*/
+  nrm = w[i+1].norm();
+  Hsbg[i+1][i] = nrm;
+  if (nrm <= 0.0) {
+    /*--- w[i+1] is a linear combination of the w[0:i] ---*/
+    cerr << "CSysSolve::ClassicalGramSchmidt2: w[i+1] linearly dependent on w[0:i]" << endl;
+    throw(-1);
+  }
+  
+  /*--- Scale the resulting vector ---*/
+  w[i+1] /= nrm;
+}
+
+/*!
+ * \brief Orthonormalize the columns of a small dense matrix (Gram-Schmidt applied twice).
+ * \param[in,out] A - Matrix, on exit its columns are orthonormal.
+ * \param[in] nRow - Number of rows.
+ * \param[in] nCol - Number of columns.
+ * \param[out] R - Upper triangular factor A = Q.R (not computed if it is NULL).
+ * \return <code>FALSE</code> if the columns are (numerically) linearly dependent.
+ */
+static bool Orthonormalize_Columns(vector<vector<double> > & A, int nRow, int nCol, vector<vector<double> > *R) {
+  
+  int iRow, iCol, jCol, iPass;
+  double dot, nrm, nrm_init;
+  
+  for (iCol = 0; iCol < nCol; iCol++) {
+    nrm_init = 0.0;
+    for (iRow = 0; iRow < nRow; iRow++) nrm_init += A[iRow][iCol]*A[iRow][iCol];
+    if (R != NULL) for (jCol = 0; jCol < nCol; jCol++) (*R)[jCol][iCol] = 0.0;
+    for (iPass = 0; iPass < 2; iPass++) {
+      for (jCol = 0; jCol < iCol; jCol++) {
+        dot = 0.0;
+        for (iRow = 0; iRow < nRow; iRow++) dot += A[iRow][jCol]*A[iRow][iCol];
+        for (iRow = 0; iRow < nRow; iRow++) A[iRow][iCol] -= dot*A[iRow][jCol];
+        if (R != NULL) (*R)[jCol][iCol] += dot;
+      }
+    }
+    nrm = 0.0;
+    for (iRow = 0; iRow < nRow; iRow++) nrm += A[iRow][iCol]*A[iRow][iCol];
+    if ((nrm <= 1E-24*nrm_init) || (nrm <= 0.0) || (nrm != nrm)) return false;
+    nrm = sqrt(nrm);
+    for (iRow = 0; iRow < nRow; iRow++) A[iRow][iCol] /= nrm;
+    if (R != NULL) (*R)[iCol][iCol] = nrm;
+  }
+  
+  return true;
+  
+}
+
+void CSysSolve::SetRecycle_Images(CMatrixVectorProduct & mat_vec) {
+  
+  unsigned short iVec, jVec, nVec = 0;
+  int iPass;
+  double nrm, nrm_AU;
+  
+  for (iVec = 0; iVec < nRecycle_Set; iVec++) {
+    
+    /*--- The dropped vectors leave a gap that is filled by the next ones ---*/
+    
+    if (nVec != iVec) Rec_U[nVec] = Rec_U[iVec];
+    mat_vec(Rec_U[nVec], Rec_C[nVec]);
+    nrm_AU = Rec_C[nVec].norm();
+    
+    /*--- Orthogonalize C (twice) and apply the same combination to U, so that C = A.U ---*/
+    
+    if (nVec > 0) {
+      for (iPass = 0; iPass < 2; iPass++) {
+        multiDotProd(Rec_C[nVec], nVec, Rec_C, &proj[0]);
+        for (jVec = 0; jVec < nVec; jVec++) proj[jVec] = -proj[jVec];
+        Rec_C[nVec].Plus_Multi_AX(nVec, &proj[0], Rec_C);
+        Rec_U[nVec].Plus_Multi_AX(nVec, &proj[0], Rec_U);
+      }
+    }
+    
+    nrm = Rec_C[nVec].norm();
+    if ((nrm <= 1E-10*nrm_AU) || (nrm <= 0.0) || (nrm != nrm)) continue;
+    Rec_C[nVec] /= nrm;
+    Rec_U[nVec] /= nrm;
+    nVec++;
+    
+  }
+  
+  nRecycle_Set = nVec;
+  
+}
+
+void CSysSolve::SetRecycle_Subspace(int nKrylov) {
+  
+  int iRow, iCol, jCol, iVec, jVec, iIter;
+  int k0 = nRecycle_Set, nCol = nRecycle_Set + nKrylov, nRow = nCol + 1;
+  int nNew = min(int(nRecycle), nCol), nRitz = nNew-1;
+  const int nIter = 50;
+  double sum;
+  
+  if (nKrylov == 0) return;
+  
+  /*--- G = [I B; 0 H] of the relation A.[U, Z] = [C, W].G ---*/
+  
+  vector<vector<double> > G(nRow, vector<double>(nCol, 0.0)), L(nCol, vector<double>(nCol, 0.0));
+  for (iVec = 0; iVec < k0; iVec++) {
+    G[iVec][iVec] = 1.0;
+    for (jCol = 0; jCol < nKrylov; jCol++) G[iVec][k0+jCol] = Rec_B[iVec][jCol];
+  }
+  for (jCol = 0; jCol < nKrylov; jCol++)
+    for (iRow = 0; iRow <= jCol+1; iRow++) G[k0+iRow][k0+jCol] = Rec_H[iRow][jCol];
+  
+  /*--- Cholesky factorization of G^T.G = L.L^T ---*/
+  
+  for (iCol = 0; iCol < nCol; iCol++) {
+    for (jCol = 0; jCol <= iCol; jCol++) {
+      sum = 0.0;
+      for (iRow = 0; iRow < nRow; iRow++) sum += G[iRow][iCol]*G[iRow][jCol];
+      for (iVec = 0; iVec < jCol; iVec++) sum -= L[iCol][iVec]*L[jCol][iVec];
+      if (iCol == jCol) {
+        if ((sum <= 0.0) || (sum != sum)) return;
+        L[iCol][iCol] = sqrt(sum);
+      }
+      else L[iCol][jCol] = sum/L[jCol][jCol];
+    }
+  }
+  
+  /*--- Block inverse iteration V = (G^T.G)^-1.G(0:n-1,:)^T.V, it converges to the invariant
+   subspace of the smallest harmonic Ritz values (the start is an arbitrary full rank block) ---*/
+  
+  vector<vector<double> > V(nCol, vector<double>(nRitz, 0.0)), X(nCol, vector<double>(nNew, 0.0));
+  for (iRow = 0; iRow < nCol; iRow++)
+    for (iVec = 0; iVec < nRitz; iVec++) V[iRow][iVec] = sin(double((iRow+1)*(iVec+1)));
+  if (!Orthonormalize_Columns(V, nCol, nRitz, NULL)) return;
+  
+  for (iIter = 0; (iIter < nIter) && (nRitz > 0); iIter++) {
+    for (iVec = 0; iVec < nRitz; iVec++) {
+      for (iCol = 0; iCol < nCol; iCol++) {
+        sum = 0.0;
+        for (iRow = 0; iRow < nCol; iRow++) sum += G[iRow][iCol]*V[iRow][iVec];
+        X[iCol][iVec] = sum;
+      }
+      for (iCol = 0; iCol < nCol; iCol++) {
+        for (jCol = 0; jCol < iCol; jCol++) X[iCol][iVec] -= L[iCol][jCol]*X[jCol][iVec];
+        X[iCol][iVec] /= L[iCol][iCol];
+      }
+      for (iCol = nCol-1; iCol >= 0; iCol--) {
+        for (jCol = iCol+1; jCol < nCol; jCol++) X[iCol][iVec] -= L[jCol][iCol]*X[jCol][iVec];
+        X[iCol][iVec] /= L[iCol][iCol];
+      }
+    }
+    if (!Orthonormalize_Columns(X, nCol, nRitz, NULL)) return;
+    for (iRow = 0; iRow < nCol; iRow++)
+      for (iVec = 0; iVec < nRitz; iVec++) V[iRow][iVec] = X[iRow][iVec];
+  }
+  
+  /*--- The recycled space is the last correction of the solution plus the harmonic Ritz vectors ---*/
+  
+  vector<vector<double> > P(nCol, vector<double>(nNew, 0.0));
+  for (iRow = 0; iRow < nCol; iRow++) {
+    P[iRow][0] = Rec_Sol[iRow];
+    for (iVec = 0; iVec < nRitz; iVec++) P[iRow][iVec+1] = V[iRow][iVec];
+  }
+  
+  /*--- New images [C, W].Q with G.P = Q.R, and recycled vectors [U, Z].P.R^-1 ---*/
+  
+  vector<vector<double> > Q(nRow, vector<double>(nNew, 0.0)), R(nNew, vector<double>(nNew, 0.0));
+  for (iRow = 0; iRow < nRow; iRow++)
+    for (iVec = 0; iVec < nNew; iVec++) {
+      sum = 0.0;
+      for (iCol = 0; iCol < nCol; iCol++) sum += G[iRow][iCol]*P[iCol][iVec];
+      Q[iRow][iVec] = sum;
+    }
+  if (!Orthonormalize_Columns(Q, nRow, nNew, &R)) return;
+  
+  for (iCol = 0; iCol < nCol; iCol++)
+    for (iVec = 0; iVec < nNew; iVec++) {
+      sum = P[iCol][iVec];
+      for (jVec = 0; jVec < iVec; jVec++) sum -= X[iCol][jVec]*R[jVec][iVec];
+      X[iCol][iVec] = sum/R[iVec][iVec];
+    }
+  
+  vector<double> coef(nRow, 0.0);
+  for (iVec = 0; iVec < nNew; iVec++) {
+    for (iCol = 0; iCol < nCol; iCol++) coef[iCol] = X[iCol][iVec];
+    Rec_Aux[iVec] = 0.0;
+    if (k0 > 0) Rec_Aux[iVec].Plus_Multi_AX(k0, &coef[0], Rec_U);
+    Rec_Aux[iVec].Plus_Multi_AX(nKrylov, &coef[k0], Z);
+    for (iRow = 0; iRow < nRow; iRow++) coef[iRow] = Q[iRow][iVec];
+    Rec_Aux[nNew+iVec] = 0.0;
+    if (k0 > 0) Rec_Aux[nNew+iVec].Plus_Multi_AX(k0, &coef[0], Rec_C);
+    Rec_Aux[nNew+iVec].Plus_Multi_AX(nKrylov+1, &coef[k0], W);
+  }
+  for (iVec = 0; iVec < nNew; iVec++) {
+    Rec_U[iVec] = Rec_Aux[iVec];
+    Rec_C[iVec] = Rec_Aux[nNew+iVec];
+  }
+  nRecycle_Set = nNew;
+  
+}
+
 void CSysSolve::WriteHeader(const string & solver, const double & restol, const double & resinit) {
   
   cout << "# " << solver << " residual history" << endl;
@@ -255,17 +566,13 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
     exit(1);
   }
   
-  /*---  Define various arrays
-	 Note: elements in w and z are initialized to x to avoid creating
-	 a temporary CSysVector object for the copy constructor ---*/
+  /*---  Krylov vectors, Hessenberg matrix and Givens rotations, they are kept between
+   calls (only g has to start from zero, the rest is written before being read) ---*/
   
-  vector<CSysVector> w(m+1, x);
-  vector<CSysVector> z(m+1, x);
-  vector<double> g(m+1, 0.0);
-  vector<double> sn(m+1, 0.0);
-  vector<double> cs(m+1, 0.0);
-  vector<double> y(m, 0.0);
-  vector<vector<double> > H(m+1, vector<double>(m, 0.0));
+  SetWorkspace(x, m+1, m+1, m);
+  vector<CSysVector> & w = W;
+  vector<CSysVector> & z = Z;
+  for (unsigned long k = 0; k <= m; k++) g[k] = 0.0;
   
   /*---  Calculate the norm of the rhs vector ---*/
   
@@ -279,6 +586,27 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
   
   double beta = w[0].norm();
   
+  /*---  Deflation with the recycled vectors: minimize the residual in span(U),
+   x = x + U.C^T.r and r = r - C.C^T.r (the tolerance is still relative to the
+   undeflated residual) ---*/
+  
+  unsigned short kRec = 0;
+  if (nRecycle > 0) {
+    if (Recycle_NewMatrix) SetRecycle_Images(mat_vec);
+    Recycle_NewMatrix = false;
+    kRec = nRecycle_Set;
+  }
+  if ((kRec > 0) && (beta >= eps)) {
+    multiDotProd(w[0], kRec, Rec_C, &proj[0]);
+    for (unsigned short l = 0; l < kRec; l++) proj[l] = -proj[l];
+    x.Plus_Multi_AX(kRec, &proj[0], Rec_U);
+    w[0].Plus_Multi_AX(kRec, &proj[0], Rec_C);
+    for (unsigned short l = 0; l < kRec; l++) Rec_Sol[l] = proj[l];
+    norm0 = beta;
+    beta = w[0].norm();
+    if (beta < tol*norm0) return 0;
+  }
+  
   if ( (beta < tol*norm0) || (beta < eps) ) {
     
     /*---  System is already solved ---*/
@@ -298,7 +626,7 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
   
   /*--- Set the norm to the initial residual value ---*/
   
-  norm0 = beta;
+  if (kRec == 0) norm0 = beta;
   
   /*---  Output header information including initial residual ---*/
   
@@ -324,9 +652,29 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
     
     mat_vec(z[i], w[i+1]);
     
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Orthogonalize against the images of the recycled vectors (twice), B(:,i) = C^T.A.z[i] ---*/
+    
+    if (kRec > 0) {
+      for (unsigned short l = 0; l < kRec; l++) Rec_B[l][i] = 0.0;
+      for (int iPass = 0; iPass < 2; iPass++) {
+        multiDotProd(w[i+1], kRec, Rec_C, &proj[0]);
+        for (unsigned short l = 0; l < kRec; l++) {
+          Rec_B[l][i] += proj[l];
+          proj[l] = -proj[l];
+        }
+        w[i+1].Plus_Multi_AX(kRec, &proj[0], Rec_C);
+      }
+    }
+    
+    /*---  Gram-Schmidt orthogonalization ---*/
+    
+    if (Kind_GramSchmidt == CLASSICAL_GRAM_SCHMIDT_2) ClassicalGramSchmidt2(i, H, w);
+    else ModGramSchmidt(i, H, w);
+    
+    /*---  Keep the Hessenberg matrix for the update of the recycled vectors ---*/
     
-    ModGramSchmidt(i, H, w);
+    if (nRecycle > 0)
+      for (int k = 0; k <= i+1; k++) Rec_H[k][i] = H[k][i];
     
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix
 		 then generate the new Givens rotation matrix and apply it to
@@ -353,6 +701,21 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
     x.Plus_AX(y[k], z[k]);
   }
   
+  /*---  The recycled part of the correction, x = x - U.B.y, and new recycled vectors ---*/
+  
+  if (kRec > 0) {
+    for (unsigned short l = 0; l < kRec; l++) {
+      proj[l] = 0.0;
+      for (int k = 0; k < i; k++) proj[l] -= Rec_B[l][k]*y[k];
+    }
+    x.Plus_Multi_AX(kRec, &proj[0], Rec_U);
+    for (unsigned short l = 0; l < kRec; l++) Rec_Sol[l] += proj[l];
+  }
+  if (nRecycle > 0) {
+    for (int k = 0; k < i; k++) Rec_Sol[kRec+k] = y[k];
+    SetRecycle_Subspace(i);
+  }
+  
   if ((monitoring) && (rank == 0)) {
     cout << "# FGMRES final (true) residual:" << endl;
     cout << "# Iteration = " << i << ": |res|/|res0| = " << beta/norm0 << endl;
@@ -386,15 +749,18 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
     exit(1);
   }
 	
-  CSysVector r(b);
-  CSysVector r_0(b);
-  CSysVector p(b);
-	CSysVector v(b);
-  CSysVector s(b);
-	CSysVector t(b);
-	CSysVector phat(b);
-	CSysVector shat(b);
-  CSysVector A_x(b);
+  /*--- Work vectors, kept between calls (r, p and v start from b) ---*/
+  
+  SetWorkspace(b, 9, 0, 0);
+  CSysVector & r = W[0]; r = b;
+  CSysVector & r_0 = W[1];
+  CSysVector & p = W[2]; p = b;
+  CSysVector & v = W[3]; v = b;
+  CSysVector & s = W[4];
+  CSysVector & t = W[5];
+  CSysVector & phat = W[6];
+  CSysVector & shat = W[7];
+  CSysVector & A_x = W[8];
   
   /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
 	mat_vec(x,A_x);
@@ -501,15 +867,15 @@ void CSysSolve::MultiGrid_LinSolver(CSysMatrix **Jacobian, CSysVector **LinSysRe
       Jacobian[iMesh]->ComputeLU_SGSPreconditioner(*LinSysRes[iMesh], *LinSysSol[iMesh], geometry[iMesh], config);
       break;
     case JACOBI:
-      Jacobian[iMesh]->BuildJacobiPreconditioner();
+      if (New_Matrix) Jacobian[iMesh]->BuildJacobiPreconditioner();
       Jacobian[iMesh]->ComputeJacobiPreconditioner(*LinSysRes[iMesh], *LinSysSol[iMesh], geometry[iMesh], config);
       break;
     case ILU:
-      Jacobian[iMesh]->BuildILUPreconditioner();
+      if (New_Matrix) Jacobian[iMesh]->BuildILUPreconditioner();
       Jacobian[iMesh]->ComputeILUPreconditioner(*LinSysRes[iMesh], *LinSysSol[iMesh], geometry[iMesh], config);
       break;
     case LINELET:
-      Jacobian[iMesh]->BuildJacobiPreconditioner();
+      if (New_Matrix) Jacobian[iMesh]->BuildJacobiPreconditioner();
       Jacobian[iMesh]->ComputeLineletPreconditioner(*LinSysRes[iMesh], *LinSysSol[iMesh], geometry[iMesh], config);
       break;
   }
@@ -546,37 +912,205 @@ void CSysSolve::MultiGrid_LinSolver(CSysMatrix **Jacobian, CSysVector **LinSysRe
  
 }
 
+void CSysSolve::MultiGrid_Smooth(CSysMatrix *Jac, const CSysVector & b, CSysVector & x, CGeometry *geometry, CConfig *config) {
+  
+  switch (config->GetKind_Linear_Solver_Smoother()) {
+    case LU_SGS:  Jac->ComputeLU_SGSPreconditioner(b, x, geometry, config); break;
+    case JACOBI:  Jac->ComputeJacobiPreconditioner(b, x, geometry, config); break;
+    case ILU:     Jac->ComputeILUPreconditioner(b, x, geometry, config); break;
+    case LINELET: Jac->ComputeLineletPreconditioner(b, x, geometry, config); break;
+  }
+  
+}
+
+void CSysSolve::SetMultiGrid_Preconditioner(CSysMatrix **Jacobian, CSysVector **LinSysRes, CGeometry **geometry, CConfig *config, unsigned short iMesh) {
+  
+  unsigned short iMGlevel, iMarker, iDim, nVar = LinSysRes[iMesh]->GetNVar(), nDim = geometry[iMesh]->GetnDim();
+  unsigned long iVertex, iPoint, nPoint, nPointDomain;
+  bool galerkin = ((config->GetKind_Linear_Solver_MG_Operator() == MG_GALERKIN) || (!Coarse_Jacobian));
+  
+  /*--- Arrays of all the levels, allocated once ---*/
+  
+  if (MG_Operator == NULL) {
+    MG_nLevel = config->GetMGLevels()+1;
+    MG_Operator = new CSysMatrix* [MG_nLevel]; MG_Galerkin = new CSysMatrix* [MG_nLevel];
+    MG_Res = new CSysVector* [MG_nLevel]; MG_Sol = new CSysVector* [MG_nLevel];
+    MG_Aux = new CSysVector* [MG_nLevel]; MG_Cor = new CSysVector* [MG_nLevel];
+    for (iMGlevel = 0; iMGlevel < MG_nLevel; iMGlevel++) {
+      MG_Operator[iMGlevel] = NULL; MG_Galerkin[iMGlevel] = NULL;
+      MG_Res[iMGlevel] = NULL; MG_Sol[iMGlevel] = NULL;
+      MG_Aux[iMGlevel] = NULL; MG_Cor[iMGlevel] = NULL;
+    }
+  }
+  
+  for (iMGlevel = iMesh; iMGlevel < MG_nLevel; iMGlevel++) {
+    
+    nPoint = geometry[iMGlevel]->GetnPoint();
+    nPointDomain = geometry[iMGlevel]->GetnPointDomain();
+    
+    /*--- Vectors of the level (the finest level uses the vectors of the Krylov solver) ---*/
+    
+    if (MG_Aux[iMGlevel] == NULL) {
+      MG_Aux[iMGlevel] = new CSysVector(nPoint, nPointDomain, nVar, 0.0);
+      MG_Cor[iMGlevel] = new CSysVector(nPoint, nPointDomain, nVar, 0.0);
+      if (iMGlevel > iMesh) {
+        MG_Res[iMGlevel] = new CSysVector(nPoint, nPointDomain, nVar, 0.0);
+        MG_Sol[iMGlevel] = new CSysVector(nPoint, nPointDomain, nVar, 0.0);
+      }
+    }
+    
+    /*--- Operator of the level, the Galerkin operators are computed from the previous level ---*/
+    
+    if ((iMGlevel == iMesh) || (!galerkin)) {
+      MG_Operator[iMGlevel] = Jacobian[iMGlevel];
+    }
+    else {
+      if (MG_Galerkin[iMGlevel] == NULL) {
+        MG_Galerkin[iMGlevel] = new CSysMatrix();
+        MG_Galerkin[iMGlevel]->Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry[iMGlevel], config);
+        if (config->GetKind_Linear_Solver_Smoother() == LINELET)
+          MG_Galerkin[iMGlevel]->BuildLineletPreconditioner(geometry[iMGlevel], config);
+      }
+      MG_Galerkin[iMGlevel]->SetGalerkinOperator(*MG_Operator[iMGlevel-1], geometry[iMGlevel-1]);
+      
+      /*--- Same Dirichlet condition as the restriction (only Navier-Stokes) ---*/
+      
+      if (nVar == nDim+2) {
+        for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+          if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
+              (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL)) {
+            for (iVertex = 0; iVertex < geometry[iMGlevel]->nVertex[iMarker]; iVertex++) {
+              iPoint = geometry[iMGlevel]->vertex[iMarker][iVertex]->GetNode();
+              for (iDim = 0; iDim < nDim; iDim++)
+                MG_Galerkin[iMGlevel]->DeleteValsRowi(iPoint*nVar+iDim+1);
+            }
+          }
+        }
+      }
+      
+      MG_Operator[iMGlevel] = MG_Galerkin[iMGlevel];
+    }
+    
+    /*--- Factorization of the smoother ---*/
+    
+    switch (config->GetKind_Linear_Solver_Smoother()) {
+      case JACOBI: case LINELET: MG_Operator[iMGlevel]->BuildJacobiPreconditioner(); break;
+      case ILU: MG_Operator[iMGlevel]->BuildILUPreconditioner(); break;
+    }
+    
+  }
+  
+}
+
+void CSysSolve::MultiGrid_Preconditioner(const CSysVector & b, CSysVector & x, bool zero_guess, CGeometry **geometry, CConfig *config, unsigned short iMesh, unsigned short mu) {
+  
+  unsigned short imu;
+  CSysMatrix *Jac = MG_Operator[iMesh];
+  CSysVector & Aux = *MG_Aux[iMesh];
+  CSysVector & Cor = *MG_Cor[iMesh];
+  
+  /*--- Pre-smoothing, x = S^-1.b if the initial guess is zero, otherwise
+   x = x - S^-1.(A.x - b) ---*/
+  
+  if (zero_guess) {
+    MultiGrid_Smooth(Jac, b, x, geometry[iMesh], config);
+  }
+  else {
+    Jac->MatrixVectorProduct(x, Aux, geometry[iMesh], config);
+    Aux -= b;
+    MultiGrid_Smooth(Jac, Aux, Cor, geometry[iMesh], config);
+    x -= Cor;
+  }
+  
+  if (iMesh < MG_nLevel-1) {
+    
+    /*--- Restrict the residual Aux_h = A_h.x_h - b_h to the coarse grid, the coarse
+     problem A_H.x_H = I^H_h.Aux_h gives minus the correction ---*/
+    
+    Jac->MatrixVectorProduct(x, Aux, geometry[iMesh], config);
+    Aux -= b;
+    SetRestricted_Residual(&Aux, MG_Res[iMesh+1], geometry[iMesh+1], config);
+    
+    /*--- Coarse grid problem, solved by mu+1 cycles ---*/
+    
+    for (imu = 0; imu <= mu; imu++) {
+      if (iMesh == MG_nLevel-3)
+        MultiGrid_Preconditioner(*MG_Res[iMesh+1], *MG_Sol[iMesh+1], (imu == 0), geometry, config, iMesh+1, 0);
+      else MultiGrid_Preconditioner(*MG_Res[iMesh+1], *MG_Sol[iMesh+1], (imu == 0), geometry, config, iMesh+1, mu);
+    }
+    
+    /*--- Prolongate and apply the correction x_h = x_h - I^h_H.x_H ---*/
+    
+    SetProlongated_Solution(&Cor, MG_Sol[iMesh+1], geometry[iMesh+1], config);
+    x.Plus_AX(-config->GetDamp_Correc_Prolong(), Cor);
+    
+    /*--- Post-smoothing ---*/
+    
+    Jac->MatrixVectorProduct(x, Aux, geometry[iMesh], config);
+    Aux -= b;
+    MultiGrid_Smooth(Jac, Aux, Cor, geometry[iMesh], config);
+    x -= Cor;
+    
+  }
+  
+}
+
 unsigned long CSysSolve::Solve(CSysMatrix **Jacobian, CSysVector **LinSysRes, CSysVector **LinSysSol, CGeometry **geometry,
                                CConfig *config, unsigned short iMesh) {
   
   double SolverTol = config->GetLinear_Solver_Error();
   unsigned long MaxIter = config->GetLinear_Solver_Iter();
   unsigned long IterLinSol = 0;
+  
+  SetKind_GramSchmidt(config->GetKind_Linear_Solver_Ortho());
+  
+  /*--- Inexact Newton, the tolerance follows the reduction of the nonlinear residual ---*/
+  
+  if (config->GetLinear_Solver_Forcing())
+    SolverTol = SetForcing_Tolerance(LinSysRes[iMesh]->norm(), config);
+  Forcing_Tol = SolverTol;
+  
+  /*--- With a lagged Jacobian the preconditioner of the previous call is reused ---*/
+  
+  if (!Prec_Built) New_Matrix = true;
+  Prec_Built = true;
+  
+  /*--- The recycled vectors of FGMRES are kept, their images are recomputed if the
+   operator has changed (a lagged Jacobian has new time step terms on its diagonal,
+   and the Jacobian-free products change with the solution) ---*/
+  
+  SetRecycle(config->GetLinear_Solver_Recycle());
+  if (New_Matrix || New_Operator || (MatVec_Product != NULL)) Recycle_NewMatrix = true;
 
   /*--- Solve the linear system using a Krylov subspace method ---*/
   
   if (config->GetKind_Linear_Solver() == BCGSTAB || config->GetKind_Linear_Solver() == FGMRES
       || config->GetKind_Linear_Solver() == RFGMRES) {
     
-    CMatrixVectorProduct* mat_vec = new CSysMatrixVectorProduct(*Jacobian[iMesh], geometry[iMesh], config);
+    CMatrixVectorProduct* mat_vec = MatVec_Product;
+    if (mat_vec == NULL) mat_vec = new CSysMatrixVectorProduct(*Jacobian[iMesh], geometry[iMesh], config);
     
     CPreconditioner* precond = NULL;
     switch (config->GetKind_Linear_Solver_Prec()) {
       case JACOBI:
-        Jacobian[iMesh]->BuildJacobiPreconditioner();
+        if (New_Matrix) Jacobian[iMesh]->BuildJacobiPreconditioner();
         precond = new CJacobiPreconditioner(*Jacobian[iMesh], geometry[iMesh], config);
         break;
       case ILU:
-        Jacobian[iMesh]->BuildILUPreconditioner();
+        if (New_Matrix) Jacobian[iMesh]->BuildILUPreconditioner();
         precond = new CILUPreconditioner(*Jacobian[iMesh], geometry[iMesh], config);
         break;
       case LU_SGS:
         precond = new CLU_SGSPreconditioner(*Jacobian[iMesh], geometry[iMesh], config);
         break;
       case LINELET:
-        Jacobian[iMesh]->BuildJacobiPreconditioner();
+        if (New_Matrix) Jacobian[iMesh]->BuildJacobiPreconditioner();
         precond = new CLineletPreconditioner(*Jacobian[iMesh], geometry[iMesh], config);
         break;
+      case MULTIGRID_PREC:
+        if (New_Matrix) SetMultiGrid_Preconditioner(Jacobian, LinSysRes, geometry, config, iMesh);
+        precond = new CMultiGridPreconditioner(*this, geometry, config, iMesh);
+        break;
     }
     
     switch (config->GetKind_Linear_Solver()) {
@@ -600,7 +1134,7 @@ unsigned long CSysSolve::Solve(CSysMatrix **Jacobian, CSysVector **LinSysRes, CS
     
     /*--- Dealocate memory of the Krylov subspace method ---*/
     
-    delete mat_vec;
+    if (mat_vec != MatVec_Product) delete mat_vec;
     delete precond;
     
   }
@@ -626,15 +1160,15 @@ unsigned long CSysSolve::Solve(CSysMatrix **Jacobian, CSysVector **LinSysRes, CS
         Jacobian[iMesh]->ComputeLU_SGSPreconditioner(*LinSysRes[iMesh], *LinSysSol[iMesh], geometry[iMesh], config);
         break;
       case SMOOTHER_JACOBI:
-        Jacobian[iMesh]->BuildJacobiPreconditioner();
+        if (New_Matrix) Jacobian[iMesh]->BuildJacobiPreconditioner();
         Jacobian[iMesh]->ComputeJacobiPreconditioner(*LinSysRes[iMesh], *LinSysSol[iMesh], geometry[iMesh], config);
         break;
       case SMOOTHER_ILU:
-        Jacobian[iMesh]->BuildILUPreconditioner();
+        if (New_Matrix) Jacobian[iMesh]->BuildILUPreconditioner();
         Jacobian[iMesh]->ComputeILUPreconditioner(*LinSysRes[iMesh], *LinSysSol[iMesh], geometry[iMesh], config);
         break;
       case SMOOTHER_LINELET:
-        Jacobian[iMesh]->BuildJacobiPreconditioner();
+        if (New_Matrix) Jacobian[iMesh]->BuildJacobiPreconditioner();
         Jacobian[iMesh]->ComputeLineletPreconditioner(*LinSysRes[iMesh], *LinSysSol[iMesh], geometry[iMesh], config);
         break;
         IterLinSol = 1;
@@ -645,6 +1179,33 @@ unsigned long CSysSolve::Solve(CSysMatrix **Jacobian, CSysVector **LinSysRes, CS
   
 }
 
+double CSysSolve::SetForcing_Tolerance(double res_norm, CConfig *config) {
+  
+  double Gamma = config->GetLinear_Solver_Forcing_Coeff(0);
+  double Alpha = config->GetLinear_Solver_Forcing_Coeff(1);
+  double Tol_Max = config->GetLinear_Solver_Forcing_Coeff(2);
+  double Tol_Min = min(config->GetLinear_Solver_Error(), Tol_Max);
+  double Tol = Tol_Max, Tol_Safe;
+  
+  if ((Forcing_Res > 0.0) && (Forcing_Tol > 0.0)) {
+    
+    Tol = Gamma*pow(res_norm/Forcing_Res, Alpha);
+    
+    /*--- Safeguard against an oversolving after a single good reduction ---*/
+    
+    Tol_Safe = Gamma*pow(Forcing_Tol, Alpha);
+    if (Tol_Safe > 0.1) Tol = max(Tol, Tol_Safe);
+    
+    Tol = max(min(Tol, Tol_Max), Tol_Min);
+    
+  }
+  
+  Forcing_Res = res_norm;
+  
+  return Tol;
+  
+}
+
 void CSysSolve::SetRestricted_Residual(CSysVector *res_fine, CSysVector *res_coarse, CGeometry *geo_coarse, CConfig *config) {
 
   /*--- Restric the residual to coarse levels ---*/
@@ -675,11 +1236,13 @@ void CSysSolve::SetRestricted_Residual(CSysVector *res_fine, CSysVector *res_coa
     res_coarse->SetBlock(Point_Coarse, Residual);
   }
   
-  /*--- Set the dirichlet boundary condition (only Navier-Stokes) ---*/
+  /*--- Set the dirichlet boundary condition (only Navier-Stokes, the vectors of
+   the turbulence model don't have velocity components) ---*/
   
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             )) {
+    if ((nVar == geo_coarse->GetnDim()+2) &&
+        ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
+         (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ))) {
       for(iVertex = 0; iVertex<geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
         for (iDim = 0; iDim < geo_coarse->GetnDim(); iDim++)
@@ -706,11 +1269,13 @@ void CSysSolve::SetProlongated_Solution(CSysVector *sol_fine, CSysVector *sol_co
     }
   }
   
-  /*--- Set the dirichlet boundary condition (only Navier-Stokes) ---*/
+  /*--- Set the dirichlet boundary condition (only Navier-Stokes, the vectors of
+   the turbulence model don't have velocity components) ---*/
   
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             )) {
+    if ((sol_fine->GetNVar() == geo_coarse->GetnDim()+2) &&
+        ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
+         (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ))) {
       for(iVertex = 0; iVertex<geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
         for (iDim = 0; iDim < geo_coarse->GetnDim(); iDim++)
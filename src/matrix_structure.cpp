@@ -22,46 +22,104 @@
 
 #include "../include/matrix_structure.hpp"
 
+/*--- Triangular sweeps done by CSysMatrix::Sweep ---*/
+
+enum SWEEP_KERNEL {SWEEP_ILU_BUILD, SWEEP_ILU_FORWARD, SWEEP_ILU_BACKWARD, SWEEP_LU_SGS_FORWARD, SWEEP_LU_SGS_BACKWARD};
+
+unsigned long CSysMatrix::Total_Index_Memory_Saved = 0;
+
+/*--- First bytes of the snapshots of the linear systems (Write_System) ---*/
+
+static const char System_Tag[8] = "SU2_SYS";
+
+/*--- The values are aligned to the cache lines and padded to a whole number of them, so
+ the blocks of 4 variables start on a line and the SIMD loads don't straddle two lines ---*/
+
+template<class T>
+static T *SysMatrix_Allocate(unsigned long nElm) {
+  
+  void *ptr = NULL;
+  unsigned long nByte = nElm*sizeof(T);
+  
+  nByte = ((nByte+MATRIX_ALIGNMENT-1)/MATRIX_ALIGNMENT)*MATRIX_ALIGNMENT;
+  if (nByte == 0) nByte = MATRIX_ALIGNMENT;
+  
+  if (posix_memalign(&ptr, MATRIX_ALIGNMENT, nByte) != 0) {
+    cerr << "CSysMatrix: unable to allocate " << nElm << " values." << endl;
+    throw(-1);
+  }
+  return (T *)ptr;
+  
+}
+
 CSysMatrix::CSysMatrix(void) {
   
   /*--- Array initialization ---*/
   
   matrix            = NULL;
+  ILU_matrix        = NULL;
   row_ptr           = NULL;
   col_ind           = NULL;
+  row_ptr_32        = NULL;
+  col_ind_32        = NULL;
+  Index_Memory_Saved = 0;
+  dia_ptr           = NULL;
+  edge_ptr          = NULL;
+  nEdge             = 0;
   block             = NULL;
+  block_weight      = NULL;
+  block_inverse     = NULL;
   prod_block_vector = NULL;
   prod_row_vector   = NULL;
   aux_vector        = NULL;
   sum_vector        = NULL;
   invM              = NULL;
+  ILU_matrix_flt    = NULL;
+  invM_flt          = NULL;
   
   /*--- Linelet preconditioner ---*/
   
   LineletBool     = NULL;
   LineletPoint    = NULL;
-  UBlock          = NULL;
-  invUBlock       = NULL;
-  LBlock          = NULL;
-  yVector         = NULL;
-  zVector         = NULL;
-  rVector         = NULL;
-  LFBlock         = NULL;
-  LyVector        = NULL;
-  FzVector        = NULL;
-  max_nElem       = 0;
+  nLinelet           = 0;
+  nLineletBatch      = 0;
+  LineletBatch_ptr   = NULL;
+  LineletBatch_Point = NULL;
+  Linelet_Factor     = NULL;
+  Linelet_Factor_flt = NULL;
+  max_nElem          = 0;
+  Linelet_Work       = NULL;
+  Linelet_Work_Size  = 0;
+  
+  nVarBlock       = 0;
+  
+  /*--- Schedule of the triangular sweeps ---*/
+  
+  Kind_Sweep      = SWEEP_SEQUENTIAL;
+  nSweepGroup     = 0;
+  sweep_group_ptr = NULL;
+  sweep_row       = NULL;
+  sweep_ptr       = NULL;
+  sweep_mid       = NULL;
+  sweep_ind       = NULL;
+  nSweepCoupling  = 0;
+  nSweepReversed  = 0;
   
 }
 
 CSysMatrix::~CSysMatrix(void) {
   
-  unsigned long iElem;
-  
   /*--- Memory deallocation ---*/
   
-  if (matrix != NULL)             delete [] matrix;
+  Total_Index_Memory_Saved -= Index_Memory_Saved;
+  if (matrix != NULL)             free(matrix);
+  if (ILU_matrix != NULL)         free(ILU_matrix);
   if (row_ptr != NULL)            delete [] row_ptr;
   if (col_ind != NULL)            delete [] col_ind;
+  if (row_ptr_32 != NULL)         delete [] row_ptr_32;
+  if (col_ind_32 != NULL)         delete [] col_ind_32;
+  if (dia_ptr != NULL)            delete [] dia_ptr;
+  if (edge_ptr != NULL)           delete [] edge_ptr;
   if (block != NULL)              delete [] block;
   if (block_weight != NULL)       delete [] block_weight;
   if (block_inverse != NULL)      delete [] block_inverse;
@@ -70,28 +128,21 @@ CSysMatrix::~CSysMatrix(void) {
   if (prod_row_vector != NULL)    delete [] prod_row_vector;
   if (aux_vector != NULL)         delete [] aux_vector;
   if (sum_vector != NULL)         delete [] sum_vector;
-  if (invM != NULL)               delete [] invM;
+  if (invM != NULL)               free(invM);
+  if (ILU_matrix_flt != NULL)     free(ILU_matrix_flt);
+  if (invM_flt != NULL)           free(invM_flt);
   if (LineletBool != NULL)        delete [] LineletBool;
   if (LineletPoint != NULL)       delete [] LineletPoint;
-  
-  for (iElem = 0; iElem < max_nElem; iElem++) {
-    if (UBlock[iElem] != NULL)      delete [] UBlock[iElem];
-    if (invUBlock[iElem] != NULL)   delete [] invUBlock[iElem];
-    if (LBlock[iElem] != NULL)      delete [] LBlock[iElem];
-    if (yVector[iElem] != NULL)     delete [] yVector[iElem];
-    if (zVector[iElem] != NULL)     delete [] zVector[iElem];
-    if (rVector[iElem] != NULL)     delete [] rVector[iElem];
-  }
-  if (UBlock != NULL)     delete [] UBlock;
-  if (invUBlock != NULL)  delete [] invUBlock;
-  if (LBlock != NULL)     delete [] LBlock;
-  if (yVector != NULL)    delete [] yVector;
-  if (zVector != NULL)    delete [] zVector;
-  if (rVector != NULL)    delete [] rVector;
-  
-  if (LFBlock != NULL)    delete [] LFBlock;
-  if (LyVector != NULL)   delete [] LyVector;
-  if (FzVector != NULL)   delete [] FzVector;
+  if (LineletBatch_ptr != NULL)   delete [] LineletBatch_ptr;
+  if (LineletBatch_Point != NULL) delete [] LineletBatch_Point;
+  if (Linelet_Factor != NULL)     free(Linelet_Factor);
+  if (Linelet_Factor_flt != NULL) free(Linelet_Factor_flt);
+  if (Linelet_Work != NULL)       free(Linelet_Work);
+  if (sweep_group_ptr != NULL)    delete [] sweep_group_ptr;
+  if (sweep_row != NULL)          delete [] sweep_row;
+  if (sweep_ptr != NULL)          delete [] sweep_ptr;
+  if (sweep_mid != NULL)          delete [] sweep_mid;
+  if (sweep_ind != NULL)          delete [] sweep_ind;
   
 }
 
@@ -177,6 +228,10 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
   
   SetIndexes(nPoint, nPointDomain, nVar, nEqn, row_ptr, col_ind, nnz, config);
   
+  /*--- Position of the blocks of each edge, for a direct assembly ---*/
+  
+  if (EdgeConnect) SetEdgeMap(geometry);
+  
   /*--- Initialization matrix to zero ---*/
   
   SetValZero();
@@ -187,17 +242,49 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
 
 void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDomain, unsigned short val_nVar, unsigned short val_nEq, unsigned long* val_row_ptr, unsigned long* val_col_ind, unsigned long val_nnz, CConfig *config) {
   
-  unsigned long iVar;
+  unsigned long iVar, iPoint, index;
   
   nPoint = val_nPoint;              // Assign number of points in the mesh
   nPointDomain = val_nPointDomain;  // Assign number of points in the mesh
   nVar = val_nVar;                  // Assign number of vars in each block system
   nEqn = val_nEq;                   // Assign number of eqns in each block system
   nnz = val_nnz;                    // Assign number of possible non zero blocks
-  row_ptr = val_row_ptr;
-  col_ind = val_col_ind;
   
-  matrix            = new double [nnz*nVar*nEqn];	// Reserve memory for the values of the matrix
+  /*--- Block size of the specialized kernels (4 for the 2-D flow equations, 2 for SST
+   and the mesh deformation, 1 for SA), other sizes use the generic kernels ---*/
+  
+  nVarBlock = 0;
+  if ((nVar == nEqn) && ((nVar == 1) || (nVar == 2) || (nVar == 4))) nVarBlock = nVar;
+  
+  /*--- Position of the diagonal block of each row ---*/
+  
+  dia_ptr = new unsigned long [nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (index = val_row_ptr[iPoint]; index < val_row_ptr[iPoint+1]; index++) {
+      if (val_col_ind[index] == iPoint) { dia_ptr[iPoint] = index; break; }
+    }
+  }
+  
+  /*--- If the mesh fits, only 32-bit indices are kept (the wide arrays are released), it
+   halves the index memory and the index traffic of the product and of the sweeps ---*/
+  
+  Index_Memory_Saved = 0;
+  if ((nnz < UINT_MAX) && (nPoint < UINT_MAX)) {
+    row_ptr_32 = new unsigned int [nPoint+1];
+    col_ind_32 = new unsigned int [nnz];
+    for (iPoint = 0; iPoint < nPoint+1; iPoint++) row_ptr_32[iPoint] = (unsigned int)val_row_ptr[iPoint];
+    for (index = 0; index < nnz; index++)         col_ind_32[index] = (unsigned int)val_col_ind[index];
+    delete [] val_row_ptr;
+    delete [] val_col_ind;
+    Index_Memory_Saved = (nPoint+1+nnz)*(sizeof(unsigned long)-sizeof(unsigned int));
+    Total_Index_Memory_Saved += Index_Memory_Saved;
+  }
+  else {
+    row_ptr = val_row_ptr;
+    col_ind = val_col_ind;
+  }
+  
+  matrix            = SysMatrix_Allocate<double>(nnz*nVar*nEqn);	// Reserve memory for the values of the matrix
   block             = new double [nVar*nEqn];
   block_weight      = new double [nVar*nEqn];
   block_inverse     = new double [nVar*nEqn];
@@ -209,7 +296,7 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   
   /*--- Memory initialization ---*/
   
-  for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++)    matrix[iVar] = 0.0;
+  SetValZero();
   for (iVar = 0; iVar < nVar*nEqn; iVar++)        block[iVar] = 0.0;
   for (iVar = 0; iVar < nVar*nEqn; iVar++)        block_weight[iVar] = 0.0;
   for (iVar = 0; iVar < nVar*nEqn; iVar++)        block_inverse[iVar] = 0.0;
@@ -220,20 +307,82 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   for (iVar = 0; iVar < nVar; iVar++)             sum_vector[iVar] = 0.0;
   
   
-  /*--- Set specific preconditioner matrices (ILU) ---*/
-  if ((config->GetKind_Linear_Solver_Prec() == ILU) ||
+  /*--- Set specific preconditioner matrices (ILU), in single precision if requested
+   (the application of the preconditioner is limited by the memory bandwidth) ---*/
+  if ((config->GetKind_Linear_Solver_Prec_Rows() == ILU) ||
       (config->GetKind_Linear_Solver() == SMOOTHER_ILU)) {
-    ILU_matrix = new double [nnz*nVar*nEqn];	// Reserve memory for the ILU matrix
-    for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++)    ILU_matrix[iVar] = 0.0;
+    if (config->GetLinear_Solver_Prec_Float()) {
+      ILU_matrix_flt = SysMatrix_Allocate<float>(nnz*nVar*nEqn);
+      for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++)    ILU_matrix_flt[iVar] = 0.0;
+    }
+    else {
+      ILU_matrix = SysMatrix_Allocate<double>(nnz*nVar*nEqn);	// Reserve memory for the ILU matrix
+      for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++)    ILU_matrix[iVar] = 0.0;
+    }
   }
   
   /*--- Set specific preconditioner matrices (Jacobi and Linelet) ---*/
-  if ((config->GetKind_Linear_Solver_Prec() == JACOBI) ||
-      (config->GetKind_Linear_Solver_Prec() == LINELET) ||
+  if ((config->GetKind_Linear_Solver_Prec_Rows() == JACOBI) ||
+      (config->GetKind_Linear_Solver_Prec_Rows() == LINELET) ||
       (config->GetKind_Linear_Solver() == SMOOTHER_JACOBI) ||
       (config->GetKind_Linear_Solver() == SMOOTHER_LINELET))   {
-    invM = new double [nPoint*nVar*nEqn];	// Reserve memory for the values of the inverse of the preconditioner
-    for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM[iVar] = 0.0;
+    if (config->GetLinear_Solver_Prec_Float()) {
+      invM_flt = SysMatrix_Allocate<float>(nPoint*nVar*nEqn);
+      for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM_flt[iVar] = 0.0;
+    }
+    else {
+      invM = SysMatrix_Allocate<double>(nPoint*nVar*nEqn);	// Reserve memory for the values of the inverse of the preconditioner
+      for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM[iVar] = 0.0;
+    }
+  }
+  
+  /*--- Groups of independent rows of the triangular sweeps (LU-SGS and ILU) ---*/
+  
+  SetSweepSchedule(config->GetKind_Linear_Solver_Sweep());
+  
+}
+
+void CSysMatrix::SetValZero_Thread(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CSysMatrix *A = ((CSysMatrix_Loop *)data)->matrix;
+  unsigned long index, row_begin, row_end;
+  
+  CThreadPool::GetChunk(A->nPoint, iThread, nThread, row_begin, row_end);
+  
+  for (index = A->GetRow_Ptr(row_begin)*A->nVar*A->nEqn; index < A->GetRow_Ptr(row_end)*A->nVar*A->nEqn; index++)
+    A->matrix[index] = 0.0;
+  
+}
+
+void CSysMatrix::SetValZero(void) {
+  
+  /*--- The rows are set by the same threads as in the products (first touch) ---*/
+  
+  CSysMatrix_Loop loop;
+  loop.matrix = this;
+  CThreadPool::Run(SetValZero_Thread, &loop, nPoint*nVar);
+  
+}
+
+void CSysMatrix::SetEdgeMap(CGeometry *geometry) {
+  
+  unsigned long iEdge, iPoint, jPoint, index;
+  
+  nEdge = geometry->GetnEdge();
+  edge_ptr = new unsigned long [4*nEdge];
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iPoint = geometry->edge[iEdge]->GetNode(0);
+    jPoint = geometry->edge[iEdge]->GetNode(1);
+    
+    edge_ptr[4*iEdge  ] = dia_ptr[iPoint];
+    edge_ptr[4*iEdge+3] = dia_ptr[jPoint];
+    
+    for (index = GetRow_Ptr(iPoint); index < GetRow_Ptr(iPoint+1); index++)
+      if (GetCol_Ind(index) == jPoint) { edge_ptr[4*iEdge+1] = index; break; }
+    
+    for (index = GetRow_Ptr(jPoint); index < GetRow_Ptr(jPoint+1); index++)
+      if (GetCol_Ind(index) == iPoint) { edge_ptr[4*iEdge+2] = index; break; }
   }
   
 }
@@ -242,9 +391,11 @@ double *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
   
   unsigned long step = 0, index;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  if (block_i == block_j) return &(matrix[dia_ptr[block_i]*nVar*nEqn]);
+  
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     step++;
-    if (col_ind[index] == block_j) { return &(matrix[(row_ptr[block_i]+step-1)*nVar*nEqn]); }
+    if (GetCol_Ind(index) == block_j) { return &(matrix[(GetRow_Ptr(block_i)+step-1)*nVar*nEqn]); }
   }
   return NULL;
   
@@ -254,24 +405,110 @@ double CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j, unsign
   
   unsigned long step = 0, index;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     step++;
-    if (col_ind[index] == block_j) { return matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar]; }
+    if (GetCol_Ind(index) == block_j) { return matrix[(GetRow_Ptr(block_i)+step-1)*nVar*nEqn+iVar*nEqn+jVar]; }
   }
   return 0;
   
 }
 
+void CSysMatrix::SetSweepSchedule(unsigned short val_kind) {
+  
+  unsigned long iPoint, jPoint, index, iGroup, k, l, key, ind;
+  unsigned long *group, *mark;
+  bool lower;
+  
+  /*--- The level sets only make sense with several threads, the colors change
+   the preconditioner so they are kept regardless of the number of threads ---*/
+  
+  Kind_Sweep = val_kind;
+  if ((Kind_Sweep == SWEEP_LEVEL_SETS) && (CThreadPool::GetnThread() == 1)) Kind_Sweep = SWEEP_SEQUENTIAL;
+  
+  /*--- Group of each row. Level sets: a row depends on its lower neighbors, so
+   its level is one more than theirs. Colors: greedy coloring in natural order,
+   each row gets the smallest color not used by its (already colored) lower neighbors ---*/
+  
+  group = new unsigned long [nPointDomain];
+  mark = new unsigned long [nPointDomain+1];
+  for (iPoint = 0; iPoint < nPointDomain+1; iPoint++) mark[iPoint] = nPointDomain;
+  
+  nSweepGroup = 1;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    group[iPoint] = 0;
+    if (Kind_Sweep == SWEEP_LEVEL_SETS) {
+      for (index = GetRow_Ptr(iPoint); index < dia_ptr[iPoint]; index++)
+        group[iPoint] = max(group[iPoint], group[GetCol_Ind(index)]+1);
+    }
+    if (Kind_Sweep == SWEEP_MULTICOLOR) {
+      for (index = GetRow_Ptr(iPoint); index < dia_ptr[iPoint]; index++)
+        mark[group[GetCol_Ind(index)]] = iPoint;
+      while (mark[group[iPoint]] == iPoint) group[iPoint]++;
+    }
+    nSweepGroup = max(nSweepGroup, group[iPoint]+1);
+  }
+  
+  /*--- Rows sorted by group, the natural ordering is kept inside each group ---*/
+  
+  sweep_group_ptr = new unsigned long [nSweepGroup+1];
+  sweep_row = new unsigned long [nPointDomain];
+  for (iGroup = 0; iGroup < nSweepGroup+1; iGroup++) sweep_group_ptr[iGroup] = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) sweep_group_ptr[group[iPoint]+1]++;
+  for (iGroup = 0; iGroup < nSweepGroup; iGroup++) sweep_group_ptr[iGroup+1] += sweep_group_ptr[iGroup];
+  for (iGroup = 0; iGroup < nSweepGroup; iGroup++) mark[iGroup] = sweep_group_ptr[iGroup];
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) sweep_row[mark[group[iPoint]]++] = iPoint;
+  
+  /*--- Off-diagonal blocks of each row, a neighbor is lower if it is swept before
+   the row (the halo points are always in the upper part). The lower blocks are
+   sorted in sweep order (the columns already are, except with colors) ---*/
+  
+  sweep_ptr = new unsigned long [nPointDomain+1];
+  sweep_mid = new unsigned long [nPointDomain];
+  sweep_ind = new unsigned long [GetRow_Ptr(nPointDomain)-nPointDomain];
+  nSweepCoupling = 0; nSweepReversed = 0;
+  
+  k = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    sweep_ptr[iPoint] = k;
+    for (index = GetRow_Ptr(iPoint); index < GetRow_Ptr(iPoint+1); index++) {
+      jPoint = GetCol_Ind(index);
+      if ((jPoint == iPoint) || (jPoint >= nPointDomain)) continue;
+      lower = ((group[jPoint] < group[iPoint]) || ((group[jPoint] == group[iPoint]) && (jPoint < iPoint)));
+      if (lower) sweep_ind[k++] = index;
+      nSweepCoupling++;
+      if (lower != (jPoint < iPoint)) nSweepReversed++;
+    }
+    for (l = sweep_ptr[iPoint]+1; l < k; l++) {
+      ind = sweep_ind[l]; key = group[GetCol_Ind(ind)];
+      for (index = l; (index > sweep_ptr[iPoint]) && (group[GetCol_Ind(sweep_ind[index-1])] > key); index--)
+        sweep_ind[index] = sweep_ind[index-1];
+      sweep_ind[index] = ind;
+    }
+    sweep_mid[iPoint] = k;
+    for (index = GetRow_Ptr(iPoint); index < GetRow_Ptr(iPoint+1); index++) {
+      jPoint = GetCol_Ind(index);
+      if (jPoint == iPoint) continue;
+      if ((jPoint >= nPointDomain) || (group[jPoint] > group[iPoint]) ||
+          ((group[jPoint] == group[iPoint]) && (jPoint > iPoint))) sweep_ind[k++] = index;
+    }
+  }
+  sweep_ptr[nPointDomain] = k;
+  
+  delete [] group;
+  delete [] mark;
+  
+}
+
 void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, double **val_block) {
   
   unsigned long iVar, jVar, index, step = 0;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     step++;
-    if (col_ind[index] == block_j) {
+    if (GetCol_Ind(index) == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar][jVar];
+          matrix[(GetRow_Ptr(block_i)+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar][jVar];
       break;
     }
   }
@@ -282,12 +519,12 @@ void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, double *
   
   unsigned long iVar, jVar, index, step = 0;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     step++;
-    if (col_ind[index] == block_j) {
+    if (GetCol_Ind(index) == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];
+          matrix[(GetRow_Ptr(block_i)+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];
       break;
     }
   }
@@ -298,12 +535,12 @@ void CSysMatrix::AddBlock(unsigned long block_i, unsigned long block_j, double *
   
   unsigned long iVar, jVar, index, step = 0;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     step++;
-    if (col_ind[index] == block_j) {
+    if (GetCol_Ind(index) == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] += val_block[iVar][jVar];
+          matrix[(GetRow_Ptr(block_i)+step-1)*nVar*nEqn+iVar*nEqn+jVar] += val_block[iVar][jVar];
       break;
     }
   }
@@ -314,12 +551,12 @@ void CSysMatrix::SubtractBlock(unsigned long block_i, unsigned long block_j, dou
   
   unsigned long iVar, jVar, index, step = 0;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     step++;
-    if (col_ind[index] == block_j) {
+    if (GetCol_Ind(index) == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar][jVar];
+          matrix[(GetRow_Ptr(block_i)+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar][jVar];
       break;
     }
   }
@@ -330,9 +567,9 @@ double *CSysMatrix::GetBlock_ILUMatrix(unsigned long block_i, unsigned long bloc
   
   unsigned long step = 0, index;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     step++;
-    if (col_ind[index] == block_j) { return &(ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn]); }
+    if (GetCol_Ind(index) == block_j) { return &(ILU_matrix[(GetRow_Ptr(block_i)+step-1)*nVar*nEqn]); }
   }
   return NULL;
   
@@ -342,12 +579,12 @@ void CSysMatrix::SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j
   
   unsigned long iVar, jVar, index, step = 0;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     step++;
-    if (col_ind[index] == block_j) {
+    if (GetCol_Ind(index) == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];
+          ILU_matrix[(GetRow_Ptr(block_i)+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];
       break;
     }
   }
@@ -358,12 +595,12 @@ void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long bl
   
   unsigned long iVar, jVar, index, step = 0;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     step++;
-    if (col_ind[index] == block_j) {
+    if (GetCol_Ind(index) == block_j) {
       for (iVar = 0; iVar < nVar; iVar++)
         for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar*nVar+jVar];
+          ILU_matrix[(GetRow_Ptr(block_i)+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar*nVar+jVar];
       break;
     }
   }
@@ -400,37 +637,23 @@ void CSysMatrix::MatrixMatrixProduct(double *matrix_a, double *matrix_b, double
 
 void CSysMatrix::AddVal2Diag(unsigned long block_i, double val_matrix) {
   
-  unsigned long step = 0, iVar, index;
+  unsigned long iVar, index = dia_ptr[block_i];
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_i) {	// Only elements on the diagonal
-      for (iVar = 0; iVar < nVar; iVar++)
-        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] += val_matrix;
-      break;
-    }
-  }
+  for (iVar = 0; iVar < nVar; iVar++)
+    matrix[index*nVar*nVar+iVar*nVar+iVar] += val_matrix;
   
 }
 
 void CSysMatrix::SetVal2Diag(unsigned long block_i, double val_matrix) {
   
-  unsigned long step = 0, iVar, jVar, index;
+  unsigned long iVar, jVar, index = dia_ptr[block_i];
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_i) {	// Only elements on the diagonal
-      
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nVar; jVar++)
-        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+jVar] = 0.0;
-      
-      for (iVar = 0; iVar < nVar; iVar++)
-        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] = val_matrix;
-      
-      break;
-    }
-  }
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nVar; jVar++)
+      matrix[index*nVar*nVar+iVar*nVar+jVar] = 0.0;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    matrix[index*nVar*nVar+iVar*nVar+iVar] = val_matrix;
   
 }
 
@@ -440,140 +663,145 @@ void CSysMatrix::DeleteValsRowi(unsigned long i) {
   unsigned long row = i - block_i*nVar;
   unsigned long index, iVar;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = GetRow_Ptr(block_i); index < GetRow_Ptr(block_i+1); index++) {
     for (iVar = 0; iVar < nVar; iVar++)
       matrix[index*nVar*nVar+row*nVar+iVar] = 0.0; // Delete row values in the block
-    if (col_ind[index] == block_i)
+    if (GetCol_Ind(index) == block_i)
       matrix[index*nVar*nVar+row*nVar+row] = 1.0; // Set 1 to the diagonal element
   }
   
 }
 
-void CSysMatrix::Gauss_Elimination(unsigned long block_i, double* rhs) {
-  
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  double weight, aux;
+template<unsigned short nB, class T>
+void CSysMatrix::BlockVectorProduct(const T *a, const double *b, double *c) const {
   
-  double *Block = GetBlock(block_i, block_i);
+  const unsigned long n = (nB != 0 ? nB : nVar);
+  unsigned long iVar, jVar;
   
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
+  for (iVar = 0; iVar < n; iVar++) {
+    c[iVar] = 0.0;
+    for (jVar = 0; jVar < n; jVar++)
+      c[iVar] += a[iVar*n+jVar]*b[jVar];
+  }
   
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
+}
+
+template<unsigned short nB, class Ta, class Tb>
+void CSysMatrix::BlockBlockProduct(const Ta *a, const Tb *b, double *c) const {
   
-  /*--- Gauss elimination ---*/
+  const unsigned long n = (nB != 0 ? nB : nVar);
+  unsigned long iVar, jVar, kVar;
   
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
+  for (iVar = 0; iVar < n; iVar++)
+    for (jVar = 0; jVar < n; jVar++) {
+      c[iVar*n+jVar] = 0.0;
+      for (kVar = 0; kVar < n; kVar++)
+        c[iVar*n+jVar] += a[iVar*n+kVar]*b[kVar*n+jVar];
     }
-  }
   
 }
 
-void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, double* rhs) {
+template<unsigned short nB>
+void CSysMatrix::BlockGaussElimination(const double *Block, double *rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  double weight, aux;
-  
-  double *Block = GetBlock_ILUMatrix(block_i, block_i);
+  const long n = (nB != 0 ? nB : long(nVar));
+  long iVar, jVar, kVar; // Signed, the backward substitution goes down to zero
+  double weight, aux, local_block[nB != 0 ? nB*nB : 1];
   
   /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
+   is modified by the algorithm (the generic size uses the internal block) ---*/
+  
+  double *A = (nB != 0 ? local_block : block);
+  for (iVar = 0; iVar < n*n; iVar++)
+    A[iVar] = Block[iVar];
+  
+  /*--- Transform system in Upper Matrix ---*/
   
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
+  for (iVar = 1; iVar < n; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = A[iVar*n+jVar] / A[jVar*n+jVar];
+      for (kVar = jVar; kVar < n; kVar++)
+        A[iVar*n+kVar] -= weight*A[jVar*n+kVar];
+      rhs[iVar] -= weight*rhs[jVar];
+    }
+  }
+  
+  /*--- Backwards substitution ---*/
   
-  /*--- Gauss elimination ---*/
-  if (nVar == 1) {
-    rhs[0] /= block[0];
+  rhs[n-1] = rhs[n-1] / A[n*n-1];
+  for (iVar = n-2; iVar >= 0; iVar--) {
+    aux = 0.0;
+    for (jVar = iVar+1; jVar < n; jVar++)
+      aux += A[iVar*n+jVar]*rhs[jVar];
+    rhs[iVar] = (rhs[iVar]-aux) / A[iVar*n+iVar];
   }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
+  
+}
+
+template<unsigned short nB, class Tin, class Tout>
+void CSysMatrix::BlockInverse(const Tin *Block, Tout *invBlock, double *scratch) {
+  
+  const long n = (nB != 0 ? nB : long(nVar));
+  long iVar, jVar, kVar, iCol;
+  double weight, aux, local_block[nB != 0 ? nB*nB : 1], local_rhs[nB != 0 ? nB : 1];
+  
+  double *A = (nB != 0 ? local_block : (scratch != NULL ? scratch : block));
+  double *rhs = (nB != 0 ? local_rhs : (scratch != NULL ? &scratch[n*n] : aux_vector));
+  for (iVar = 0; iVar < n*n; iVar++)
+    A[iVar] = Block[iVar];
+  
+  /*--- The elimination is done once, and the weights are stored in the
+   (unused) lower part of A to be applied to each column of the identity ---*/
+  
+  for (iVar = 1; iVar < n; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = A[iVar*n+jVar] / A[jVar*n+jVar];
+      for (kVar = jVar+1; kVar < n; kVar++)
+        A[iVar*n+kVar] -= weight*A[jVar*n+kVar];
+      A[iVar*n+jVar] = weight;
     }
+  }
+  
+  /*--- Compute the i-th column of the inverse matrix ---*/
+  
+  for (iCol = 0; iCol < n; iCol++) {
+    
+    for (iVar = 0; iVar < n; iVar++)
+      rhs[iVar] = 0.0;
+    rhs[iCol] = 1.0;
     
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
+    for (iVar = 1; iVar < n; iVar++)
+      for (jVar = 0; jVar < iVar; jVar++)
+        rhs[iVar] -= A[iVar*n+jVar]*rhs[jVar];
+    
+    rhs[n-1] = rhs[n-1] / A[n*n-1];
+    for (iVar = n-2; iVar >= 0; iVar--) {
       aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
+      for (jVar = iVar+1; jVar < n; jVar++)
+        aux += A[iVar*n+jVar]*rhs[jVar];
+      rhs[iVar] = (rhs[iVar]-aux) / A[iVar*n+iVar];
     }
+    
+    for (iVar = 0; iVar < n; iVar++)
+      invBlock[iVar*n+iCol] = rhs[iVar];
+    
   }
   
 }
 
-void CSysMatrix::Gauss_Elimination(double* Block, double* rhs) {
-  
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  double weight, aux;
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
+void CSysMatrix::Gauss_Elimination(unsigned long block_i, double* rhs) {
   
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
+  Gauss_Elimination(&matrix[dia_ptr[block_i]*nVar*nVar], rhs);
   
+}
+
+void CSysMatrix::Gauss_Elimination(double* Block, double* rhs) {
   
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
+  switch (nVarBlock) {
+    case 1:  BlockGaussElimination<1>(Block, rhs); break;
+    case 2:  BlockGaussElimination<2>(Block, rhs); break;
+    case 4:  BlockGaussElimination<4>(Block, rhs); break;
+    default: BlockGaussElimination<0>(Block, rhs); break;
   }
   
 }
@@ -600,9 +828,9 @@ void CSysMatrix::UpperProduct(CSysVector & vec, unsigned long row_i) {
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
   
-  for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-    if (col_ind[index] > row_i) {
-      ProdBlockVector(row_i, col_ind[index], vec);
+  for (index = GetRow_Ptr(row_i); index < GetRow_Ptr(row_i+1); index++) {
+    if (GetCol_Ind(index) > row_i) {
+      ProdBlockVector(row_i, GetCol_Ind(index), vec);
       for (iVar = 0; iVar < nVar; iVar++)
         prod_row_vector[iVar] += prod_block_vector[iVar];
     }
@@ -617,9 +845,9 @@ void CSysMatrix::LowerProduct(CSysVector & vec, unsigned long row_i) {
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
   
-  for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-    if (col_ind[index] < row_i) {
-      ProdBlockVector(row_i, col_ind[index], vec);
+  for (index = GetRow_Ptr(row_i); index < GetRow_Ptr(row_i+1); index++) {
+    if (GetCol_Ind(index) < row_i) {
+      ProdBlockVector(row_i, GetCol_Ind(index), vec);
       for (iVar = 0; iVar < nVar; iVar++)
         prod_row_vector[iVar] += prod_block_vector[iVar];
     }
@@ -634,9 +862,9 @@ void CSysMatrix::DiagonalProduct(CSysVector & vec, unsigned long row_i) {
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
   
-  for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-    if (col_ind[index] == row_i) {
-      ProdBlockVector(row_i,col_ind[index],vec);
+  for (index = GetRow_Ptr(row_i); index < GetRow_Ptr(row_i+1); index++) {
+    if (GetCol_Ind(index) == row_i) {
+      ProdBlockVector(row_i,GetCol_Ind(index),vec);
       for (iVar = 0; iVar < nVar; iVar++)
         prod_row_vector[iVar] += prod_block_vector[iVar];
     }
@@ -721,8 +949,8 @@ void CSysMatrix::RowProduct(const CSysVector & vec, unsigned long row_i) {
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
   
-  for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-    ProdBlockVector(row_i, col_ind[index], vec);
+  for (index = GetRow_Ptr(row_i); index < GetRow_Ptr(row_i+1); index++) {
+    ProdBlockVector(row_i, GetCol_Ind(index), vec);
     for (iVar = 0; iVar < nVar; iVar++)
       prod_row_vector[iVar] += prod_block_vector[iVar];
   }
@@ -741,9 +969,62 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod)
   
 }
 
-void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+template<unsigned short nB, class I>
+void CSysMatrix::MatrixVectorProduct_Kernel(const I *row, const I *col, const CSysVector & vec, CSysVector & prod,
+                                            unsigned long row_begin, unsigned long row_end) {
+  
+  const unsigned long n = (nB != 0 ? nB : nVar);
+  unsigned long row_i, index, iVar, jVar;
+  const double *Block, *x;
+  double local_sum[nB != 0 ? nB : 1], *sum;
+  
+  for (row_i = row_begin; row_i < row_end; row_i++) {
+    sum = (nB != 0 ? local_sum : &prod[row_i*n]);
+    for (iVar = 0; iVar < n; iVar++)
+      sum[iVar] = 0.0;
+    for (index = row[row_i]; index < row[row_i+1]; index++) {
+      Block = &matrix[index*n*n];     // block[row_i][col_ind[index]]
+      x = &vec[(unsigned long)col[index]*n];     // beginning of block col_ind[index]
+      for (iVar = 0; iVar < n; iVar++)
+        for (jVar = 0; jVar < n; jVar++)
+          sum[iVar] += Block[iVar*n+jVar]*x[jVar];
+    }
+    if (nB != 0) {
+      for (iVar = 0; iVar < n; iVar++)
+        prod[row_i*n+iVar] = sum[iVar];
+    }
+  }
+  
+}
+
+void CSysMatrix::MatrixVectorProduct_Thread(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CSysMatrix_Loop *loop = (CSysMatrix_Loop *)data;
+  CSysMatrix *A = loop->matrix;
+  unsigned long row_begin, row_end;
   
-  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar, row_i;
+  CThreadPool::GetChunk(A->nPointDomain, iThread, nThread, row_begin, row_end);
+  
+  if (A->col_ind_32 != NULL) {
+    switch (A->nVarBlock) {
+      case 1:  A->MatrixVectorProduct_Kernel<1>(A->row_ptr_32, A->col_ind_32, *loop->vec, *loop->prod, row_begin, row_end); break;
+      case 2:  A->MatrixVectorProduct_Kernel<2>(A->row_ptr_32, A->col_ind_32, *loop->vec, *loop->prod, row_begin, row_end); break;
+      case 4:  A->MatrixVectorProduct_Kernel<4>(A->row_ptr_32, A->col_ind_32, *loop->vec, *loop->prod, row_begin, row_end); break;
+      default: A->MatrixVectorProduct_Kernel<0>(A->row_ptr_32, A->col_ind_32, *loop->vec, *loop->prod, row_begin, row_end); break;
+    }
+  }
+  else {
+    switch (A->nVarBlock) {
+      case 1:  A->MatrixVectorProduct_Kernel<1>(A->row_ptr, A->col_ind, *loop->vec, *loop->prod, row_begin, row_end); break;
+      case 2:  A->MatrixVectorProduct_Kernel<2>(A->row_ptr, A->col_ind, *loop->vec, *loop->prod, row_begin, row_end); break;
+      case 4:  A->MatrixVectorProduct_Kernel<4>(A->row_ptr, A->col_ind, *loop->vec, *loop->prod, row_begin, row_end); break;
+      default: A->MatrixVectorProduct_Kernel<0>(A->row_ptr, A->col_ind, *loop->vec, *loop->prod, row_begin, row_end); break;
+    }
+  }
+  
+}
+
+void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
   /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
@@ -757,19 +1038,16 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod,
     throw(-1);
   }
   
-  prod = 0.0; // set all entries of prod to zero
-  for (row_i = 0; row_i < nPointDomain; row_i++) {
-    prod_begin = row_i*nVar; // offset to beginning of block row_i
-    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-      vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
-      mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++) {
-          prod[(const unsigned int)(prod_begin+iVar)] += matrix[(const unsigned int)(mat_begin+iVar*nVar+jVar)]*vec[(const unsigned int)(vec_begin+jVar)];
-        }
-      }
-    }
-  }
+  /*--- Each thread computes a static chunk of rows ---*/
+  
+  CSysMatrix_Loop loop;
+  loop.matrix = this; loop.vec = &vec; loop.prod = &prod;
+  CThreadPool::Run(MatrixVectorProduct_Thread, &loop, nPointDomain*nVar);
+  
+  /*--- The halo points are set by the MPI communication ---*/
+  
+  for (unsigned long iVar = nPointDomain*nVar; iVar < nPoint*nVar; iVar++)
+    prod[iVar] = 0.0;
   
   /*--- MPI Parallelization ---*/
   SendReceive_Solution(prod, geometry, config);
@@ -822,99 +1100,297 @@ void CSysMatrix::GetSubsVector(double *c, double *a, double *b) {
 
 void CSysMatrix::InverseBlock(double *Block, double *invBlock) {
   
-  unsigned long iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    Gauss_Elimination(Block, aux_vector);
-    
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
+  switch (nVarBlock) {
+    case 1:  BlockInverse<1>(Block, invBlock); break;
+    case 2:  BlockInverse<2>(Block, invBlock); break;
+    case 4:  BlockInverse<4>(Block, invBlock); break;
+    default: BlockInverse<0>(Block, invBlock); break;
   }
   
 }
 
 void CSysMatrix::InverseDiagonalBlock(unsigned long block_i, double *invBlock) {
   
-  unsigned long iVar, jVar;
+  InverseBlock(&matrix[dia_ptr[block_i]*nVar*nVar], invBlock);
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
+}
+
+template<unsigned short nB>
+void CSysMatrix::BlockInverse_Batch(const double *Block, double *invBlock) const {
+  
+  const unsigned short L = JACOBI_LANES;
+  unsigned short iLane;
+  
+  const double *a = Block;
+  double *b = invBlock;
+  
+  if (nB == 1) {
+    for (iLane = 0; iLane < L; iLane++)
+      b[iLane] = 1.0/a[iLane];
+  }
+  
+  if (nB == 2) {
+    for (iLane = 0; iLane < L; iLane++) {
+      double invdet = 1.0/(a[iLane]*a[3*L+iLane] - a[L+iLane]*a[2*L+iLane]);
+      b[iLane]     =  a[3*L+iLane]*invdet;
+      b[L+iLane]   = -a[L+iLane]*invdet;
+      b[2*L+iLane] = -a[2*L+iLane]*invdet;
+      b[3*L+iLane] =  a[iLane]*invdet;
+    }
+  }
+  
+  if (nB == 4) {
     
-    /*--- Compute the i-th column of the inverse matrix ---*/
+    /*--- The 2x2 minors of the first two rows (s) and of the last two rows (c) give the
+     determinant and all the cofactors (Laplace expansion by complementary minors) ---*/
+    
+    for (iLane = 0; iLane < L; iLane++) {
+      
+      double a00 = a[ 0*L+iLane], a01 = a[ 1*L+iLane], a02 = a[ 2*L+iLane], a03 = a[ 3*L+iLane];
+      double a10 = a[ 4*L+iLane], a11 = a[ 5*L+iLane], a12 = a[ 6*L+iLane], a13 = a[ 7*L+iLane];
+      double a20 = a[ 8*L+iLane], a21 = a[ 9*L+iLane], a22 = a[10*L+iLane], a23 = a[11*L+iLane];
+      double a30 = a[12*L+iLane], a31 = a[13*L+iLane], a32 = a[14*L+iLane], a33 = a[15*L+iLane];
+      
+      double s0 = a00*a11 - a10*a01, s1 = a00*a12 - a10*a02, s2 = a00*a13 - a10*a03;
+      double s3 = a01*a12 - a11*a02, s4 = a01*a13 - a11*a03, s5 = a02*a13 - a12*a03;
+      double c0 = a20*a31 - a30*a21, c1 = a20*a32 - a30*a22, c2 = a20*a33 - a30*a23;
+      double c3 = a21*a32 - a31*a22, c4 = a21*a33 - a31*a23, c5 = a22*a33 - a32*a23;
+      
+      double invdet = 1.0/(s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0);
+      
+      b[ 0*L+iLane] = ( a11*c5 - a12*c4 + a13*c3)*invdet;
+      b[ 1*L+iLane] = (-a01*c5 + a02*c4 - a03*c3)*invdet;
+      b[ 2*L+iLane] = ( a31*s5 - a32*s4 + a33*s3)*invdet;
+      b[ 3*L+iLane] = (-a21*s5 + a22*s4 - a23*s3)*invdet;
+      b[ 4*L+iLane] = (-a10*c5 + a12*c2 - a13*c1)*invdet;
+      b[ 5*L+iLane] = ( a00*c5 - a02*c2 + a03*c1)*invdet;
+      b[ 6*L+iLane] = (-a30*s5 + a32*s2 - a33*s1)*invdet;
+      b[ 7*L+iLane] = ( a20*s5 - a22*s2 + a23*s1)*invdet;
+      b[ 8*L+iLane] = ( a10*c4 - a11*c2 + a13*c0)*invdet;
+      b[ 9*L+iLane] = (-a00*c4 + a01*c2 - a03*c0)*invdet;
+      b[10*L+iLane] = ( a30*s4 - a31*s2 + a33*s0)*invdet;
+      b[11*L+iLane] = (-a20*s4 + a21*s2 - a23*s0)*invdet;
+      b[12*L+iLane] = (-a10*c3 + a11*c1 - a12*c0)*invdet;
+      b[13*L+iLane] = ( a00*c3 - a01*c1 + a02*c0)*invdet;
+      b[14*L+iLane] = (-a30*s3 + a31*s1 - a32*s0)*invdet;
+      b[15*L+iLane] = ( a20*s3 - a21*s1 + a22*s0)*invdet;
+      
+    }
     
-    Gauss_Elimination(block_i, aux_vector);
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
   }
   
 }
 
-void CSysMatrix::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, double *invBlock) {
+template<unsigned short nB, class T>
+void CSysMatrix::BuildJacobiPreconditioner_Kernel(T *inv, unsigned long row_begin, unsigned long row_end) {
   
-  unsigned long iVar, jVar;
+  const unsigned long n = (nB != 0 ? nB : nVar), nn = n*n;
+  const unsigned short L = JACOBI_LANES;
+  unsigned long iPoint, jPoint, iVar;
+  unsigned short iLane, nLane;
+  const double *block;
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
+  /*--- Generic block size, one block at a time ---*/
+  
+  if (nB == 0) {
+    for (iPoint = row_begin; iPoint < row_end; iPoint++)
+      BlockInverse<nB>(&matrix[dia_ptr[iPoint]*nn], &inv[iPoint*nn]);
+    return;
+  }
+  
+  /*--- The diagonal blocks of JACOBI_LANES points are interleaved, inverted together, and
+   written back to the contiguous storage of invM (the last batch is padded with identities) ---*/
+  
+  double Block[(nB != 0 ? nB*nB : 1)*JACOBI_LANES], invBlock[(nB != 0 ? nB*nB : 1)*JACOBI_LANES];
+  
+  for (iPoint = row_begin; iPoint < row_end; iPoint += L) {
     
-    /*--- Compute the i-th column of the inverse matrix ---*/
+    nLane = (unsigned short)min((unsigned long)L, row_end-iPoint);
+    
+    for (iLane = 0; iLane < L; iLane++) {
+      if (iLane < nLane) {
+        block = &matrix[dia_ptr[iPoint+iLane]*nn];
+        for (iVar = 0; iVar < nn; iVar++) Block[iVar*L+iLane] = block[iVar];
+      }
+      else {
+        for (iVar = 0; iVar < nn; iVar++) Block[iVar*L+iLane] = (iVar%(n+1) == 0 ? 1.0 : 0.0);
+      }
+    }
+    
+    BlockInverse_Batch<nB>(Block, invBlock);
+    
+    for (iLane = 0; iLane < nLane; iLane++) {
+      jPoint = iPoint+iLane;
+      for (iVar = 0; iVar < nn; iVar++) inv[jPoint*nn+iVar] = invBlock[iVar*L+iLane];
+    }
     
-    Gauss_Elimination_ILUMatrix(block_i, aux_vector);
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
   }
   
 }
 
-void CSysMatrix::BuildJacobiPreconditioner(void) {
+void CSysMatrix::BuildJacobiPreconditioner_Thread(void *data, unsigned short iThread, unsigned short nThread) {
   
-  unsigned long iPoint, iVar, jVar;
+  CSysMatrix *A = ((CSysMatrix_Loop *)data)->matrix;
+  unsigned long row_begin, row_end;
   
-  /*--- Compute Jacobi Preconditioner ---*/
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
-    
-    /*--- Compute the inverse of the diagonal block ---*/
-    InverseDiagonalBlock(iPoint, block_inverse);
-    
-    /*--- Set the inverse of the matrix to the invM structure (which is a vector) ---*/
-    for (iVar = 0; iVar < nVar; iVar++)
-      for (jVar = 0; jVar < nVar; jVar++)
-        invM[iPoint*nVar*nVar+iVar*nVar+jVar] = block_inverse[iVar*nVar+jVar];
+  CThreadPool::GetChunk(A->nPoint, iThread, nThread, row_begin, row_end);
+  
+  if (A->invM_flt != NULL) {
+    switch (A->nVarBlock) {
+      case 1:  A->BuildJacobiPreconditioner_Kernel<1>(A->invM_flt, row_begin, row_end); break;
+      case 2:  A->BuildJacobiPreconditioner_Kernel<2>(A->invM_flt, row_begin, row_end); break;
+      case 4:  A->BuildJacobiPreconditioner_Kernel<4>(A->invM_flt, row_begin, row_end); break;
+      default: A->BuildJacobiPreconditioner_Kernel<0>(A->invM_flt, row_begin, row_end); break;
+    }
+  }
+  else {
+    switch (A->nVarBlock) {
+      case 1:  A->BuildJacobiPreconditioner_Kernel<1>(A->invM, row_begin, row_end); break;
+      case 2:  A->BuildJacobiPreconditioner_Kernel<2>(A->invM, row_begin, row_end); break;
+      case 4:  A->BuildJacobiPreconditioner_Kernel<4>(A->invM, row_begin, row_end); break;
+      default: A->BuildJacobiPreconditioner_Kernel<0>(A->invM, row_begin, row_end); break;
+    }
   }
   
 }
 
-void CSysMatrix::BuildILUPreconditioner(void) {
+void CSysMatrix::BuildJacobiPreconditioner(void) {
+  
+  /*--- Compute the inverse of the diagonal blocks, and set it to the invM structure (which is a vector) ---*/
+  
+  CSysMatrix_Loop loop;
+  loop.matrix = this;
+  CThreadPool::Run(BuildJacobiPreconditioner_Thread, &loop, nPoint*nVar*nVar);
+  
+  /*--- The factors of the linelets are built (and lagged) with the diagonal blocks ---*/
   
-  /*--- Reimplement is such a way the LU is a preprocessing ---*/
+  if (nLineletBatch != 0)
+    CThreadPool::Run(BuildLineletPreconditioner_Thread, &loop, LineletBatch_ptr[nLineletBatch]*LINELET_LANES*nVar*nVar);
   
 }
 
-unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConfig *config) {
-  
-  bool *check_Point, add_point;
-  unsigned long iEdge, iPoint, jPoint, index_Point, iLinelet, iVertex, next_Point, counter, iElem;
-  unsigned short iMarker, iNode, ExtraLines = 100, MeanPoints;
-  double alpha = 0.9, weight, max_weight, *normal, area, volume_iPoint, volume_jPoint;
-  unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets;
+void CSysMatrix::BuildLineletPreconditioner_Thread(void *data, unsigned short iThread, unsigned short nThread) {
   
-  /*--- Memory allocation --*/
+  CSysMatrix *A = ((CSysMatrix_Loop *)data)->matrix;
+  double *work = &A->Linelet_Work[iThread*A->Linelet_Work_Size];
+  unsigned long batch_begin, batch_end;
   
-  check_Point = new bool [geometry->GetnPoint()];
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
-    check_Point[iPoint] = true;
+  /*--- The linelets are independent, the batches are split among the threads ---*/
   
-  LineletBool = new bool[geometry->GetnPoint()];
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint ++)
-    LineletBool[iPoint] = false;
+  CThreadPool::GetChunk(A->nLineletBatch, iThread, nThread, batch_begin, batch_end);
+  
+  if (A->Linelet_Factor_flt != NULL) {
+    switch (A->nVarBlock) {
+      case 1:  A->BuildLineletPreconditioner_Kernel<1>(A->Linelet_Factor_flt, work, batch_begin, batch_end); break;
+      case 2:  A->BuildLineletPreconditioner_Kernel<2>(A->Linelet_Factor_flt, work, batch_begin, batch_end); break;
+      case 4:  A->BuildLineletPreconditioner_Kernel<4>(A->Linelet_Factor_flt, work, batch_begin, batch_end); break;
+      default: A->BuildLineletPreconditioner_Kernel<0>(A->Linelet_Factor_flt, work, batch_begin, batch_end); break;
+    }
+  }
+  else {
+    switch (A->nVarBlock) {
+      case 1:  A->BuildLineletPreconditioner_Kernel<1>(A->Linelet_Factor, work, batch_begin, batch_end); break;
+      case 2:  A->BuildLineletPreconditioner_Kernel<2>(A->Linelet_Factor, work, batch_begin, batch_end); break;
+      case 4:  A->BuildLineletPreconditioner_Kernel<4>(A->Linelet_Factor, work, batch_begin, batch_end); break;
+      default: A->BuildLineletPreconditioner_Kernel<0>(A->Linelet_Factor, work, batch_begin, batch_end); break;
+    }
+  }
+  
+}
+
+template<unsigned short nB, class T>
+void CSysMatrix::BuildLineletPreconditioner_Kernel(T *factor, double *work, unsigned long batch_begin, unsigned long batch_end) {
+  
+  const unsigned long n = (nB != 0 ? nB : nVar), nn = n*n;
+  unsigned long iBatch, iElem, iLane, iPoint, im1Point, ip1Point, iVar;
+  double *block, *UBlock, *invUBlock, *EGBlock, *GBlock;
+  bool last;
+  T *fac;
+  
+  /*--- Blocks of the factorization on the stack for the specialized sizes, in the scratch
+   of the thread for the generic one (followed by the storage of the elimination) ---*/
+  
+  double Block[(nB != 0 ? 4*nB*nB : 1)];
+  if (nB != 0) { UBlock = Block; invUBlock = &Block[nn]; EGBlock = &Block[2*nn]; GBlock = &Block[3*nn]; }
+  else { UBlock = work; invUBlock = &work[nn]; EGBlock = &work[2*nn]; GBlock = &work[3*nn]; }
+  
+  /*--- Block LU decomposition of each linelet, D_i - E_i.G_i-1 = U_i, with E_i = A_i,i-1
+   and G_i = inv(U_i).A_i,i+1, the padding elements have inv(U) = I and E = G = 0 ---*/
+  
+  for (iBatch = batch_begin; iBatch < batch_end; iBatch++) {
+    for (iLane = 0; iLane < LINELET_LANES; iLane++) {
+      for (iVar = 0; iVar < nn; iVar++) GBlock[iVar] = 0.0;
+      for (iElem = LineletBatch_ptr[iBatch]; iElem < LineletBatch_ptr[iBatch+1]; iElem++) {
+        
+        fac = &factor[iElem*3*nn*LINELET_LANES + iLane];
+        iPoint = LineletBatch_Point[iElem*LINELET_LANES+iLane];
+        
+        if (iPoint == LINELET_PADDING) {
+          for (iVar = 0; iVar < nn; iVar++) {
+            fac[iVar*LINELET_LANES] = (iVar%(n+1) == 0 ? 1.0 : 0.0);
+            fac[(nn+iVar)*LINELET_LANES] = 0.0;
+            fac[(2*nn+iVar)*LINELET_LANES] = 0.0;
+          }
+          continue;
+        }
+        
+        block = &matrix[dia_ptr[iPoint]*nn];
+        for (iVar = 0; iVar < nn; iVar++) UBlock[iVar] = block[iVar];
+        
+        if (iElem == LineletBatch_ptr[iBatch]) {
+          for (iVar = 0; iVar < nn; iVar++) fac[(nn+iVar)*LINELET_LANES] = 0.0;
+        }
+        else {
+          im1Point = LineletBatch_Point[(iElem-1)*LINELET_LANES+iLane];
+          block = GetBlock(iPoint, im1Point);
+          BlockBlockProduct<nB>(block, GBlock, EGBlock);
+          for (iVar = 0; iVar < nn; iVar++) {
+            UBlock[iVar] -= EGBlock[iVar];
+            fac[(nn+iVar)*LINELET_LANES] = block[iVar];
+          }
+        }
+        
+        BlockInverse<nB>(UBlock, invUBlock, &GBlock[nn]);
+        for (iVar = 0; iVar < nn; iVar++) fac[iVar*LINELET_LANES] = invUBlock[iVar];
+        
+        last = (iElem+1 == LineletBatch_ptr[iBatch+1]);
+        if (!last) last = (LineletBatch_Point[(iElem+1)*LINELET_LANES+iLane] == LINELET_PADDING);
+        
+        if (last) {
+          for (iVar = 0; iVar < nn; iVar++) GBlock[iVar] = 0.0;
+        }
+        else {
+          ip1Point = LineletBatch_Point[(iElem+1)*LINELET_LANES+iLane];
+          BlockBlockProduct<nB>(invUBlock, GetBlock(iPoint, ip1Point), GBlock);
+        }
+        for (iVar = 0; iVar < nn; iVar++) fac[(2*nn+iVar)*LINELET_LANES] = GBlock[iVar];
+        
+      }
+    }
+  }
+  
+}
+
+void CSysMatrix::BuildILUPreconditioner(void) {
+  
+  Sweep(SWEEP_ILU_BUILD, NULL, NULL, false);
+  
+}
+
+vector<unsigned long> *CSysMatrix::FindLinelets(CGeometry *geometry, CConfig *config, unsigned long & val_nLinelet) {
+  
+  bool *check_Point, add_point;
+  unsigned long iEdge, iPoint, jPoint, index_Point, iLinelet, iVertex, next_Point, counter;
+  unsigned long nLinelet;
+  unsigned short iMarker, iNode, ExtraLines = 100;
+  double alpha = 0.9, weight, max_weight, *normal, area, volume_iPoint, volume_jPoint;
+  vector<unsigned long> *LineletPoint = NULL;
+  
+  /*--- Memory allocation --*/
+  
+  check_Point = new bool [geometry->GetnPoint()];
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    check_Point[iPoint] = true;
   
   nLinelet = 0;
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -1023,31 +1499,30 @@ unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConf
       iLinelet++;
     } while (iLinelet < nLinelet);
     
-    /*--- Identify the points that belong to a Linelet ---*/
-    
-    for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
-      for (iElem = 0; iElem < LineletPoint[iLinelet].size(); iElem++) {
-        iPoint = LineletPoint[iLinelet][iElem];
-        LineletBool[iPoint] = true;
-      }
-    }
-    
-    /*--- Identify the maximum number of elements in a Linelet ---*/
-    
-    max_nElem = LineletPoint[0].size();
-    for (iLinelet = 1; iLinelet < nLinelet; iLinelet++)
-      if (LineletPoint[iLinelet].size() > max_nElem)
-        max_nElem = LineletPoint[iLinelet].size();
-    
   }
   
-  /*--- The domain doesn't have well defined linelets ---*/
+  /*--- Memory deallocation --*/
   
-  else {
-    
-    max_nElem = 0;
-    
-  }
+  delete [] check_Point;
+  
+  val_nLinelet = nLinelet;
+  return LineletPoint;
+  
+}
+
+unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iPoint, iLinelet;
+  unsigned short MeanPoints;
+  unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets;
+  
+  /*--- Memory allocation --*/
+  
+  LineletBool = new bool[geometry->GetnPoint()];
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint ++)
+    LineletBool[iPoint] = false;
+  
+  LineletPoint = FindLinelets(geometry, config, nLinelet);
   
   /*--- Screen output ---*/
   
@@ -1062,128 +1537,133 @@ unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConf
   
   MeanPoints = int(double(Global_nPoints)/double(Global_nLineLets));
   
-  /*--- Memory allocation --*/
-  
-  UBlock = new double* [max_nElem];
-  invUBlock = new double* [max_nElem];
-  LBlock = new double* [max_nElem];
-  yVector = new double* [max_nElem];
-  zVector = new double* [max_nElem];
-  rVector = new double* [max_nElem];
-  for (iElem = 0; iElem < max_nElem; iElem++) {
-    UBlock[iElem] = new double [nVar*nVar];
-    invUBlock[iElem] = new double [nVar*nVar];
-    LBlock[iElem] = new double [nVar*nVar];
-    yVector[iElem] = new double [nVar];
-    zVector[iElem] = new double [nVar];
-    rVector[iElem] = new double [nVar];
-  }
-  
-  LFBlock = new double [nVar*nVar];
-  LyVector = new double [nVar];
-  FzVector = new double [nVar];
-  
-  /*--- Memory deallocation --*/
+  /*--- Batches of the linelets and storage of their factors ---*/
   
-  delete [] check_Point;
+  SetLinelet_Batches();
   
   return MeanPoints;
   
 }
 
-void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+void CSysMatrix::SetLinelet_Batches(void) {
   
-  unsigned long iPoint, iVar, jVar;
+  unsigned long iLinelet, iPoint, iElem, iBatch, iLane, nElem, nElem_Batch;
+  vector<pair<unsigned long, unsigned long> > Linelet_Order;
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      prod[(const unsigned int)(iPoint*nVar+iVar)] = 0.0;
-      for (jVar = 0; jVar < nVar; jVar++)
-        prod[(const unsigned int)(iPoint*nVar+iVar)] +=
-        invM[(const unsigned int)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(const unsigned int)(iPoint*nVar+jVar)];
+  /*--- Identify the points that belong to a Linelet, and the maximum number of elements in a Linelet ---*/
+  
+  max_nElem = 0;
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
+    for (iElem = 0; iElem < LineletPoint[iLinelet].size(); iElem++) {
+      iPoint = LineletPoint[iLinelet][iElem];
+      LineletBool[iPoint] = true;
     }
+    max_nElem = max(max_nElem, (unsigned long)LineletPoint[iLinelet].size());
   }
   
-  /*--- MPI Parallelization ---*/
+  /*--- Batches of LINELET_LANES linelets, sorted by length so that the shorter linelets of
+   a batch need little padding (elements of identity factors) to have the length of the batch ---*/
   
-  SendReceive_Solution(prod, geometry, config);
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++)
+    Linelet_Order.push_back(make_pair((unsigned long)LineletPoint[iLinelet].size(), iLinelet));
+  sort(Linelet_Order.begin(), Linelet_Order.end());
+  
+  nLineletBatch = (nLinelet+LINELET_LANES-1)/LINELET_LANES;
+  LineletBatch_ptr = new unsigned long [nLineletBatch+1];
+  LineletBatch_ptr[0] = 0;
+  for (iBatch = 0; iBatch < nLineletBatch; iBatch++) {
+    nElem_Batch = Linelet_Order[min(nLinelet, (iBatch+1)*LINELET_LANES)-1].first;
+    LineletBatch_ptr[iBatch+1] = LineletBatch_ptr[iBatch] + nElem_Batch;
+  }
+  
+  LineletBatch_Point = new unsigned long [LineletBatch_ptr[nLineletBatch]*LINELET_LANES];
+  for (iBatch = 0; iBatch < nLineletBatch; iBatch++) {
+    nElem_Batch = LineletBatch_ptr[iBatch+1]-LineletBatch_ptr[iBatch];
+    for (iLane = 0; iLane < LINELET_LANES; iLane++) {
+      nElem = 0;
+      if (iBatch*LINELET_LANES+iLane < nLinelet) {
+        iLinelet = Linelet_Order[iBatch*LINELET_LANES+iLane].second;
+        nElem = LineletPoint[iLinelet].size();
+      }
+      for (iElem = 0; iElem < nElem_Batch; iElem++)
+        LineletBatch_Point[(LineletBatch_ptr[iBatch]+iElem)*LINELET_LANES+iLane] =
+        (iElem < nElem ? LineletPoint[iLinelet][iElem] : LINELET_PADDING);
+    }
+  }
+  
+  /*--- Factors of the block Thomas algorithm (computed with the Jacobi preconditioner),
+   in the same precision as the inverse of the diagonal blocks ---*/
+  
+  if (invM_flt != NULL) Linelet_Factor_flt = SysMatrix_Allocate<float>(LineletBatch_ptr[nLineletBatch]*LINELET_LANES*3*nVar*nVar);
+  else Linelet_Factor = SysMatrix_Allocate<double>(LineletBatch_ptr[nLineletBatch]*LINELET_LANES*3*nVar*nVar);
+  
+  /*--- Scratch of each thread, the lane-interleaved solution of a batch and the right hand side of an
+   element (or the blocks and the elimination of the generic factorization), padded to whole cache lines ---*/
+  
+  Linelet_Work_Size = max((max_nElem+1)*nVar*LINELET_LANES, 5*(unsigned long)nVar*nVar+nVar);
+  Linelet_Work_Size = ((Linelet_Work_Size*sizeof(double)+MATRIX_ALIGNMENT-1)/MATRIX_ALIGNMENT)*MATRIX_ALIGNMENT/sizeof(double);
+  Linelet_Work = SysMatrix_Allocate<double>(CThreadPool::GetnThread()*Linelet_Work_Size);
   
 }
 
-void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+template<unsigned short nB, class T>
+void CSysMatrix::ComputeJacobiPreconditioner_Kernel(const T *inv, const CSysVector & vec, CSysVector & prod,
+                                                    unsigned long row_begin, unsigned long row_end) {
   
-  unsigned long index, index_;
-  double *Block_ij, *Block_jk;
-  long iPoint, jPoint, kPoint;
-  unsigned short iVar;
+  const unsigned long n = (nB != 0 ? nB : nVar);
+  unsigned long iPoint;
   
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
+  for (iPoint = row_begin; iPoint < row_end; iPoint++)
+    BlockVectorProduct<nB>(&inv[iPoint*n*n], &vec[iPoint*n], &prod[iPoint*n]);
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-      jPoint = col_ind[index];
-      Block_ij = GetBlock(iPoint, jPoint);
-      SetBlock_ILUMatrix(iPoint, jPoint, Block_ij);
+}
+
+void CSysMatrix::ComputeJacobiPreconditioner_Thread(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CSysMatrix_Loop *loop = (CSysMatrix_Loop *)data;
+  CSysMatrix *A = loop->matrix;
+  unsigned long row_begin, row_end;
+  
+  CThreadPool::GetChunk(A->nPointDomain, iThread, nThread, row_begin, row_end);
+  
+  if (A->invM_flt != NULL) {
+    switch (A->nVarBlock) {
+      case 1:  A->ComputeJacobiPreconditioner_Kernel<1>(A->invM_flt, *loop->vec, *loop->prod, row_begin, row_end); break;
+      case 2:  A->ComputeJacobiPreconditioner_Kernel<2>(A->invM_flt, *loop->vec, *loop->prod, row_begin, row_end); break;
+      case 4:  A->ComputeJacobiPreconditioner_Kernel<4>(A->invM_flt, *loop->vec, *loop->prod, row_begin, row_end); break;
+      default: A->ComputeJacobiPreconditioner_Kernel<0>(A->invM_flt, *loop->vec, *loop->prod, row_begin, row_end); break;
     }
-    for (iVar = 0; iVar < nVar; iVar++) {
-      prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
+  }
+  else {
+    switch (A->nVarBlock) {
+      case 1:  A->ComputeJacobiPreconditioner_Kernel<1>(A->invM, *loop->vec, *loop->prod, row_begin, row_end); break;
+      case 2:  A->ComputeJacobiPreconditioner_Kernel<2>(A->invM, *loop->vec, *loop->prod, row_begin, row_end); break;
+      case 4:  A->ComputeJacobiPreconditioner_Kernel<4>(A->invM, *loop->vec, *loop->prod, row_begin, row_end); break;
+      default: A->ComputeJacobiPreconditioner_Kernel<0>(A->invM, *loop->vec, *loop->prod, row_begin, row_end); break;
     }
   }
   
-  /*--- Transform system in Upper Matrix ---*/
+}
+
+void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
-    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-      jPoint = col_ind[index];
-      if ((jPoint < iPoint) && (jPoint < nPointDomain)) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        InverseDiagonalBlock_ILUMatrix(jPoint, block_inverse);
-        MatrixMatrixProduct(Block_ij, block_inverse, block_weight);
-        for (index_ = row_ptr[jPoint]; index_ < row_ptr[jPoint+1]; index_++) {
-          kPoint = col_ind[index_];
-          if (kPoint < nPointDomain) {
-            Block_jk = GetBlock_ILUMatrix(jPoint, kPoint);
-            if (kPoint >= jPoint) {
-              MatrixMatrixProduct(Block_jk, block_weight, block);
-              SubtractBlock_ILUMatrix(iPoint, kPoint, block);
-            }
-          }
-        }
-        MatrixVectorProduct(block_weight, &prod[jPoint*nVar], aux_vector);
-        for (iVar = 0; iVar < nVar; iVar++)
-          prod[iPoint*nVar+iVar] -= aux_vector[iVar];
-        
-      }
-    }
-  }
+  CSysMatrix_Loop loop;
+  loop.matrix = this; loop.vec = &vec; loop.prod = &prod;
+  CThreadPool::Run(ComputeJacobiPreconditioner_Thread, &loop, nPointDomain*nVar);
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
 
-  /*--- Backwards substitution ---*/
+void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-  MatrixVectorProduct(block_inverse, &prod[(nPointDomain-1)*nVar], aux_vector);
+  /*--- The factorization has been computed by BuildILUPreconditioner,
+   only the block forward and backward substitutions are done here ---*/
   
-  for (iVar = 0; iVar < nVar; iVar++)
-    prod[ (nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
-  
-  for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
-    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-      jPoint = col_ind[index];
-      if (jPoint < nPointDomain) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        if ((jPoint >= iPoint+1) && (jPoint < nPointDomain)) {
-          MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
-        }
-      }
-    }
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = (prod[iPoint*nVar+iVar]-sum_vector[iVar]);
-    InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-    MatrixVectorProduct(block_inverse, &prod[iPoint*nVar], aux_vector);
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = aux_vector[iVar];
-    if (iPoint == 0) break;
-  }
+  Sweep(SWEEP_ILU_FORWARD, &vec, &prod, false);
+  Sweep(SWEEP_ILU_BACKWARD, NULL, &prod, true);
   
   /*--- MPI Parallelization ---*/
   
@@ -1192,36 +1672,18 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
 }
 
 void CSysMatrix::ComputeLU_SGSPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
-  unsigned long iPoint, iVar;
   
   /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    LowerProduct(prod, iPoint);                                        // Compute L.x*
-    for (iVar = 0; iVar < nVar; iVar++)
-      aux_vector[iVar] = vec[iPoint*nVar+iVar] - prod_row_vector[iVar]; // Compute aux_vector = b - L.x*
-    Gauss_Elimination(iPoint, aux_vector);                            // Solve D.x* = aux_vector
-    for (iVar = 0; iVar < nVar; iVar++)
-      prod[iPoint*nVar+iVar] = aux_vector[iVar];                       // Assesing x* = solution
-  }
+  Sweep(SWEEP_LU_SGS_FORWARD, &vec, &prod, false);
   
   /*--- MPI Parallelization ---*/
   
   SendReceive_Solution(prod, geometry, config);
-
+  
   /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
   
-  for (iPoint = nPointDomain-1; (int)iPoint >= 0; iPoint--) {
-    DiagonalProduct(prod, iPoint);                 // Compute D.x*
-    for (iVar = 0; iVar < nVar; iVar++)
-      aux_vector[iVar] = prod_row_vector[iVar];   // Compute aux_vector = D.x*
-    UpperProduct(prod, iPoint);                    // Compute U.x_(n+1)
-    for (iVar = 0; iVar < nVar; iVar++)
-      aux_vector[iVar] -= prod_row_vector[iVar];  // Compute aux_vector = D.x*-U.x_(n+1)
-    Gauss_Elimination(iPoint, aux_vector);        // Solve D.x* = aux_vector
-    for (iVar = 0; iVar < nVar; iVar++)
-      prod[iPoint*nVar + iVar] = aux_vector[iVar]; // Assesing x_(1) = solution
-  }
+  Sweep(SWEEP_LU_SGS_BACKWARD, NULL, &prod, true);
   
   /*--- MPI Parallelization ---*/
   
@@ -1229,102 +1691,393 @@ void CSysMatrix::ComputeLU_SGSPreconditioner(const CSysVector & vec, CSysVector
   
 }
 
-void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector & prod,
-                                              CGeometry *geometry, CConfig *config) {
-  
-  unsigned long iVar, jVar, nElem = 0, iLinelet, im1Point, iPoint, ip1Point, iElem;
-  long iElemLoop;
-  double *block;
-
-  int rank = MASTER_NODE;
-  int size = SINGLE_NODE;
-  
-  if (size == SINGLE_NODE) {
+template<unsigned short nB, class T, class I>
+void CSysMatrix::BuildILUPreconditioner_Kernel(const I *row, const I *col, T *LU, unsigned long row_begin, unsigned long row_end) {
+  
+  const unsigned long n = (nB != 0 ? nB : nVar);
+  unsigned long iRow, k, k_, index, index_, index_ik, first, last, mid, iVar;
+  unsigned long iPoint, jPoint, kPoint;
+  T *Block_ij, *Block_ik;
+  double local_weight[nB != 0 ? nB*nB : 1], local_prod[nB != 0 ? nB*nB : 1];
+  double *weight = (nB != 0 ? local_weight : block_weight);
+  double *product = (nB != 0 ? local_prod : block_inverse);
+  
+  for (iRow = row_begin; iRow < row_end; iRow++) {
+    iPoint = sweep_row[iRow];
     
-    /*--- Jacobi preconditioning if there is no linelet ---*/
+    /*--- Copy the row, note that the original matrix is modified by the
+     algorithm, so the factorization is stored in LU at the end. The operations
+     are done in double precision, only the storage may be single precision ---*/
     
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      if (!LineletBool[iPoint]) {
-        for (iVar = 0; iVar < nVar; iVar++) {
-          prod[(const unsigned int)(iPoint*nVar+iVar)] = 0.0;
-          for (jVar = 0; jVar < nVar; jVar++)
-            prod[(const unsigned int)(iPoint*nVar+iVar)] +=
-            invM[(const unsigned int)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(const unsigned int)(iPoint*nVar+jVar)];
-        }
-      }
-    }
+    for (index = row[iPoint]*n*n; index < row[iPoint+1]*n*n; index++)
+      LU[index] = matrix[index];
     
-    /*--- MPI Parallelization ---*/
-    
-    SendReceive_Solution(prod, geometry, config);
+    /*--- Block ILU(0) factorization of the row (IKJ variant). The strictly lower
+     blocks store L_ij = A_ij.inv(U_jj) (L has unit block diagonal), the strictly
+     upper blocks store U_ij, and the diagonal blocks store inv(U_ii) so that
+     the application of the preconditioner only requires products. The lower
+     rows j are already factorized (they belong to previous groups) ---*/
     
-    /*--- Solve linelet using a Thomas' algorithm ---*/
-    
-    for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
+    for (k = sweep_ptr[iPoint]; k < sweep_mid[iPoint]; k++) {
+      index = sweep_ind[k];
+      jPoint = col[index];
       
-      nElem = LineletPoint[iLinelet].size();
+      /*--- Compute L_ij = A_ij.inv(U_jj), the diagonal of row j is already inverted ---*/
       
-      /*--- Copy vec vector to the new structure ---*/
+      Block_ij = &LU[index*n*n];
+      BlockBlockProduct<nB>(Block_ij, &LU[dia_ptr[jPoint]*n*n], weight);
+      for (iVar = 0; iVar < n*n; iVar++)
+        Block_ij[iVar] = weight[iVar];
       
-      for (iElem = 0; iElem < nElem; iElem++) {
-        iPoint = LineletPoint[iLinelet][iElem];
-        for (iVar = 0; iVar < nVar; iVar++)
-          rVector[iElem][iVar] = vec[(const unsigned int)(iPoint*nVar+iVar)];
-      }
+      /*--- Update the rest of the row, A_ik = A_ik - L_ij.U_jk (only inside the sparsity
+       pattern), the block (i,k) is found by bisection in the sorted row ---*/
       
-      /*--- Initialization (iElem = 0) ---*/
-      
-      iPoint = LineletPoint[iLinelet][0];
-      block = GetBlock(iPoint, iPoint);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        yVector[0][iVar] = rVector[0][iVar];
-        for (jVar = 0; jVar < nVar; jVar++)
-          UBlock[0][iVar*nVar+jVar] = block[iVar*nVar+jVar];
+      for (k_ = sweep_mid[jPoint]; k_ < sweep_ptr[jPoint+1]; k_++) {
+        index_ = sweep_ind[k_];
+        kPoint = col[index_];
+        if (kPoint >= nPointDomain) continue;
+        first = row[iPoint]; last = row[iPoint+1];
+        while (last-first > 1) {
+          mid = (first+last)/2;
+          if (col[mid] <= kPoint) first = mid; else last = mid;
+        }
+        index_ik = first;
+        if (col[index_ik] == kPoint) {
+          Block_ik = &LU[index_ik*n*n];
+          BlockBlockProduct<nB>(weight, &LU[index_*n*n], product);
+          for (iVar = 0; iVar < n*n; iVar++)
+            Block_ik[iVar] -= product[iVar];
+        }
       }
       
-      /*--- Main loop (without iElem = 0) ---*/
-      
-      for (iElem = 1; iElem < nElem; iElem++) {
-        
-        im1Point = LineletPoint[iLinelet][iElem-1];
-        iPoint = LineletPoint[iLinelet][iElem];
-        
-        InverseBlock(UBlock[iElem-1], invUBlock[iElem-1]);
-        block = GetBlock(iPoint, im1Point); GetMultBlockBlock(LBlock[iElem], block, invUBlock[iElem-1]);
-        block = GetBlock(im1Point, iPoint); GetMultBlockBlock(LFBlock, LBlock[iElem], block);
-        block = GetBlock(iPoint, iPoint); GetSubsBlock(UBlock[iElem], block, LFBlock);
-        
-        /*--- Forward substituton ---*/
-        
-        GetMultBlockVector(LyVector, LBlock[iElem], yVector[iElem-1]);
-        GetSubsVector(yVector[iElem], rVector[iElem], LyVector);
-        
+    }
+    
+    /*--- Invert the diagonal block of U, and store it in place ---*/
+    
+    Block_ij = &LU[dia_ptr[iPoint]*n*n];
+    BlockInverse<nB>(Block_ij, product);
+    for (iVar = 0; iVar < n*n; iVar++)
+      Block_ij[iVar] = product[iVar];
+    
+  }
+  
+}
+
+template<unsigned short nB, class T, class I>
+void CSysMatrix::ILUForwardSweep_Kernel(const I *col, const T *LU, const CSysVector & vec, CSysVector & prod,
+                                        unsigned long row_begin, unsigned long row_end) {
+  
+  const unsigned long n = (nB != 0 ? nB : nVar);
+  unsigned long iRow, k, index, iPoint, iVar;
+  double local_sum[nB != 0 ? nB : 1], local_aux[nB != 0 ? nB : 1];
+  double *sum = (nB != 0 ? local_sum : sum_vector);
+  double *aux = (nB != 0 ? local_aux : aux_vector);
+  
+  /*--- Forward substitution, L.y = vec (L has unit block diagonal) ---*/
+  
+  for (iRow = row_begin; iRow < row_end; iRow++) {
+    iPoint = sweep_row[iRow];
+    for (iVar = 0; iVar < n; iVar++)
+      sum[iVar] = vec[iPoint*n+iVar];
+    for (k = sweep_ptr[iPoint]; k < sweep_mid[iPoint]; k++) {
+      index = sweep_ind[k];
+      BlockVectorProduct<nB>(&LU[index*n*n], &prod[col[index]*n], aux);
+      for (iVar = 0; iVar < n; iVar++)
+        sum[iVar] -= aux[iVar];
+    }
+    for (iVar = 0; iVar < n; iVar++)
+      prod[iPoint*n+iVar] = sum[iVar];
+  }
+  
+}
+
+template<unsigned short nB, class T, class I>
+void CSysMatrix::ILUBackwardSweep_Kernel(const I *col, const T *LU, CSysVector & prod, unsigned long row_begin, unsigned long row_end) {
+  
+  const unsigned long n = (nB != 0 ? nB : nVar);
+  unsigned long iRow, k, index, iPoint, iVar;
+  double local_sum[nB != 0 ? nB : 1], local_aux[nB != 0 ? nB : 1];
+  double *sum = (nB != 0 ? local_sum : sum_vector);
+  double *aux = (nB != 0 ? local_aux : aux_vector);
+  
+  /*--- Backward substitution, U.prod = y (the diagonal blocks store inv(U_ii)) ---*/
+  
+  for (iRow = row_end; iRow-- > row_begin; ) {
+    iPoint = sweep_row[iRow];
+    for (iVar = 0; iVar < n; iVar++)
+      sum[iVar] = prod[iPoint*n+iVar];
+    for (k = sweep_ptr[iPoint+1]; k-- > sweep_mid[iPoint]; ) {
+      index = sweep_ind[k];
+      if (col[index] < nPointDomain) {
+        BlockVectorProduct<nB>(&LU[index*n*n], &prod[col[index]*n], aux);
+        for (iVar = 0; iVar < n; iVar++)
+          sum[iVar] -= aux[iVar];
       }
+    }
+    BlockVectorProduct<nB>(&LU[dia_ptr[iPoint]*n*n], sum, &prod[iPoint*n]);
+  }
+  
+}
+
+template<unsigned short nB, class I>
+void CSysMatrix::LU_SGSForwardSweep_Kernel(const I *col, const CSysVector & vec, CSysVector & prod,
+                                           unsigned long row_begin, unsigned long row_end) {
+  
+  const unsigned long n = (nB != 0 ? nB : nVar);
+  unsigned long iRow, k, index, iPoint, iVar;
+  double local_sum[nB != 0 ? nB : 1], local_aux[nB != 0 ? nB : 1], local_prod[nB != 0 ? nB : 1];
+  double *sum = (nB != 0 ? local_sum : sum_vector);
+  double *aux = (nB != 0 ? local_aux : aux_vector);
+  double *prod_block = (nB != 0 ? local_prod : prod_block_vector);
+  
+  for (iRow = row_begin; iRow < row_end; iRow++) {
+    iPoint = sweep_row[iRow];
+    for (iVar = 0; iVar < n; iVar++)
+      sum[iVar] = 0.0;
+    for (k = sweep_ptr[iPoint]; k < sweep_mid[iPoint]; k++) {
+      index = sweep_ind[k];
+      BlockVectorProduct<nB>(&matrix[index*n*n], &prod[col[index]*n], prod_block);
+      for (iVar = 0; iVar < n; iVar++)
+        sum[iVar] += prod_block[iVar];                                   // Compute L.x*
+    }
+    for (iVar = 0; iVar < n; iVar++)
+      aux[iVar] = vec[iPoint*n+iVar] - sum[iVar];                       // Compute aux = b - L.x*
+    BlockGaussElimination<nB>(&matrix[dia_ptr[iPoint]*n*n], aux);        // Solve D.x* = aux
+    for (iVar = 0; iVar < n; iVar++)
+      prod[iPoint*n+iVar] = aux[iVar];                                  // Assesing x* = solution
+  }
+  
+}
+
+template<unsigned short nB, class I>
+void CSysMatrix::LU_SGSBackwardSweep_Kernel(const I *col, CSysVector & prod, unsigned long row_begin, unsigned long row_end) {
+  
+  const unsigned long n = (nB != 0 ? nB : nVar);
+  unsigned long iRow, k, index, iPoint, iVar;
+  double local_sum[nB != 0 ? nB : 1], local_aux[nB != 0 ? nB : 1], local_prod[nB != 0 ? nB : 1];
+  double *sum = (nB != 0 ? local_sum : sum_vector);
+  double *aux = (nB != 0 ? local_aux : aux_vector);
+  double *prod_block = (nB != 0 ? local_prod : prod_block_vector);
+  
+  for (iRow = row_end; iRow-- > row_begin; ) {
+    iPoint = sweep_row[iRow];
+    BlockVectorProduct<nB>(&matrix[dia_ptr[iPoint]*n*n], &prod[iPoint*n], aux); // Compute aux = D.x*
+    for (iVar = 0; iVar < n; iVar++)
+      sum[iVar] = 0.0;
+    for (k = sweep_mid[iPoint]; k < sweep_ptr[iPoint+1]; k++) {
+      index = sweep_ind[k];
+      BlockVectorProduct<nB>(&matrix[index*n*n], &prod[col[index]*n], prod_block);
+      for (iVar = 0; iVar < n; iVar++)
+        sum[iVar] += prod_block[iVar];                                   // Compute U.x_(n+1)
+    }
+    for (iVar = 0; iVar < n; iVar++)
+      aux[iVar] -= sum[iVar];                                           // Compute aux = D.x*-U.x_(n+1)
+    BlockGaussElimination<nB>(&matrix[dia_ptr[iPoint]*n*n], aux);        // Solve D.x* = aux
+    for (iVar = 0; iVar < n; iVar++)
+      prod[iPoint*n+iVar] = aux[iVar];                                  // Assesing x_(1) = solution
+  }
+  
+}
+
+template<unsigned short nB, class I>
+void CSysMatrix::Sweep_Kernel(const I *row, const I *col, unsigned short kernel, const CSysVector *vec, CSysVector *prod,
+                              unsigned long row_begin, unsigned long row_end) {
+  
+  switch (kernel) {
+    case SWEEP_ILU_BUILD:
+      if (ILU_matrix_flt != NULL) BuildILUPreconditioner_Kernel<nB>(row, col, ILU_matrix_flt, row_begin, row_end);
+      else BuildILUPreconditioner_Kernel<nB>(row, col, ILU_matrix, row_begin, row_end);
+      break;
+    case SWEEP_ILU_FORWARD:
+      if (ILU_matrix_flt != NULL) ILUForwardSweep_Kernel<nB>(col, ILU_matrix_flt, *vec, *prod, row_begin, row_end);
+      else ILUForwardSweep_Kernel<nB>(col, ILU_matrix, *vec, *prod, row_begin, row_end);
+      break;
+    case SWEEP_ILU_BACKWARD:
+      if (ILU_matrix_flt != NULL) ILUBackwardSweep_Kernel<nB>(col, ILU_matrix_flt, *prod, row_begin, row_end);
+      else ILUBackwardSweep_Kernel<nB>(col, ILU_matrix, *prod, row_begin, row_end);
+      break;
+    case SWEEP_LU_SGS_FORWARD:  LU_SGSForwardSweep_Kernel<nB>(col, *vec, *prod, row_begin, row_end); break;
+    case SWEEP_LU_SGS_BACKWARD: LU_SGSBackwardSweep_Kernel<nB>(col, *prod, row_begin, row_end); break;
+  }
+  
+}
+
+void CSysMatrix::Sweep_Thread(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CSysMatrix_Loop *loop = (CSysMatrix_Loop *)data;
+  CSysMatrix *A = loop->matrix;
+  unsigned long row_begin, row_end;
+  
+  CThreadPool::GetChunk(loop->row_end-loop->row_begin, iThread, nThread, row_begin, row_end);
+  row_begin += loop->row_begin; row_end += loop->row_begin;
+  
+  if (A->col_ind_32 != NULL) {
+    switch (A->nVarBlock) {
+      case 1:  A->Sweep_Kernel<1>(A->row_ptr_32, A->col_ind_32, loop->kernel, loop->vec, loop->prod, row_begin, row_end); break;
+      case 2:  A->Sweep_Kernel<2>(A->row_ptr_32, A->col_ind_32, loop->kernel, loop->vec, loop->prod, row_begin, row_end); break;
+      case 4:  A->Sweep_Kernel<4>(A->row_ptr_32, A->col_ind_32, loop->kernel, loop->vec, loop->prod, row_begin, row_end); break;
+      default: A->Sweep_Kernel<0>(A->row_ptr_32, A->col_ind_32, loop->kernel, loop->vec, loop->prod, row_begin, row_end); break;
+    }
+  }
+  else {
+    switch (A->nVarBlock) {
+      case 1:  A->Sweep_Kernel<1>(A->row_ptr, A->col_ind, loop->kernel, loop->vec, loop->prod, row_begin, row_end); break;
+      case 2:  A->Sweep_Kernel<2>(A->row_ptr, A->col_ind, loop->kernel, loop->vec, loop->prod, row_begin, row_end); break;
+      case 4:  A->Sweep_Kernel<4>(A->row_ptr, A->col_ind, loop->kernel, loop->vec, loop->prod, row_begin, row_end); break;
+      default: A->Sweep_Kernel<0>(A->row_ptr, A->col_ind, loop->kernel, loop->vec, loop->prod, row_begin, row_end); break;
+    }
+  }
+  
+}
+
+void CSysMatrix::Sweep(unsigned short kernel, const CSysVector *vec, CSysVector *prod, bool reverse) {
+  
+  unsigned long iGroup, jGroup, nWork;
+  CSysMatrix_Loop loop;
+  loop.matrix = this; loop.vec = vec; loop.prod = prod; loop.kernel = kernel;
+  
+  for (iGroup = 0; iGroup < nSweepGroup; iGroup++) {
+    jGroup = (reverse ? nSweepGroup-1-iGroup : iGroup);
+    loop.row_begin = sweep_group_ptr[jGroup];
+    loop.row_end = sweep_group_ptr[jGroup+1];
+    
+    /*--- The rows of a group are independent, but the sequential sweep is a single
+     ordered group, and the generic kernels share the internal arrays of the matrix ---*/
+    
+    nWork = (loop.row_end-loop.row_begin)*nVar*nEqn;
+    if ((Kind_Sweep == SWEEP_SEQUENTIAL) || (nVarBlock == 0)) nWork = 0;
+    
+    CThreadPool::Run(Sweep_Thread, &loop, nWork);
+  }
+  
+}
+
+template<unsigned short nB, class T>
+void CSysMatrix::ComputeLineletPreconditioner_Kernel(const T *inv, const T *factor, const CSysVector & vec, CSysVector & prod, double *work,
+                                                     unsigned long row_begin, unsigned long row_end,
+                                                     unsigned long batch_begin, unsigned long batch_end) {
+  
+  const unsigned long n = (nB != 0 ? nB : nVar), nn = n*n;
+  unsigned long iPoint, iBatch, iElem, iLane, iVar, jVar, first, nElem;
+  long iElemLoop;
+  const T *fac;
+  
+  /*--- Lane-interleaved solution of the batch, and right hand side of an element (scratch of the thread) ---*/
+  
+  double *rhs = &work[max_nElem*n*LINELET_LANES];
+  
+  /*--- Jacobi preconditioning if there is no linelet ---*/
+  
+  for (iPoint = row_begin; iPoint < row_end; iPoint++) {
+    if (!LineletBool[iPoint])
+      BlockVectorProduct<nB>(&inv[iPoint*nn], &vec[iPoint*n], &prod[iPoint*n]);
+  }
+  
+  /*--- Solve the linelets of each batch together with the block Thomas' algorithm, all the
+   loops over the lanes have a constant length (and no branches), so they are vectorized ---*/
+  
+  for (iBatch = batch_begin; iBatch < batch_end; iBatch++) {
+    
+    first = LineletBatch_ptr[iBatch];
+    nElem = LineletBatch_ptr[iBatch+1] - first;
+    
+    /*--- Forward substitution, w_i = inv(U_i).(r_i - E_i.w_i-1) ---*/
+    
+    for (iElem = 0; iElem < nElem; iElem++) {
       
-      /*--- Backward substituton ---*/
-      
-      im1Point = LineletPoint[iLinelet][nElem-1];
-      InverseBlock(UBlock[nElem-1], invUBlock[nElem-1]);
-      GetMultBlockVector(zVector[nElem-1], invUBlock[nElem-1], yVector[nElem-1]);
+      fac = &factor[(first+iElem)*3*nn*LINELET_LANES];
       
-      for (iElemLoop = nElem-2; iElemLoop >= 0; iElemLoop--) {
-        iPoint = LineletPoint[iLinelet][iElemLoop];
-        ip1Point = LineletPoint[iLinelet][iElemLoop+1];
-        block = GetBlock(iPoint, ip1Point); GetMultBlockVector(FzVector, block, zVector[iElemLoop+1]);
-        GetSubsVector(aux_vector, yVector[iElemLoop], FzVector);
-        GetMultBlockVector(zVector[iElemLoop], invUBlock[iElemLoop], aux_vector);
+      for (iLane = 0; iLane < LINELET_LANES; iLane++) {
+        iPoint = LineletBatch_Point[(first+iElem)*LINELET_LANES+iLane];
+        for (iVar = 0; iVar < n; iVar++)
+          rhs[iVar*LINELET_LANES+iLane] = (iPoint != LINELET_PADDING ? vec[iPoint*n+iVar] : 0.0);
       }
       
-      /*--- Copy zVector to the prod vector ---*/
+      if (iElem > 0) {
+        for (iVar = 0; iVar < n; iVar++)
+          for (jVar = 0; jVar < n; jVar++)
+            for (iLane = 0; iLane < LINELET_LANES; iLane++)
+              rhs[iVar*LINELET_LANES+iLane] -= fac[(nn+iVar*n+jVar)*LINELET_LANES+iLane]*work[((iElem-1)*n+jVar)*LINELET_LANES+iLane];
+      }
       
-      for (iElem = 0; iElem < nElem; iElem++) {
-        iPoint = LineletPoint[iLinelet][iElem];
-        for (iVar = 0; iVar < nVar; iVar++)
-          prod[(const unsigned int)(iPoint*nVar+iVar)] = zVector[iElem][iVar];
+      for (iVar = 0; iVar < n; iVar++) {
+        for (iLane = 0; iLane < LINELET_LANES; iLane++)
+          work[(iElem*n+iVar)*LINELET_LANES+iLane] = 0.0;
+        for (jVar = 0; jVar < n; jVar++)
+          for (iLane = 0; iLane < LINELET_LANES; iLane++)
+            work[(iElem*n+iVar)*LINELET_LANES+iLane] += fac[(iVar*n+jVar)*LINELET_LANES+iLane]*rhs[jVar*LINELET_LANES+iLane];
       }
       
     }
     
+    /*--- Backward substitution, z_i = w_i - G_i.z_i+1 ---*/
+    
+    for (iElemLoop = long(nElem)-2; iElemLoop >= 0; iElemLoop--) {
+      fac = &factor[(first+iElemLoop)*3*nn*LINELET_LANES];
+      for (iVar = 0; iVar < n; iVar++)
+        for (jVar = 0; jVar < n; jVar++)
+          for (iLane = 0; iLane < LINELET_LANES; iLane++)
+            work[(iElemLoop*n+iVar)*LINELET_LANES+iLane] -= fac[(2*nn+iVar*n+jVar)*LINELET_LANES+iLane]*work[((iElemLoop+1)*n+jVar)*LINELET_LANES+iLane];
+    }
+    
+    /*--- Copy the solution of the batch to the prod vector ---*/
+    
+    for (iElem = 0; iElem < nElem; iElem++) {
+      for (iLane = 0; iLane < LINELET_LANES; iLane++) {
+        iPoint = LineletBatch_Point[(first+iElem)*LINELET_LANES+iLane];
+        if (iPoint == LINELET_PADDING) continue;
+        for (iVar = 0; iVar < n; iVar++)
+          prod[iPoint*n+iVar] = work[(iElem*n+iVar)*LINELET_LANES+iLane];
+      }
+    }
+    
+  }
+  
+}
+
+void CSysMatrix::ComputeLineletPreconditioner_Thread(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CSysMatrix_Loop *loop = (CSysMatrix_Loop *)data;
+  CSysMatrix *A = loop->matrix;
+  double *work = &A->Linelet_Work[iThread*A->Linelet_Work_Size];
+  unsigned long row_begin, row_end, batch_begin, batch_end;
+  
+  /*--- The linelets are independent, the batches are split among the threads like the rows ---*/
+  
+  CThreadPool::GetChunk(A->nPointDomain, iThread, nThread, row_begin, row_end);
+  CThreadPool::GetChunk(A->nLineletBatch, iThread, nThread, batch_begin, batch_end);
+  
+  if (A->invM_flt != NULL) {
+    switch (A->nVarBlock) {
+      case 1:  A->ComputeLineletPreconditioner_Kernel<1>(A->invM_flt, A->Linelet_Factor_flt, *loop->vec, *loop->prod, work, row_begin, row_end, batch_begin, batch_end); break;
+      case 2:  A->ComputeLineletPreconditioner_Kernel<2>(A->invM_flt, A->Linelet_Factor_flt, *loop->vec, *loop->prod, work, row_begin, row_end, batch_begin, batch_end); break;
+      case 4:  A->ComputeLineletPreconditioner_Kernel<4>(A->invM_flt, A->Linelet_Factor_flt, *loop->vec, *loop->prod, work, row_begin, row_end, batch_begin, batch_end); break;
+      default: A->ComputeLineletPreconditioner_Kernel<0>(A->invM_flt, A->Linelet_Factor_flt, *loop->vec, *loop->prod, work, row_begin, row_end, batch_begin, batch_end); break;
+    }
+  }
+  else {
+    switch (A->nVarBlock) {
+      case 1:  A->ComputeLineletPreconditioner_Kernel<1>(A->invM, A->Linelet_Factor, *loop->vec, *loop->prod, work, row_begin, row_end, batch_begin, batch_end); break;
+      case 2:  A->ComputeLineletPreconditioner_Kernel<2>(A->invM, A->Linelet_Factor, *loop->vec, *loop->prod, work, row_begin, row_end, batch_begin, batch_end); break;
+      case 4:  A->ComputeLineletPreconditioner_Kernel<4>(A->invM, A->Linelet_Factor, *loop->vec, *loop->prod, work, row_begin, row_end, batch_begin, batch_end); break;
+      default: A->ComputeLineletPreconditioner_Kernel<0>(A->invM, A->Linelet_Factor, *loop->vec, *loop->prod, work, row_begin, row_end, batch_begin, batch_end); break;
+    }
+  }
+  
+}
+
+void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector & prod,
+                                              CGeometry *geometry, CConfig *config) {
+  
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+  
+  if (size == SINGLE_NODE) {
+    
+    CSysMatrix_Loop loop;
+    loop.matrix = this; loop.vec = &vec; loop.prod = &prod;
+    CThreadPool::Run(ComputeLineletPreconditioner_Thread, &loop, nPointDomain*nVar);
+    
     /*--- MPI Parallelization ---*/
     
     SendReceive_Solution(prod, geometry, config);
@@ -1340,6 +2093,173 @@ void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector
   
 }
 
+void CSysMatrix::SetGalerkinOperator(const CSysMatrix & fine, CGeometry *fine_geometry) {
+  
+  unsigned long iPoint, iParent, jParent, index, index_IJ, first, last, mid, iVar;
+  const unsigned long nBlk = nVar*nEqn;
+  
+  if ((fine.nVar != nVar) || (fine.nEqn != nEqn)) {
+    cerr << "CSysMatrix::SetGalerkinOperator: the block sizes do not match." << endl;
+    throw(-1);
+  }
+  
+  SetValZero();
+  
+  /*--- The coarse points are neighbors if any of their children are, so every
+   (I,J) block is in the sparsity pattern, it is found by bisection in the sorted row ---*/
+  
+  for (iPoint = 0; iPoint < fine.nPointDomain; iPoint++) {
+    iParent = fine_geometry->node[iPoint]->GetParent_CV();
+    for (index = fine.GetRow_Ptr(iPoint); index < fine.GetRow_Ptr(iPoint+1); index++) {
+      jParent = fine_geometry->node[fine.GetCol_Ind(index)]->GetParent_CV();
+      first = GetRow_Ptr(iParent); last = GetRow_Ptr(iParent+1);
+      while (last-first > 1) {
+        mid = (first+last)/2;
+        if (GetCol_Ind(mid) <= jParent) first = mid; else last = mid;
+      }
+      index_IJ = first;
+      if (GetCol_Ind(index_IJ) != jParent) {
+        cerr << "CSysMatrix::SetGalerkinOperator: block (" << iParent << "," << jParent << ") is not in the coarse matrix." << endl;
+        throw(-1);
+      }
+      for (iVar = 0; iVar < nBlk; iVar++)
+        matrix[index_IJ*nBlk+iVar] += fine.matrix[index*nBlk+iVar];
+    }
+  }
+  
+}
+
+void CSysMatrix::Write_System(const CSysVector & rhs, CGeometry *geometry, CConfig *config, string filename) {
+  
+  unsigned long iLinelet, iPoint, index, nElem, nLines = nLinelet, header[6];
+  vector<unsigned long> *Linelets = LineletPoint, val_row_ptr(nPoint+1), val_col_ind(nnz);
+  spVec_utils SPVector;
+  FILE *fp;
+  
+  /*--- The linelets are found for the snapshot if this matrix doesn't use them ---*/
+  
+  if (LineletPoint == NULL) Linelets = FindLinelets(geometry, config, nLines);
+  
+  fp = fopen(filename.c_str(), "wb");
+  if (fp == NULL) {
+    cerr << "CSysMatrix::Write_System: unable to open " << filename << "." << endl;
+    throw(-1);
+  }
+  
+  /*--- Sizes, sparsity pattern, blocks, right hand side and linelets ---*/
+  
+  header[0] = nPoint; header[1] = nPointDomain; header[2] = nVar;
+  header[3] = nEqn;   header[4] = nnz;          header[5] = nLines;
+  fwrite(System_Tag, sizeof(char), 8, fp);
+  fwrite(header, sizeof(unsigned long), 6, fp);
+  for (iPoint = 0; iPoint < nPoint+1; iPoint++) val_row_ptr[iPoint] = GetRow_Ptr(iPoint);
+  for (index = 0; index < nnz; index++)         val_col_ind[index] = GetCol_Ind(index);
+  fwrite(&val_row_ptr[0], sizeof(unsigned long), nPoint+1, fp);
+  fwrite(&val_col_ind[0], sizeof(unsigned long), nnz, fp);
+  SPVector.bsr_write(fp, nVar*nEqn, nnz, matrix);
+  SPVector.bsr_write(fp, nVar, nPoint, &rhs[0]);
+  for (iLinelet = 0; iLinelet < nLines; iLinelet++) {
+    nElem = Linelets[iLinelet].size();
+    fwrite(&nElem, sizeof(unsigned long), 1, fp);
+    fwrite(&Linelets[iLinelet][0], sizeof(unsigned long), nElem, fp);
+  }
+  
+  fclose(fp);
+  
+  if (Linelets != LineletPoint) delete [] Linelets;
+  
+}
+
+void CSysMatrix::Read_System(CSysVector & rhs, CConfig *config, string filename) {
+  
+  char tag[8];
+  unsigned long iPoint, iLinelet, nElem, header[6], *val_row_ptr, *val_col_ind;
+  spVec_utils SPVector;
+  FILE *fp;
+  
+  fp = fopen(filename.c_str(), "rb");
+  if (fp == NULL) {
+    cerr << "CSysMatrix::Read_System: unable to open " << filename << "." << endl;
+    throw(-1);
+  }
+  
+  if ((fread(tag, sizeof(char), 8, fp) != 8) || (strncmp(tag, System_Tag, 8) != 0) ||
+      (fread(header, sizeof(unsigned long), 6, fp) != 6)) {
+    cerr << "CSysMatrix::Read_System: " << filename << " is not a snapshot of a linear system." << endl;
+    throw(-1);
+  }
+  
+  /*--- Sparsity pattern (the file always has 64-bit indices), the storage is allocated as in Initialize ---*/
+  
+  val_row_ptr = new unsigned long [header[0]+1];
+  val_col_ind = new unsigned long [header[4]];
+  if ((fread(val_row_ptr, sizeof(unsigned long), header[0]+1, fp) != header[0]+1) ||
+      (fread(val_col_ind, sizeof(unsigned long), header[4], fp) != header[4])) {
+    cerr << "CSysMatrix::Read_System: " << filename << " is truncated." << endl;
+    throw(-1);
+  }
+  SetIndexes(header[0], header[1], header[2], header[3], val_row_ptr, val_col_ind, header[4], config);
+  
+  /*--- Blocks and right hand side ---*/
+  
+  SPVector.bsr_read(fp, nVar*nEqn, nnz, matrix);
+  rhs.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  SPVector.bsr_read(fp, nVar, nPoint, &rhs[0]);
+  
+  /*--- Linelets ---*/
+  
+  nLinelet = header[5];
+  LineletBool = new bool [nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    LineletBool[iPoint] = false;
+  if (nLinelet != 0) LineletPoint = new vector<unsigned long> [nLinelet];
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
+    if (fread(&nElem, sizeof(unsigned long), 1, fp) == 1) {
+      LineletPoint[iLinelet].resize(nElem);
+      if (fread(&LineletPoint[iLinelet][0], sizeof(unsigned long), nElem, fp) == nElem) continue;
+    }
+    cerr << "CSysMatrix::Read_System: " << filename << " is truncated." << endl;
+    throw(-1);
+  }
+  SetLinelet_Batches();
+  
+  fclose(fp);
+  
+}
+
+unsigned long CSysMatrix::GetProduct_Bytes(void) {
+  
+  unsigned long index_size = (col_ind_32 != NULL ? sizeof(unsigned int) : sizeof(unsigned long));
+  
+  return nnz*nVar*nEqn*sizeof(double) + (nPointDomain+1+nnz)*index_size + 2*nPoint*nVar*sizeof(double);
+  
+}
+
+unsigned long CSysMatrix::GetPreconditioner_Bytes(unsigned short kind_prec) {
+  
+  unsigned long value_size = (((invM_flt != NULL) || (ILU_matrix_flt != NULL)) ? sizeof(float) : sizeof(double));
+  unsigned long index_size = (col_ind_32 != NULL ? sizeof(unsigned int) : sizeof(unsigned long));
+  unsigned long nBlk = nVar*nEqn, vectors = 2*nPoint*nVar*sizeof(double);
+  
+  /*--- The triangular sweeps read the factors once, their positions (sweep_ind and col_ind), and
+   the vectors in both sweeps, LU-SGS reads the diagonal blocks in both sweeps ---*/
+  
+  switch (kind_prec) {
+    case JACOBI:
+      return nPoint*nBlk*value_size + vectors;
+    case ILU:
+      return nnz*nBlk*value_size + nnz*(sizeof(unsigned long)+index_size) + 2*vectors;
+    case LU_SGS:
+      return (nnz+nPoint)*nBlk*sizeof(double) + nnz*(sizeof(unsigned long)+index_size) + 2*vectors;
+    case LINELET:
+      return nPoint*nBlk*value_size + vectors +
+      (nLineletBatch != 0 ? LineletBatch_ptr[nLineletBatch]*LINELET_LANES*3*nBlk*value_size : 0);
+  }
+  
+  return 0;
+  
+}
+
 void CSysMatrix::ComputeResidual(const CSysVector & sol, const CSysVector & f, CSysVector & res) {
   
   unsigned long iPoint, iVar;
@@ -910,6 +910,90 @@ void CUpwAUSM_Flow::ComputeResidual(double *val_residual, double **val_Jacobian_
   }
 }
 
+void CUpwAUSM_Flow::ComputeResidual_Lanes(double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                                          double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config) {
+  
+  const unsigned short L = NUMERICS_LANES;
+  unsigned short iLane;
+  double Energy_iL[L], Energy_jL[L], Area_l, UnitNormal_l[3], sq_vel_l, SoundSpeed_il, SoundSpeed_jl, ProjVelocity_il,
+  ProjVelocity_jl, mL_l, mR_l, mLP_l, mRM_l, mF_l, pLP_l, pRM_l, pF_l, Phi_l, Vel_il, Vel_jl, *Res;
+  
+  double *Velocity_iL = &val_V_i[L], *Pressure_iL = &val_V_i[(nDim+1)*L], *Density_iL = &val_V_i[(nDim+2)*L], *Enthalpy_iL = &val_V_i[(nDim+3)*L];
+  double *Velocity_jL = &val_V_j[L], *Pressure_jL = &val_V_j[(nDim+1)*L], *Density_jL = &val_V_j[(nDim+2)*L], *Enthalpy_jL = &val_V_j[(nDim+3)*L];
+  
+  /*--- The flux of each lane is the one of ComputeResidual, the branches of the split
+   Mach numbers and pressures are evaluated lane by lane ---*/
+  
+  for (iLane = 0; iLane < L; iLane++) {
+    
+    Area_l = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Area_l += val_normal[iDim*L+iLane]*val_normal[iDim*L+iLane];
+    Area_l = sqrt(Area_l);
+    for (iDim = 0; iDim < nDim; iDim++)
+      UnitNormal_l[iDim] = val_normal[iDim*L+iLane]/Area_l;
+    
+    sq_vel_l = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      sq_vel_l += Velocity_iL[iDim*L+iLane]*Velocity_iL[iDim*L+iLane];
+    Energy_iL[iLane] = Enthalpy_iL[iLane] - Pressure_iL[iLane]/Density_iL[iLane];
+    SoundSpeed_il = sqrt(Gamma*Gamma_Minus_One*(Energy_iL[iLane]-0.5*sq_vel_l));
+    
+    sq_vel_l = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      sq_vel_l += Velocity_jL[iDim*L+iLane]*Velocity_jL[iDim*L+iLane];
+    Energy_jL[iLane] = Enthalpy_jL[iLane] - Pressure_jL[iLane]/Density_jL[iLane];
+    SoundSpeed_jl = sqrt(Gamma*Gamma_Minus_One*(Energy_jL[iLane]-0.5*sq_vel_l));
+    
+    ProjVelocity_il = 0.0; ProjVelocity_jl = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      ProjVelocity_il += Velocity_iL[iDim*L+iLane]*UnitNormal_l[iDim];
+      ProjVelocity_jl += Velocity_jL[iDim*L+iLane]*UnitNormal_l[iDim];
+    }
+    
+    mL_l = ProjVelocity_il/SoundSpeed_il;
+    mR_l = ProjVelocity_jl/SoundSpeed_jl;
+    
+    if (fabs(mL_l) <= 1.0) mLP_l = 0.25*(mL_l+1.0)*(mL_l+1.0);
+    else mLP_l = 0.5*(mL_l+fabs(mL_l));
+    
+    if (fabs(mR_l) <= 1.0) mRM_l = -0.25*(mR_l-1.0)*(mR_l-1.0);
+    else mRM_l = 0.5*(mR_l-fabs(mR_l));
+    
+    mF_l = mLP_l + mRM_l;
+    
+    if (fabs(mL_l) <= 1.0) pLP_l = 0.25*Pressure_iL[iLane]*(mL_l+1.0)*(mL_l+1.0)*(2.0-mL_l);
+    else pLP_l = 0.5*Pressure_iL[iLane]*(mL_l+fabs(mL_l))/mL_l;
+    
+    if (fabs(mR_l) <= 1.0) pRM_l = 0.25*Pressure_jL[iLane]*(mR_l-1.0)*(mR_l-1.0)*(2.0+mR_l);
+    else pRM_l = 0.5*Pressure_jL[iLane]*(mR_l-fabs(mR_l))/mR_l;
+    
+    pF_l = pLP_l + pRM_l;
+    Phi_l = fabs(mF_l);
+    
+    Res = &val_residual[iLane];
+    Res[0] = 0.5*(mF_l*((Density_iL[iLane]*SoundSpeed_il)+(Density_jL[iLane]*SoundSpeed_jl))-Phi_l*((Density_jL[iLane]*SoundSpeed_jl)-(Density_iL[iLane]*SoundSpeed_il)));
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Vel_il = Velocity_iL[iDim*L+iLane]; Vel_jl = Velocity_jL[iDim*L+iLane];
+      Res[(iDim+1)*L] = 0.5*(mF_l*((Density_iL[iLane]*SoundSpeed_il*Vel_il)+(Density_jL[iLane]*SoundSpeed_jl*Vel_jl))
+                             -Phi_l*((Density_jL[iLane]*SoundSpeed_jl*Vel_jl)-(Density_iL[iLane]*SoundSpeed_il*Vel_il)))+UnitNormal_l[iDim]*pF_l;
+    }
+    Res[(nVar-1)*L] = 0.5*(mF_l*((Density_iL[iLane]*SoundSpeed_il*Enthalpy_iL[iLane])+(Density_jL[iLane]*SoundSpeed_jl*Enthalpy_jL[iLane]))
+                           -Phi_l*((Density_jL[iLane]*SoundSpeed_jl*Enthalpy_jL[iLane])-(Density_iL[iLane]*SoundSpeed_il*Enthalpy_iL[iLane])));
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      Res[iVar*L] *= Area_l;
+    
+  }
+  
+  /*--- Roe's Jacobian for AUSM ---*/
+  
+  if (implicit)
+    GetRoeJacobians_Lanes(Density_iL, Velocity_iL, Enthalpy_iL, Energy_iL, Density_jL, Velocity_jL, Enthalpy_jL, Energy_jL,
+                          val_normal, val_Jacobian_i, val_Jacobian_j);
+  
+}
+
 CUpwHLLC_Flow::CUpwHLLC_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
   
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -1126,6 +1210,116 @@ void CUpwHLLC_Flow::ComputeResidual(double *val_residual, double **val_Jacobian_
   
 }
 
+void CUpwHLLC_Flow::ComputeResidual_Lanes(double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                                          double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config) {
+  
+  const unsigned short L = NUMERICS_LANES;
+  unsigned short iLane;
+  double Energy_iL[L], Energy_jL[L], Area_l, UnitNormal_l[3], sq_vel_il, sq_vel_jl, SoundSpeed_il, SoundSpeed_jl,
+  ProjVelocity_il, ProjVelocity_jl, Rrho_l, tmp_l, velRoe_l[3], uRoe_l, gamPdivRho_l, sq_velRoe_l, cRoe_l, sL_l, sR_l,
+  sM_l, pStar_l, invSmSs_l, smu_l, rhoS_l, rhouS_l[3], eS_l, Density_l, Pressure_l, Energy_l, ProjVelocity_l, *Velocity_l, *Res;
+  
+  double *Velocity_iL = &val_V_i[L], *Pressure_iL = &val_V_i[(nDim+1)*L], *Density_iL = &val_V_i[(nDim+2)*L], *Enthalpy_iL = &val_V_i[(nDim+3)*L];
+  double *Velocity_jL = &val_V_j[L], *Pressure_jL = &val_V_j[(nDim+1)*L], *Density_jL = &val_V_j[(nDim+2)*L], *Enthalpy_jL = &val_V_j[(nDim+3)*L];
+  
+  /*--- The flux of each lane is the one of ComputeResidual, the four regions of the wave
+   fan are evaluated lane by lane (the two star regions share the same expressions) ---*/
+  
+  for (iLane = 0; iLane < L; iLane++) {
+    
+    Area_l = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Area_l += val_normal[iDim*L+iLane]*val_normal[iDim*L+iLane];
+    Area_l = sqrt(Area_l);
+    for (iDim = 0; iDim < nDim; iDim++)
+      UnitNormal_l[iDim] = val_normal[iDim*L+iLane]/Area_l;
+    
+    sq_vel_il = 0.0; sq_vel_jl = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      sq_vel_il += Velocity_iL[iDim*L+iLane]*Velocity_iL[iDim*L+iLane];
+      sq_vel_jl += Velocity_jL[iDim*L+iLane]*Velocity_jL[iDim*L+iLane];
+    }
+    Energy_iL[iLane] = Enthalpy_iL[iLane] - Pressure_iL[iLane]/Density_iL[iLane];
+    Energy_jL[iLane] = Enthalpy_jL[iLane] - Pressure_jL[iLane]/Density_jL[iLane];
+    SoundSpeed_il = sqrt(Gamma*Gamma_Minus_One*(Energy_iL[iLane]-0.5*sq_vel_il));
+    SoundSpeed_jl = sqrt(Gamma*Gamma_Minus_One*(Energy_jL[iLane]-0.5*sq_vel_jl));
+    
+    ProjVelocity_il = 0.0; ProjVelocity_jl = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      ProjVelocity_il += Velocity_iL[iDim*L+iLane]*UnitNormal_l[iDim];
+      ProjVelocity_jl += Velocity_jL[iDim*L+iLane]*UnitNormal_l[iDim];
+    }
+    
+    /*--- Roe's averaging ---*/
+    
+    Rrho_l = sqrt(Density_jL[iLane]/Density_iL[iLane]);
+    tmp_l = 1.0/(1.0+Rrho_l);
+    uRoe_l = 0.0; sq_velRoe_l = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      velRoe_l[iDim] = tmp_l*(Velocity_iL[iDim*L+iLane] + Velocity_jL[iDim*L+iLane]*Rrho_l);
+      uRoe_l += velRoe_l[iDim]*UnitNormal_l[iDim];
+      sq_velRoe_l += velRoe_l[iDim]*velRoe_l[iDim];
+    }
+    gamPdivRho_l = tmp_l*((Gamma*Pressure_iL[iLane]/Density_iL[iLane]+0.5*(Gamma-1.0)*sq_vel_il) + (Gamma*Pressure_jL[iLane]/Density_jL[iLane]+0.5*(Gamma-1.0)*sq_vel_jl)*Rrho_l);
+    cRoe_l = sqrt(gamPdivRho_l - ((Gamma+Gamma)*0.5-1.0)*0.5*sq_velRoe_l);
+    
+    /*--- Wave speeds, speed of the contact surface and pressure of the star region ---*/
+    
+    sL_l = min(uRoe_l-cRoe_l, ProjVelocity_il-SoundSpeed_il);
+    sR_l = max(uRoe_l+cRoe_l, ProjVelocity_jl+SoundSpeed_jl);
+    
+    sM_l = (Pressure_iL[iLane]-Pressure_jL[iLane]
+            - Density_iL[iLane]*ProjVelocity_il*(sL_l-ProjVelocity_il)
+            + Density_jL[iLane]*ProjVelocity_jl*(sR_l-ProjVelocity_jl))
+    /(Density_jL[iLane]*(sR_l-ProjVelocity_jl)-Density_iL[iLane]*(sL_l-ProjVelocity_il));
+    
+    pStar_l = Density_jL[iLane] * (ProjVelocity_jl-sR_l)*(ProjVelocity_jl-sM_l) + Pressure_jL[iLane];
+    
+    /*--- Upwind side of the contact surface ---*/
+    
+    if (sM_l >= 0.0) {
+      Density_l = Density_iL[iLane]; Pressure_l = Pressure_iL[iLane]; Energy_l = Energy_iL[iLane];
+      ProjVelocity_l = ProjVelocity_il; Velocity_l = &Velocity_iL[iLane]; smu_l = sL_l;
+    }
+    else {
+      Density_l = Density_jL[iLane]; Pressure_l = Pressure_jL[iLane]; Energy_l = Energy_jL[iLane];
+      ProjVelocity_l = ProjVelocity_jl; Velocity_l = &Velocity_jL[iLane]; smu_l = sR_l;
+    }
+    
+    Res = &val_residual[iLane];
+    if ((sM_l >= 0.0) ? (sL_l > 0.0) : (sR_l < 0.0)) {
+      Res[0] = Density_l*ProjVelocity_l;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Res[(iDim+1)*L] = Density_l*Velocity_l[iDim*L]*ProjVelocity_l + Pressure_l*UnitNormal_l[iDim];
+      Res[(nVar-1)*L] = Energy_l*Density_l*ProjVelocity_l + Pressure_l*ProjVelocity_l;
+    }
+    else {
+      invSmSs_l = 1.0/(smu_l-sM_l);
+      smu_l = smu_l-ProjVelocity_l;
+      rhoS_l = Density_l*smu_l*invSmSs_l;
+      for (iDim = 0; iDim < nDim; iDim++)
+        rhouS_l[iDim] = (Density_l*Velocity_l[iDim*L]*smu_l+(pStar_l-Pressure_l)*UnitNormal_l[iDim])*invSmSs_l;
+      eS_l = (smu_l*Energy_l*Density_l-Pressure_l*ProjVelocity_l+pStar_l*sM_l)*invSmSs_l;
+      
+      Res[0] = rhoS_l*sM_l;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Res[(iDim+1)*L] = rhouS_l[iDim]*sM_l + pStar_l*UnitNormal_l[iDim];
+      Res[(nVar-1)*L] = (eS_l+pStar_l)*sM_l;
+    }
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      Res[iVar*L] *= Area_l;
+    
+  }
+  
+  /*--- Roe's Jacobian for HLLC ---*/
+  
+  if (implicit)
+    GetRoeJacobians_Lanes(Density_iL, Velocity_iL, Enthalpy_iL, Energy_iL, Density_jL, Velocity_jL, Enthalpy_jL, Energy_jL,
+                          val_normal, val_Jacobian_i, val_Jacobian_j);
+  
+}
+
 CUpwRoe_Flow::CUpwRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
   
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -1365,6 +1559,147 @@ void CUpwRoe_Flow::ComputeResidual(double *val_residual, double **val_Jacobian_i
   
 }
 
+void CUpwRoe_Flow::ComputeResidual_Lanes(double *val_V_i, double *val_V_j, double *val_normal, double *val_residual,
+                                         double *val_Jacobian_i, double *val_Jacobian_j, CConfig *config) {
+  
+  const unsigned short L = NUMERICS_LANES;
+  unsigned short iLane;
+  double AreaL[L], UnitNormalL[3*L], Energy_iL[L], Energy_jL[L], U_iL[5*L], U_jL[5*L], RL[L], RoeDensityL[L],
+  RoeVelocityL[3*L], RoeEnthalpyL[L], RoeSoundSpeedL[L], sq_velL[L], ProjVelocityL[L], LambdaL[5*L],
+  ProjFlux_iL[5*L], ProjFlux_jL[5*L], P_TensorL[25*L], invP_TensorL[25*L], AbsJacL[25*L], delta_velL[3*L],
+  delta_waveL[5*L], proj_delta_velL[L], delta_pL[L], delta_rhoL[L], Diff_UL[5*L];
+  
+  /*--- Primitive variables of the lanes (the velocity starts at the second variable) ---*/
+  
+  double *Velocity_iL = &val_V_i[L], *Pressure_iL = &val_V_i[(nDim+1)*L], *Density_iL = &val_V_i[(nDim+2)*L], *Enthalpy_iL = &val_V_i[(nDim+3)*L];
+  double *Velocity_jL = &val_V_j[L], *Pressure_jL = &val_V_j[(nDim+1)*L], *Density_jL = &val_V_j[(nDim+2)*L], *Enthalpy_jL = &val_V_j[(nDim+3)*L];
+  
+  /*--- Face area and unit normal ---*/
+  
+  for (iLane = 0; iLane < L; iLane++) AreaL[iLane] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < L; iLane++)
+      AreaL[iLane] += val_normal[iDim*L+iLane]*val_normal[iDim*L+iLane];
+  for (iLane = 0; iLane < L; iLane++) AreaL[iLane] = sqrt(AreaL[iLane]);
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < L; iLane++)
+      UnitNormalL[iDim*L+iLane] = val_normal[iDim*L+iLane]/AreaL[iLane];
+  
+  /*--- Energy and conservative variables ---*/
+  
+  for (iLane = 0; iLane < L; iLane++) {
+    Energy_iL[iLane] = Enthalpy_iL[iLane] - Pressure_iL[iLane]/Density_iL[iLane];
+    Energy_jL[iLane] = Enthalpy_jL[iLane] - Pressure_jL[iLane]/Density_jL[iLane];
+    U_iL[iLane] = Density_iL[iLane]; U_jL[iLane] = Density_jL[iLane];
+    U_iL[(nDim+1)*L+iLane] = Density_iL[iLane]*Energy_iL[iLane]; U_jL[(nDim+1)*L+iLane] = Density_jL[iLane]*Energy_jL[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < L; iLane++) {
+      U_iL[(iDim+1)*L+iLane] = Density_iL[iLane]*Velocity_iL[iDim*L+iLane];
+      U_jL[(iDim+1)*L+iLane] = Density_jL[iLane]*Velocity_jL[iDim*L+iLane];
+    }
+  
+  /*--- Roe-averaged variables at interface between i & j ---*/
+  
+  for (iLane = 0; iLane < L; iLane++) {
+    RL[iLane] = sqrt(fabs(Density_jL[iLane]/Density_iL[iLane]));
+    RoeDensityL[iLane] = RL[iLane]*Density_iL[iLane];
+    RoeEnthalpyL[iLane] = (RL[iLane]*Enthalpy_jL[iLane]+Enthalpy_iL[iLane])/(RL[iLane]+1);
+    sq_velL[iLane] = 0.0; ProjVelocityL[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < L; iLane++) {
+      RoeVelocityL[iDim*L+iLane] = (RL[iLane]*Velocity_jL[iDim*L+iLane]+Velocity_iL[iDim*L+iLane])/(RL[iLane]+1);
+      sq_velL[iLane] += RoeVelocityL[iDim*L+iLane]*RoeVelocityL[iDim*L+iLane];
+      ProjVelocityL[iLane] += RoeVelocityL[iDim*L+iLane]*UnitNormalL[iDim*L+iLane];
+    }
+  for (iLane = 0; iLane < L; iLane++)
+    RoeSoundSpeedL[iLane] = sqrt((Gamma-1)*(RoeEnthalpyL[iLane]-0.5*sq_velL[iLane]));
+  
+  /*--- Projected fluxes, P (and P^{-1}) and absolute value of the eigenvalues ---*/
+  
+  GetInviscidProjFlux_Lanes(Density_iL, Velocity_iL, Pressure_iL, Enthalpy_iL, val_normal, ProjFlux_iL);
+  GetInviscidProjFlux_Lanes(Density_jL, Velocity_jL, Pressure_jL, Enthalpy_jL, val_normal, ProjFlux_jL);
+  GetPMatrix_Lanes(RoeDensityL, RoeVelocityL, RoeSoundSpeedL, UnitNormalL, P_TensorL, (implicit ? invP_TensorL : NULL));
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < L; iLane++)
+      LambdaL[iDim*L+iLane] = fabs(ProjVelocityL[iLane]);
+  for (iLane = 0; iLane < L; iLane++) {
+    LambdaL[(nVar-2)*L+iLane] = fabs(ProjVelocityL[iLane] + RoeSoundSpeedL[iLane]);
+    LambdaL[(nVar-1)*L+iLane] = fabs(ProjVelocityL[iLane] - RoeSoundSpeedL[iLane]);
+  }
+  
+  if (!implicit) {
+    
+    /*--- Compute wave amplitudes (characteristics) ---*/
+    
+    for (iLane = 0; iLane < L; iLane++) proj_delta_velL[iLane] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      for (iLane = 0; iLane < L; iLane++) {
+        delta_velL[iDim*L+iLane] = Velocity_jL[iDim*L+iLane] - Velocity_iL[iDim*L+iLane];
+        proj_delta_velL[iLane] += delta_velL[iDim*L+iLane]*val_normal[iDim*L+iLane];
+      }
+    
+    for (iLane = 0; iLane < L; iLane++) {
+      delta_pL[iLane] = Pressure_jL[iLane] - Pressure_iL[iLane];
+      delta_rhoL[iLane] = Density_jL[iLane] - Density_iL[iLane];
+      proj_delta_velL[iLane] = proj_delta_velL[iLane]/AreaL[iLane];
+      delta_waveL[iLane] = delta_rhoL[iLane] - delta_pL[iLane]/(RoeSoundSpeedL[iLane]*RoeSoundSpeedL[iLane]);
+      delta_waveL[(nVar-2)*L+iLane] = proj_delta_velL[iLane] + delta_pL[iLane]/(RoeDensityL[iLane]*RoeSoundSpeedL[iLane]);
+      delta_waveL[(nVar-1)*L+iLane] = -proj_delta_velL[iLane] + delta_pL[iLane]/(RoeDensityL[iLane]*RoeSoundSpeedL[iLane]);
+    }
+    if (nDim == 2) {
+      for (iLane = 0; iLane < L; iLane++)
+        delta_waveL[L+iLane] = UnitNormalL[L+iLane]*delta_velL[iLane]-UnitNormalL[iLane]*delta_velL[L+iLane];
+    }
+    else {
+      for (iLane = 0; iLane < L; iLane++) {
+        delta_waveL[L+iLane] = UnitNormalL[iLane]*delta_velL[2*L+iLane]-UnitNormalL[2*L+iLane]*delta_velL[iLane];
+        delta_waveL[2*L+iLane] = UnitNormalL[L+iLane]*delta_velL[iLane]-UnitNormalL[iLane]*delta_velL[L+iLane];
+      }
+    }
+    
+    /*--- Roe's Flux approximation ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (iLane = 0; iLane < L; iLane++)
+        val_residual[iVar*L+iLane] = 0.5*(ProjFlux_iL[iVar*L+iLane]+ProjFlux_jL[iVar*L+iLane]);
+      for (jVar = 0; jVar < nVar; jVar++)
+        for (iLane = 0; iLane < L; iLane++)
+          val_residual[iVar*L+iLane] -= 0.5*LambdaL[jVar*L+iLane]*delta_waveL[jVar*L+iLane]*P_TensorL[(iVar*nVar+jVar)*L+iLane]*AreaL[iLane];
+    }
+    
+  }
+  else {
+    
+    /*--- Jacobians of the inviscid flux, scaled by 0.5 because val_resconv ~ 0.5*(fc_i+fc_j)*Normal ---*/
+    
+    GetInviscidProjJac_Lanes(Velocity_iL, Energy_iL, val_normal, 0.5, val_Jacobian_i);
+    GetInviscidProjJac_Lanes(Velocity_jL, Energy_jL, val_normal, 0.5, val_Jacobian_j);
+    GetAbsJacobian_Lanes(P_TensorL, LambdaL, invP_TensorL, AbsJacL);
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (iLane = 0; iLane < L; iLane++)
+        Diff_UL[iVar*L+iLane] = U_jL[iVar*L+iLane]-U_iL[iVar*L+iLane];
+    
+    /*--- Roe's Flux approximation ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (iLane = 0; iLane < L; iLane++)
+        val_residual[iVar*L+iLane] = 0.5*(ProjFlux_iL[iVar*L+iLane]+ProjFlux_jL[iVar*L+iLane]);
+      for (jVar = 0; jVar < nVar; jVar++)
+        for (iLane = 0; iLane < L; iLane++) {
+          val_residual[iVar*L+iLane] -= 0.5*AbsJacL[(iVar*nVar+jVar)*L+iLane]*Diff_UL[jVar*L+iLane]*AreaL[iLane];
+          val_Jacobian_i[(iVar*nVar+jVar)*L+iLane] += 0.5*AbsJacL[(iVar*nVar+jVar)*L+iLane]*AreaL[iLane];
+          val_Jacobian_j[(iVar*nVar+jVar)*L+iLane] -= 0.5*AbsJacL[(iVar*nVar+jVar)*L+iLane]*AreaL[iLane];
+        }
+    }
+    
+  }
+  
+}
+
 CUpwMSW_Flow::CUpwMSW_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
   
   /*--- Set booleans from CConfig settings ---*/
@@ -2397,14 +2732,27 @@ CAvgGrad_Flow::~CAvgGrad_Flow(void) {
 
 void CAvgGrad_Flow::ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, CConfig *config) {
   
-  /*--- Normalized normal vector ---*/
-  Area = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
-    Area += Normal[iDim]*Normal[iDim];
-  Area = sqrt(Area);
-  
-  for (iDim = 0; iDim < nDim; iDim++)
-    UnitNormal[iDim] = Normal[iDim]/Area;
+  /*--- Normalized normal vector, and length of the edge (stored by the geometry on the edge loops) ---*/
+  if (Edge_Geometry != NULL) {
+    Area = Edge_Geometry[nDim];
+    for (iDim = 0; iDim < nDim; iDim++)
+      UnitNormal[iDim] = Edge_Geometry[iDim];
+    dist_ij = Edge_Geometry[2*nDim+1];
+  }
+  else {
+    Area = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Area += Normal[iDim]*Normal[iDim];
+    Area = sqrt(Area);
+    
+    for (iDim = 0; iDim < nDim; iDim++)
+      UnitNormal[iDim] = Normal[iDim]/Area;
+    
+    dist_ij = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      dist_ij += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+    dist_ij = sqrt(dist_ij);
+  }
   
   for (iVar = 0; iVar < nDim+3; iVar++) {
     PrimVar_i[iVar] = V_i[iVar];
@@ -2437,10 +2785,6 @@ void CAvgGrad_Flow::ComputeResidual(double *val_residual, double **val_Jacobian_
   
   /*--- Compute the implicit part ---*/
   if (implicit) {
-    dist_ij = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      dist_ij += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-    dist_ij = sqrt(dist_ij);
     
     if (dist_ij == 0.0) {
       
@@ -2587,20 +2931,35 @@ CAvgGradCorrected_Flow::~CAvgGradCorrected_Flow(void) {
 
 void CAvgGradCorrected_Flow::ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, CConfig *config) {
   
-  /*--- Normalized normal vector ---*/
-  Area = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
-    Area += Normal[iDim]*Normal[iDim];
-  Area = sqrt(Area);
-  
-  for (iDim = 0; iDim < nDim; iDim++)
-    UnitNormal[iDim] = Normal[iDim]/Area;
+  double dist_ij, inv_dist_ij_2;
   
-  /*--- Compute vector going from iPoint to jPoint ---*/
-  dist_ij_2 = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-    dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
+  /*--- Normalized normal vector, vector going from iPoint to jPoint, its length and
+   the inverse of its squared length (stored by the geometry on the edge loops) ---*/
+  if (Edge_Geometry != NULL) {
+    Area = Edge_Geometry[nDim];
+    for (iDim = 0; iDim < nDim; iDim++) {
+      UnitNormal[iDim] = Edge_Geometry[iDim];
+      Edge_Vector[iDim] = Edge_Geometry[nDim+1+iDim];
+    }
+    dist_ij = Edge_Geometry[2*nDim+1];
+    inv_dist_ij_2 = Edge_Geometry[2*nDim+2];
+  }
+  else {
+    Area = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Area += Normal[iDim]*Normal[iDim];
+    Area = sqrt(Area);
+    
+    for (iDim = 0; iDim < nDim; iDim++)
+      UnitNormal[iDim] = Normal[iDim]/Area;
+    
+    dist_ij_2 = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
+      dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
+    }
+    dist_ij = sqrt(dist_ij_2);
+    inv_dist_ij_2 = (dist_ij_2 != 0.0) ? 1.0/dist_ij_2 : 0.0;
   }
   
   /*--- Laminar and Eddy viscosity ---*/
@@ -2625,10 +2984,10 @@ void CAvgGradCorrected_Flow::ComputeResidual(double *val_residual, double **val_
       Mean_GradPrimVar[iVar][iDim] = 0.5*(PrimVar_Grad_i[iVar][iDim] + PrimVar_Grad_j[iVar][iDim]);
       Proj_Mean_GradPrimVar_Edge[iVar] += Mean_GradPrimVar[iVar][iDim]*Edge_Vector[iDim];
     }
-    if (dist_ij_2 != 0.0) {
+    if (inv_dist_ij_2 != 0.0) {
       for (iDim = 0; iDim < nDim; iDim++) {
         Mean_GradPrimVar[iVar][iDim] -= (Proj_Mean_GradPrimVar_Edge[iVar] -
-                                         (PrimVar_j[iVar]-PrimVar_i[iVar]))*Edge_Vector[iDim] / dist_ij_2;
+                                         (PrimVar_j[iVar]-PrimVar_i[iVar]))*Edge_Vector[iDim]*inv_dist_ij_2;
       }
     }
   }
@@ -2643,7 +3002,7 @@ void CAvgGradCorrected_Flow::ComputeResidual(double *val_residual, double **val_
   /*--- Compute the implicit part ---*/
   if (implicit) {
     
-    if (dist_ij_2 == 0.0) {
+    if (dist_ij == 0.0) {
       for (iVar = 0; iVar < nVar; iVar++) {
         for (jVar = 0; jVar < nVar; jVar++) {
           val_Jacobian_i[iVar][jVar] = 0.0;
@@ -2653,7 +3012,7 @@ void CAvgGradCorrected_Flow::ComputeResidual(double *val_residual, double **val_
     }
     else {
       GetViscousProjJacs(Mean_PrimVar, Mean_Laminar_Viscosity, Mean_Eddy_Viscosity,
-                         sqrt(dist_ij_2), UnitNormal, Area, Proj_Flux_Tensor, val_Jacobian_i, val_Jacobian_j);
+                         dist_ij, UnitNormal, Area, Proj_Flux_Tensor, val_Jacobian_i, val_Jacobian_j);
     }
     
   }
@@ -110,16 +110,23 @@ void CAvgGrad_TurbSA::ComputeResidual(double *val_residual, double **Jacobian_i,
   nu_j = Laminar_Viscosity_j/Density_j;
   nu_e = 0.5*(nu_i+nu_j+TurbVar_i[0]+TurbVar_j[0]);
   
-  /*--- Compute vector going from iPoint to jPoint ---*/
+  /*--- Compute vector going from iPoint to jPoint (stored by the geometry on the edge loops) ---*/
   
-  dist_ij_2 = 0; proj_vector_ij = 0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-    dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-    proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
+  if (Edge_Geometry != NULL) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Edge_Vector[iDim] = Edge_Geometry[nDim+1+iDim];
+    proj_vector_ij = Edge_Geometry[2*nDim+3];
+  }
+  else {
+    dist_ij_2 = 0; proj_vector_ij = 0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
+      dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
+      proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
+    }
+    if (dist_ij_2 == 0.0) proj_vector_ij = 0.0;
+    else proj_vector_ij = proj_vector_ij/dist_ij_2;
   }
-  if (dist_ij_2 == 0.0) proj_vector_ij = 0.0;
-  else proj_vector_ij = proj_vector_ij/dist_ij_2;
   
   /*--- Mean gradient approximation ---*/
   
@@ -186,16 +193,23 @@ void CAvgGradCorrected_TurbSA::ComputeResidual(double *val_residual, double **Ja
   nu_j = Laminar_Viscosity_j/Density_j;
   nu_e = 0.5*(nu_i+nu_j+TurbVar_i[0]+TurbVar_j[0]);
   
-  /*--- Compute vector going from iPoint to jPoint ---*/
+  /*--- Compute vector going from iPoint to jPoint (stored by the geometry on the edge loops) ---*/
   
-  dist_ij_2 = 0; proj_vector_ij = 0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-    dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-    proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
+  if (Edge_Geometry != NULL) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Edge_Vector[iDim] = Edge_Geometry[nDim+1+iDim];
+    proj_vector_ij = Edge_Geometry[2*nDim+3];
+  }
+  else {
+    dist_ij_2 = 0; proj_vector_ij = 0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
+      dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
+      proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
+    }
+    if (dist_ij_2 == 0.0) proj_vector_ij = 0.0;
+    else proj_vector_ij = proj_vector_ij/dist_ij_2;
   }
-  if (dist_ij_2 == 0.0) proj_vector_ij = 0.0;
-  else proj_vector_ij = proj_vector_ij/dist_ij_2;
   
   /*--- Mean gradient approximation. Projection of the mean gradient
    in the direction of the edge ---*/
@@ -457,15 +471,22 @@ void CAvgGrad_TurbSST::ComputeResidual(double *val_residual, double **Jacobian_i
   diff_kine  = 0.5*(diff_i_kine + diff_j_kine);    // Could instead use weighted average!
   diff_omega = 0.5*(diff_i_omega + diff_j_omega);
   
-  /*--- Compute vector going from iPoint to jPoint ---*/
-  dist_ij_2 = 0; proj_vector_ij = 0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-    dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-    proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
+  /*--- Compute vector going from iPoint to jPoint (stored by the geometry on the edge loops) ---*/
+  if (Edge_Geometry != NULL) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Edge_Vector[iDim] = Edge_Geometry[nDim+1+iDim];
+    proj_vector_ij = Edge_Geometry[2*nDim+3];
+  }
+  else {
+    dist_ij_2 = 0; proj_vector_ij = 0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
+      dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
+      proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
+    }
+    if (dist_ij_2 == 0.0) proj_vector_ij = 0.0;
+    else proj_vector_ij = proj_vector_ij/dist_ij_2;
   }
-  if (dist_ij_2 == 0.0) proj_vector_ij = 0.0;
-  else proj_vector_ij = proj_vector_ij/dist_ij_2;
   
   /*--- Mean gradient approximation. Projection of the mean gradient in the direction of the edge ---*/
   for (iVar = 0; iVar < nVar; iVar++) {
@@ -552,15 +573,22 @@ void CAvgGradCorrected_TurbSST::ComputeResidual(double *val_residual, double **J
   diff_kine  = 0.5*(diff_i_kine + diff_j_kine);    // Could instead use weighted average!
   diff_omega = 0.5*(diff_i_omega + diff_j_omega);
   
-  /*--- Compute vector going from iPoint to jPoint ---*/
-  dist_ij_2 = 0.0; proj_vector_ij = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-    dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-    proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
+  /*--- Compute vector going from iPoint to jPoint (stored by the geometry on the edge loops) ---*/
+  if (Edge_Geometry != NULL) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Edge_Vector[iDim] = Edge_Geometry[nDim+1+iDim];
+    proj_vector_ij = Edge_Geometry[2*nDim+3];
+  }
+  else {
+    dist_ij_2 = 0.0; proj_vector_ij = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
+      dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
+      proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
+    }
+    if (dist_ij_2 == 0.0) proj_vector_ij = 0.0;
+    else proj_vector_ij = proj_vector_ij/dist_ij_2;
   }
-  if (dist_ij_2 == 0.0) proj_vector_ij = 0.0;
-  else proj_vector_ij = proj_vector_ij/dist_ij_2;
   
   /*--- Mean gradient approximation. Projection of the mean gradient in the direction of the edge ---*/
   for (iVar = 0; iVar < nVar; iVar++) {
@@ -22,7 +22,13 @@
 
 #include "../include/numerics_structure.hpp"
 
-CNumerics::CNumerics(void) { }
+CNumerics::CNumerics(void) {
+
+  Thread_Numerics = NULL;
+  nThread_Numerics = 0;
+  Edge_Geometry = NULL;
+
+}
 
 CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
                      CConfig *config) {
@@ -31,6 +37,11 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
 	Gamma = config->GetGamma();
 	Gamma_Minus_One = Gamma - 1.0;
 	Gas_Constant = config->GetGas_ConstantND();
+	implicit = false;
+
+  Thread_Numerics = NULL;
+  nThread_Numerics = 0;
+  Edge_Geometry = NULL;
 
 	//U_id = new double [nVar];
 	//U_jd = new double [nVar];
@@ -85,6 +96,12 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
 
 CNumerics::~CNumerics(void) {
 
+  if (Thread_Numerics != NULL) {
+    for (unsigned short iThread = 1; iThread < nThread_Numerics; iThread++)
+      delete Thread_Numerics[iThread];
+    delete [] Thread_Numerics;
+  }
+
   delete [] Normal;
 	delete [] UnitNormal;
 
@@ -667,6 +684,18 @@ void CNumerics::GetInviscidArtComp_FreeSurf_ProjJac(double *val_density, double
   
 }
 
+void CNumerics::SetThread_Numerics(unsigned short val_nThread, CNumerics **val_numerics) {
+  
+  if (val_numerics[0] != this) {
+    cerr << "CNumerics::SetThread_Numerics: the numerics of the first thread must be the object itself." << endl;
+    exit(1);
+  }
+  
+  Thread_Numerics = val_numerics;
+  nThread_Numerics = val_nThread;
+  
+}
+
 void CNumerics::SetPastSol (double *val_u_nM1, double *val_u_n, double *val_u_nP1) {
 	unsigned short iVar;
 
@@ -914,6 +943,286 @@ void CNumerics::GetPMatrix_inv(double *val_density, double *val_velocity,
 }
 
 
+/*--- The lane versions repeat the operations of the scalar ones, so a batch of edges gives the
+ same values as the edges one by one. The innermost loops run over the lanes (or the whole body
+ of a lane is straight-line code) so the compiler can vectorize them ---*/
+
+void CNumerics::GetInviscidProjFlux_Lanes(double *val_density, double *val_velocity, double *val_pressure,
+                                          double *val_enthalpy, double *val_normal, double *val_Proj_Flux) {
+  
+  const unsigned short L = NUMERICS_LANES;
+  unsigned short iDim, jDim, iVar, iLane;
+  double rhou, Delta;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (iLane = 0; iLane < L; iLane++)
+      val_Proj_Flux[iVar*L+iLane] = 0.0;
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < L; iLane++) {
+      rhou = val_density[iLane]*val_velocity[iDim*L+iLane];
+      val_Proj_Flux[iLane] += rhou*val_normal[iDim*L+iLane];
+      for (jDim = 0; jDim < nDim; jDim++) {
+        Delta = (iDim == jDim ? 1.0 : 0.0);
+        val_Proj_Flux[(jDim+1)*L+iLane] += (rhou*val_velocity[jDim*L+iLane]+Delta*val_pressure[iLane])*val_normal[iDim*L+iLane];
+      }
+      val_Proj_Flux[(nDim+1)*L+iLane] += rhou*val_enthalpy[iLane]*val_normal[iDim*L+iLane];
+    }
+  }
+  
+}
+
+void CNumerics::GetInviscidProjJac_Lanes(double *val_velocity, double *val_energy, double *val_normal,
+                                         double val_scale, double *val_Proj_Jac_Tensor) {
+  
+  const unsigned short L = NUMERICS_LANES;
+  unsigned short iDim, jDim, iLane;
+  double sqvel[NUMERICS_LANES], proj_vel[NUMERICS_LANES], phi, a1, a2 = Gamma-1.0, *Jac;
+  
+  for (iLane = 0; iLane < L; iLane++) {
+    sqvel[iLane] = 0.0; proj_vel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < L; iLane++) {
+      sqvel[iLane]    += val_velocity[iDim*L+iLane]*val_velocity[iDim*L+iLane];
+      proj_vel[iLane] += val_velocity[iDim*L+iLane]*val_normal[iDim*L+iLane];
+    }
+  
+  for (iLane = 0; iLane < L; iLane++) {
+    
+    Jac = &val_Proj_Jac_Tensor[iLane];
+    phi = 0.5*Gamma_Minus_One*sqvel[iLane];
+    a1 = Gamma*val_energy[iLane]-phi;
+    
+    Jac[0] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Jac[(iDim+1)*L] = val_scale*val_normal[iDim*L+iLane];
+    Jac[(nDim+1)*L] = 0.0;
+    
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Jac[((iDim+1)*nVar)*L] = val_scale*(val_normal[iDim*L+iLane]*phi - val_velocity[iDim*L+iLane]*proj_vel[iLane]);
+      for (jDim = 0; jDim < nDim; jDim++)
+        Jac[((iDim+1)*nVar+jDim+1)*L] = val_scale*(val_normal[jDim*L+iLane]*val_velocity[iDim*L+iLane]-a2*val_normal[iDim*L+iLane]*val_velocity[jDim*L+iLane]);
+      Jac[((iDim+1)*nVar+iDim+1)*L] += val_scale*proj_vel[iLane];
+      Jac[((iDim+1)*nVar+nDim+1)*L] = val_scale*a2*val_normal[iDim*L+iLane];
+    }
+    
+    Jac[((nDim+1)*nVar)*L] = val_scale*proj_vel[iLane]*(phi-a1);
+    for (iDim = 0; iDim < nDim; iDim++)
+      Jac[((nDim+1)*nVar+iDim+1)*L] = val_scale*(val_normal[iDim*L+iLane]*a1-a2*val_velocity[iDim*L+iLane]*proj_vel[iLane]);
+    Jac[((nDim+1)*nVar+nDim+1)*L] = val_scale*Gamma*proj_vel[iLane];
+    
+  }
+  
+}
+
+void CNumerics::GetPMatrix_Lanes(double *val_density, double *val_velocity, double *val_soundspeed,
+                                 double *val_normal, double *val_p_tensor, double *val_invp_tensor) {
+  
+  const unsigned short L = NUMERICS_LANES;
+  unsigned short iLane;
+  double rho, c, rhooc, rhoxc, c2, gm1 = Gamma_Minus_One, k0orho, k1orho, gm1_o_c2, gm1_o_rhoxc, sqvel,
+  u0, u1, u2, n0, n1, n2, *P, *invP;
+  
+  if (nDim == 2) {
+    for (iLane = 0; iLane < L; iLane++) {
+      
+      rho = val_density[iLane]; c = val_soundspeed[iLane];
+      u0 = val_velocity[iLane]; u1 = val_velocity[L+iLane];
+      n0 = val_normal[iLane]; n1 = val_normal[L+iLane];
+      rhooc = rho/c; rhoxc = rho*c; c2 = c*c;
+      sqvel = u0*u0+u1*u1;
+      
+      P = &val_p_tensor[iLane];
+        P[ 0*L] = 1.0;
+        P[ 1*L] = 0.0;
+        P[ 2*L] = 0.5*rhooc;
+        P[ 3*L] = 0.5*rhooc;
+        P[ 4*L] = u0;
+        P[ 5*L] = rho*n1;
+        P[ 6*L] = 0.5*(u0*rhooc+n0*rho);
+        P[ 7*L] = 0.5*(u0*rhooc-n0*rho);
+        P[ 8*L] = u1;
+        P[ 9*L] = -rho*n0;
+        P[10*L] = 0.5*(u1*rhooc+n1*rho);
+        P[11*L] = 0.5*(u1*rhooc-n1*rho);
+        P[12*L] = 0.5*sqvel;
+        P[13*L] = rho*u0*n1-rho*u1*n0;
+        P[14*L] = 0.5*(0.5*sqvel*rhooc+rho*u0*n0+rho*u1*n1+rhoxc/Gamma_Minus_One);
+        P[15*L] = 0.5*(0.5*sqvel*rhooc-rho*u0*n0-rho*u1*n1+rhoxc/Gamma_Minus_One);
+      
+      if (val_invp_tensor == NULL) continue;
+      
+      k0orho = n0/rho; k1orho = n1/rho;
+      gm1_o_c2 = gm1/c2; gm1_o_rhoxc = gm1/rhoxc;
+      
+      invP = &val_invp_tensor[iLane];
+        invP[ 0*L] = 1.0-0.5*gm1_o_c2*sqvel;
+        invP[ 1*L] = gm1_o_c2*u0;
+        invP[ 2*L] = gm1_o_c2*u1;
+        invP[ 3*L] = -gm1_o_c2;
+        invP[ 4*L] = -k1orho*u0+k0orho*u1;
+        invP[ 5*L] = k1orho;
+        invP[ 6*L] = -k0orho;
+        invP[ 7*L] = 0.0;
+        invP[ 8*L] = -k0orho*u0-k1orho*u1+0.5*gm1_o_rhoxc*sqvel;
+        invP[ 9*L] = k0orho-gm1_o_rhoxc*u0;
+        invP[10*L] = k1orho-gm1_o_rhoxc*u1;
+        invP[11*L] = gm1_o_rhoxc;
+        invP[12*L] = k0orho*u0+k1orho*u1+0.5*gm1_o_rhoxc*sqvel;
+        invP[13*L] = -k0orho-gm1_o_rhoxc*u0;
+        invP[14*L] = -k1orho-gm1_o_rhoxc*u1;
+        invP[15*L] = gm1_o_rhoxc;
+      
+    }
+  }
+  else {
+    for (iLane = 0; iLane < L; iLane++) {
+      
+      rho = val_density[iLane]; c = val_soundspeed[iLane];
+      u0 = val_velocity[iLane]; u1 = val_velocity[L+iLane]; u2 = val_velocity[2*L+iLane];
+      n0 = val_normal[iLane]; n1 = val_normal[L+iLane]; n2 = val_normal[2*L+iLane];
+      rhooc = rho/c; rhoxc = rho*c; c2 = c*c;
+      sqvel = u0*u0+u1*u1+u2*u2;
+      
+      P = &val_p_tensor[iLane];
+        P[ 0*L] = n0;
+        P[ 1*L] = n1;
+        P[ 2*L] = n2;
+        P[ 3*L] = 0.5*rhooc;
+        P[ 4*L] = 0.5*rhooc;
+        P[ 5*L] = u0*n0;
+        P[ 6*L] = u0*n1-rho*n2;
+        P[ 7*L] = u0*n2+rho*n1;
+        P[ 8*L] = 0.5*(u0*rhooc+rho*n0);
+        P[ 9*L] = 0.5*(u0*rhooc-rho*n0);
+        P[10*L] = u1*n0+rho*n2;
+        P[11*L] = u1*n1;
+        P[12*L] = u1*n2-rho*n0;
+        P[13*L] = 0.5*(u1*rhooc+rho*n1);
+        P[14*L] = 0.5*(u1*rhooc-rho*n1);
+        P[15*L] = u2*n0-rho*n1;
+        P[16*L] = u2*n1+rho*n0;
+        P[17*L] = u2*n2;
+        P[18*L] = 0.5*(u2*rhooc+rho*n2);
+        P[19*L] = 0.5*(u2*rhooc-rho*n2);
+        P[20*L] = 0.5*sqvel*n0+rho*u1*n2-rho*u2*n1;
+        P[21*L] = 0.5*sqvel*n1-rho*u0*n2+rho*u2*n0;
+        P[22*L] = 0.5*sqvel*n2+rho*u0*n1-rho*u1*n0;
+        P[23*L] = 0.5*(0.5*sqvel*rhooc+rho*(u0*n0+u1*n1+u2*n2)+rhoxc/Gamma_Minus_One);
+        P[24*L] = 0.5*(0.5*sqvel*rhooc-rho*(u0*n0+u1*n1+u2*n2)+rhoxc/Gamma_Minus_One);
+      
+      if (val_invp_tensor == NULL) continue;
+      
+      invP = &val_invp_tensor[iLane];
+        invP[ 0*L] = n0-n2*u1 /rho+n1*u2 /rho-n0*0.5*gm1*sqvel/c2;
+        invP[ 1*L] = n0*gm1*u0/c2;
+        invP[ 2*L] = n2 /rho+n0*gm1*u1/c2;
+        invP[ 3*L] = -n1 /rho+n0*gm1*u2/c2;
+        invP[ 4*L] = -n0*gm1/c2;
+        invP[ 5*L] = n1+n2*u0 /rho-n0*u2 /rho-n1*0.5*gm1*sqvel/c2;
+        invP[ 6*L] = -n2 /rho+n1*gm1*u0/c2;
+        invP[ 7*L] = n1*gm1*u1/c2;
+        invP[ 8*L] = n0 /rho+n1*gm1*u2/c2;
+        invP[ 9*L] = -n1*gm1/c2;
+        invP[10*L] = n2-n1*u0 /rho+n0*u1 /rho-n2*0.5*gm1*sqvel/c2;
+        invP[11*L] = n1 /rho+n2*gm1*u0/c2;
+        invP[12*L] = -n0 /rho+n2*gm1*u1/c2;
+        invP[13*L] = n2*gm1*u2/c2;
+        invP[14*L] = -n2*gm1/c2;
+        invP[15*L] = -(n0*u0+n1*u1+n2*u2) /rho+0.5*gm1*sqvel/rhoxc;
+        invP[16*L] = n0 /rho-gm1*u0/rhoxc;
+        invP[17*L] = n1 /rho-gm1*u1/rhoxc;
+        invP[18*L] = n2 /rho-gm1*u2/rhoxc;
+        invP[19*L] = Gamma_Minus_One/rhoxc;
+        invP[20*L] = (n0*u0+n1*u1+n2*u2) /rho+0.5*gm1*sqvel/rhoxc;
+        invP[21*L] = -n0 /rho-gm1*u0/rhoxc;
+        invP[22*L] = -n1 /rho-gm1*u1/rhoxc;
+        invP[23*L] = -n2 /rho-gm1*u2/rhoxc;
+        invP[24*L] = Gamma_Minus_One/rhoxc;
+      
+    }
+  }
+  
+}
+
+void CNumerics::GetAbsJacobian_Lanes(double *val_p_tensor, double *val_lambda, double *val_invp_tensor, double *val_abs_jac) {
+  
+  const unsigned short L = NUMERICS_LANES;
+  unsigned short iVar, jVar, kVar, iLane;
+  double *AbsJac;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nVar; jVar++) {
+      AbsJac = &val_abs_jac[(iVar*nVar+jVar)*L];
+      for (iLane = 0; iLane < L; iLane++)
+        AbsJac[iLane] = 0.0;
+      for (kVar = 0; kVar < nVar; kVar++)
+        for (iLane = 0; iLane < L; iLane++)
+          AbsJac[iLane] += val_p_tensor[(iVar*nVar+kVar)*L+iLane]*val_lambda[kVar*L+iLane]*val_invp_tensor[(kVar*nVar+jVar)*L+iLane];
+    }
+  
+}
+
+void CNumerics::GetRoeJacobians_Lanes(double *val_density_i, double *val_velocity_i, double *val_enthalpy_i, double *val_energy_i,
+                                      double *val_density_j, double *val_velocity_j, double *val_enthalpy_j, double *val_energy_j,
+                                      double *val_normal, double *val_Jacobian_i, double *val_Jacobian_j) {
+  
+  const unsigned short L = NUMERICS_LANES;
+  unsigned short iDim, iVar, jVar, iLane;
+  double Area[L], UnitNormal[3*L], R[L], RoeDensity[L], RoeVelocity[3*L], RoeEnthalpy[L], RoeSoundSpeed[L],
+  sq_vel[L], ProjVelocity[L], Lambda[5*L], P_Tensor[25*L], invP_Tensor[25*L], AbsJac[25*L];
+  
+  /*--- Roe averages of the edges ---*/
+  
+  for (iLane = 0; iLane < L; iLane++) {
+    Area[iLane] = 0.0; sq_vel[iLane] = 0.0; ProjVelocity[iLane] = 0.0;
+    R[iLane] = sqrt(val_density_j[iLane]/val_density_i[iLane]);
+    RoeDensity[iLane] = R[iLane]*val_density_i[iLane];
+    RoeEnthalpy[iLane] = (R[iLane]*val_enthalpy_j[iLane]+val_enthalpy_i[iLane])/(R[iLane]+1);
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < L; iLane++)
+      Area[iLane] += val_normal[iDim*L+iLane]*val_normal[iDim*L+iLane];
+  for (iLane = 0; iLane < L; iLane++)
+    Area[iLane] = sqrt(Area[iLane]);
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < L; iLane++) {
+      UnitNormal[iDim*L+iLane] = val_normal[iDim*L+iLane]/Area[iLane];
+      RoeVelocity[iDim*L+iLane] = (R[iLane]*val_velocity_j[iDim*L+iLane]+val_velocity_i[iDim*L+iLane])/(R[iLane]+1);
+      sq_vel[iLane] += RoeVelocity[iDim*L+iLane]*RoeVelocity[iDim*L+iLane];
+      ProjVelocity[iLane] += RoeVelocity[iDim*L+iLane]*UnitNormal[iDim*L+iLane];
+    }
+  
+  /*--- Absolute value of the eigenvalues ---*/
+  
+  for (iLane = 0; iLane < L; iLane++)
+    RoeSoundSpeed[iLane] = sqrt((Gamma-1)*(RoeEnthalpy[iLane]-0.5*sq_vel[iLane]));
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < L; iLane++)
+      Lambda[iDim*L+iLane] = fabs(ProjVelocity[iLane]);
+  for (iLane = 0; iLane < L; iLane++) {
+    Lambda[(nVar-2)*L+iLane] = fabs(ProjVelocity[iLane] + RoeSoundSpeed[iLane]);
+    Lambda[(nVar-1)*L+iLane] = fabs(ProjVelocity[iLane] - RoeSoundSpeed[iLane]);
+  }
+  
+  /*--- Projected Jacobians (scale 0.5) plus/minus 0.5 |A| ---*/
+  
+  GetPMatrix_Lanes(RoeDensity, RoeVelocity, RoeSoundSpeed, UnitNormal, P_Tensor, invP_Tensor);
+  GetAbsJacobian_Lanes(P_Tensor, Lambda, invP_Tensor, AbsJac);
+  GetInviscidProjJac_Lanes(val_velocity_i, val_energy_i, val_normal, 0.5, val_Jacobian_i);
+  GetInviscidProjJac_Lanes(val_velocity_j, val_energy_j, val_normal, 0.5, val_Jacobian_j);
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nVar; jVar++)
+      for (iLane = 0; iLane < L; iLane++) {
+        val_Jacobian_i[(iVar*nVar+jVar)*L+iLane] += 0.5*AbsJac[(iVar*nVar+jVar)*L+iLane]*Area[iLane];
+        val_Jacobian_j[(iVar*nVar+jVar)*L+iLane] -= 0.5*AbsJac[(iVar*nVar+jVar)*L+iLane]*Area[iLane];
+      }
+  
+}
+
 void CNumerics::GetPMatrix_inv(double *U, double *V, double *val_dPdU,
                                double *val_normal, double *l, double *m,
                                double **val_invp_tensor) {
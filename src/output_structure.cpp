@@ -1042,6 +1042,8 @@ void COutput::SetHistory_Header(ofstream *ConvHist_file, CConfig *config) {
       if (turbulent) ConvHist_file[0] << turb_resid;
       if (output_per_surface) ConvHist_file[0] << monitoring_coeff;
       if (output_1d) ConvHist_file[0] << oneD_outputs;
+      if (config->GetJacobian_Free()) ConvHist_file[0] << ",\"Residual_Evaluations\"";
+      if (config->GetLinear_Solver_Forcing()) ConvHist_file[0] << ",\"Linear_Solver_Tolerance\"";
       ConvHist_file[0] << end;
       break;
       
@@ -1080,7 +1082,8 @@ void COutput::SetConvergence_History(ofstream *ConvHist_file,
     double dummy = 0.0;
     unsigned short iVar, iMarker, iMarker_Monitoring;
     
-    unsigned long LinSolvIter = 0;
+    unsigned long LinSolvIter = 0, ResidualEval = 0;
+    double LinSolvTol = 0.0;
     double timeiter = timeused/double(iExtIter+1);
     
     unsigned short FinestMesh = config->GetFinestMesh();
@@ -1282,6 +1285,8 @@ void COutput::SetConvergence_History(ofstream *ConvHist_file,
         /*--- Iterations of the linear solver ---*/
         
         LinSolvIter = (unsigned long) solver_container[FinestMesh][FLOW_SOL]->GetIterLinSolver();
+        ResidualEval = solver_container[FinestMesh][FLOW_SOL]->GetnResidual_Eval();
+        LinSolvTol = solver_container[FinestMesh][FLOW_SOL]->GetTolLinSolver();
         
         break;
         
@@ -1311,7 +1316,12 @@ void COutput::SetConvergence_History(ofstream *ConvHist_file,
         sprintf (begin, "%12d", int(iExtIter));
         
         /*--- Write the end of the history file ---*/
-        sprintf (end, ", %12.10f, %12.10f\n", double(LinSolvIter), timeused/60.0);
+        end[0] = '\0';
+        if (config->GetJacobian_Free())
+          sprintf (end+strlen(end), ", %12.10f", double(ResidualEval));
+        if (config->GetLinear_Solver_Forcing())
+          sprintf (end+strlen(end), ", %12.10e", LinSolvTol);
+        sprintf (end+strlen(end), ", %12.10f, %12.10f\n", double(LinSolvIter), timeused/60.0);
         
         /*--- Write the solution and residual of the history file ---*/
         switch (config->GetKind_Solver()) {
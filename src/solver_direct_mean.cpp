@@ -203,12 +203,18 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     if (rank == MASTER_NODE) cout << "Initialize jacobian structure (Euler). MG level: " << iMesh <<"." << endl;
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
     
-    if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
+    if ((config->GetKind_Linear_Solver_Prec_Rows() == LINELET) ||
         (config->GetKind_Linear_Solver() == SMOOTHER_LINELET)) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
     
+    if ((config->GetKind_Linear_Solver_Prec_Rows() == LU_SGS) || (config->GetKind_Linear_Solver_Prec_Rows() == ILU) ||
+        (config->GetKind_Linear_Solver() == SMOOTHER_LUSGS) || (config->GetKind_Linear_Solver() == SMOOTHER_ILU)) {
+      if (rank == MASTER_NODE) cout << "Compute sweep schedule. " << Jacobian.GetnSweepGroup() << " groups of independent rows, "
+        << Jacobian.GetSweep_Reversed() << "% of the couplings reordered." << endl;
+    }
+    
   } else {
     if (rank == MASTER_NODE) cout << "Explicit scheme. No jacobian structure (Euler). MG level: " << iMesh <<"." << endl;
   }
@@ -430,6 +436,9 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     delete [] Global2Local;
   }
   
+  /*--- The variables of all the points are moved to contiguous fields ---*/
+  SetVariable_Storage();
+  
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
   counter_local = 0;
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -700,21 +709,9 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   
   if ((second_order && !center) && (iMesh == MESH_0)) {
     
-    /*--- Gradient computation ---*/
+    /*--- Gradient, limiter and (fused mode) face states computation ---*/
     
-    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-      SetPrimVar_Gradient_GG(geometry, config);
-    }
-    
-    if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-      SetPrimVar_Gradient_LS(geometry, config);
-    }
-    
-    /*--- Limiter computation ---*/
-    
-    if ((limiter) && (iMesh == MESH_0)) {
-      SetPrimVar_Limiter(geometry, config);
-    }
+    SetPrimVar_Reconstruction(geometry, config, limiter);
     
   }
   
@@ -730,10 +727,12 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
     }
   }
   
-  /*--- Initialize the jacobian matrices ---*/
+  /*--- Initialize the jacobian matrices (a lagged Jacobian is kept) ---*/
   
-  if (implicit) {
+  if (implicit && Jacobian_Update) {
     Jacobian.SetValZero();
+    if (Jacobian_Delta != NULL)
+      for (iPoint = 0; iPoint < nPoint; iPoint++) Jacobian_Delta[iPoint] = 0.0;
   }
   
   /*--- Error message ---*/
@@ -745,28 +744,18 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 void CEulerSolver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                   unsigned short iMesh) { }
 
-void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
-                                unsigned short iMesh, unsigned long Iteration) {
-  double *Normal, Area, Vol, Mean_SoundSpeed, Mean_ProjVel, Lambda, Local_Delta_Time,
-  Global_Delta_Time = 1E6, Global_Delta_UnstTimeND, ProjVel, ProjVel_i, ProjVel_j;
-  unsigned long iEdge, iVertex, iPoint, jPoint;
-  unsigned short iDim, iMarker;
-  
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool grid_movement = config->GetGrid_Movement();
-  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
-                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+void CEulerSolver::SetTime_Step_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
   
-  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
-  
-  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
-  
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    node[iPoint]->SetMax_Lambda_Inv(0.0);
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CGeometry *geometry = loop->geometry;
+  CVariable **node = loop->solver->node;
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iDim, nDim = geometry->GetnDim();
+  double *Normal, Area, Mean_SoundSpeed, Mean_ProjVel, Lambda, ProjVel_i, ProjVel_j;
   
-  /*--- Loop interior edges ---*/
+  bool grid_movement = loop->config->GetGrid_Movement();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     /*--- Point identification, Normal vector and area ---*/
     
@@ -802,6 +791,31 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
     
   }
   
+}
+
+void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                unsigned short iMesh, unsigned long Iteration) {
+  double *Normal, Area, Vol, Mean_SoundSpeed, Mean_ProjVel, Lambda, Local_Delta_Time,
+  Global_Delta_Time = 1E6, Global_Delta_UnstTimeND, ProjVel;
+  unsigned long iVertex, iPoint;
+  unsigned short iDim, iMarker;
+  
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool grid_movement = config->GetGrid_Movement();
+  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  
+  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  
+  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    node[iPoint]->SetMax_Lambda_Inv(0.0);
+  
+  /*--- Loop interior edges ---*/
+  
+  Run_EdgeLoop(SetTime_Step_Thread, geometry, solver_container, NULL, config, iMesh);
+  
   /*--- Loop boundary edges ---*/
   
   for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
@@ -884,16 +898,19 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
   
 }
 
-void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
-                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-  
+template <class Num, bool second_order, bool implicit, bool grid_movement>
+void CEulerSolver::Centered_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
+  
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CEulerSolver *solver = (CEulerSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CConfig *config = loop->config;
+  Num *numerics = (Num *)loop->numerics->GetThread_Numerics(iThread);
+  CSolver_Work *Work = &solver->Thread_Work[iThread];
+  CVariable **node = solver->node;
   unsigned long iEdge, iPoint, jPoint;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool second_order = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
-  bool grid_movement = config->GetGrid_Movement();
-  
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     /*--- Points in edge, set normal vectors, and number of neighbors ---*/
     
@@ -924,53 +941,91 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
     
     /*--- Compute residuals, and jacobians ---*/
     
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
+    ComputeResidual_Static(numerics, Work->Residual, Work->Jacobian_i, Work->Jacobian_j, config);
     
     /*--- Update convective and artificial dissipation residuals ---*/
     
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
+    solver->LinSysRes.AddBlock(iPoint, Work->Residual);
+    solver->LinSysRes.SubtractBlock(jPoint, Work->Residual);
     
     /*--- Set implicit computation ---*/
     if (implicit) {
-      Jacobian.AddBlock(iPoint,iPoint,Jacobian_i);
-      Jacobian.AddBlock(iPoint,jPoint,Jacobian_j);
-      Jacobian.SubtractBlock(jPoint,iPoint,Jacobian_i);
-      Jacobian.SubtractBlock(jPoint,jPoint,Jacobian_j);
+      solver->Jacobian.UpdateBlocks(iEdge, Work->Jacobian_i, Work->Jacobian_j);
     }
   }
   
 }
 
-void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
-                                   CConfig *config, unsigned short iMesh) {
+template <class Num>
+CGeometry::EdgeKernel CEulerSolver::Centered_Residual_Kernel(bool second_order, bool implicit, bool grid_movement) {
+  
+  if (grid_movement) {
+    if (second_order) return (implicit ? Centered_Residual_Thread<Num, true, true, true> : Centered_Residual_Thread<Num, true, false, true>);
+    else return (implicit ? Centered_Residual_Thread<Num, false, true, true> : Centered_Residual_Thread<Num, false, false, true>);
+  }
+  else {
+    if (second_order) return (implicit ? Centered_Residual_Thread<Num, true, true, false> : Centered_Residual_Thread<Num, true, false, false>);
+    else return (implicit ? Centered_Residual_Thread<Num, false, true, false> : Centered_Residual_Thread<Num, false, false, false>);
+  }
+  
+}
+
+void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+  
+  CGeometry::EdgeKernel kernel;
+  
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
+  bool second_order = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
+  bool grid_movement = config->GetGrid_Movement();
+  
+  /*--- The scheme (the multigrid levels may use another one) and the options are resolved here,
+   once for all the edges ---*/
+  
+  if (typeid(*numerics) == typeid(CCentJST_Flow)) kernel = Centered_Residual_Kernel<CCentJST_Flow>(second_order, implicit, grid_movement);
+  else if (typeid(*numerics) == typeid(CCentLax_Flow)) kernel = Centered_Residual_Kernel<CCentLax_Flow>(second_order, implicit, grid_movement);
+  else kernel = Centered_Residual_Kernel<CNumerics>(second_order, implicit, grid_movement);
+  
+  SetThread_Work(nPrimVar);
+  Run_EdgeLoop(kernel, geometry, solver_container, numerics, config, iMesh);
+  
+}
+
+template <class Num, bool second_order, bool limiter, bool implicit, bool grid_movement, bool roe_turkel>
+void CEulerSolver::Upwind_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
+  
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CEulerSolver *solver = (CEulerSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CConfig *config = loop->config;
+  Num *numerics = (Num *)loop->numerics->GetThread_Numerics(iThread);
+  CSolver_Work *Work = &solver->Thread_Work[iThread];
+  CVariable **node = solver->node;
   double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, *V_i, *V_j, *Limiter_i = NULL,
-  *Limiter_j = NULL, sqvel;
+  *Limiter_j = NULL, sqvel, *Normal, *Edge_Primitive = solver->Edge_Primitive;
   unsigned long iEdge, iPoint, jPoint;
-  unsigned short iDim, iVar;
+  unsigned short iDim, iVar, jVar, iLane = 0, jLane, nDim = solver->nDim, nVar = solver->nVar,
+  nPrimVarGrad = solver->nPrimVarGrad, nLaneVar = solver->nDim+4;
+  const unsigned short L = NUMERICS_LANES;
   
-  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool second_order     = (((config->GetSpatialOrder_Flow() == SECOND_ORDER) || (config->GetSpatialOrder_Flow() == SECOND_ORDER_LIMITER)) && (iMesh == MESH_0));
-  bool limiter          = (config->GetSpatialOrder_Flow() == SECOND_ORDER_LIMITER);
-  bool grid_movement    = config->GetGrid_Movement();
-  bool roe_turkel       = (config->GetKind_Upwind_Flow() == TURKEL);
+  bool lanes            = GetLanes_Static(numerics);
+  
+  /*--- Roe Turkel preconditioning, the free stream velocity is the same for all the edges ---*/
   
-  for(iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  if (roe_turkel) {
+    sqvel = 0.0;
+    for (iDim = 0; iDim < nDim; iDim ++)
+      sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
+    numerics->SetVelocity2_Inf(sqvel);
+  }
+  
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     /*--- Points in edge and normal vectors ---*/
     
     iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
     numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
     
-    /*--- Roe Turkel preconditioning ---*/
-    
-    if (roe_turkel) {
-      sqvel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim ++)
-        sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
-      numerics->SetVelocity2_Inf(sqvel);
-    }
-    
     /*--- Grid movement ---*/
     
     if (grid_movement)
@@ -980,13 +1035,17 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     
     V_i = node[iPoint]->GetPrimVar(); V_j = node[jPoint]->GetPrimVar();
     
-    /*--- High order reconstruction using MUSCL strategy ---*/
+    /*--- High order reconstruction using MUSCL strategy (the states of the fused
+     reconstruction are already stored for each edge) ---*/
     
-    if (second_order) {
+    if (second_order && (Edge_Primitive != NULL)) {
+      V_i = &Edge_Primitive[2*iEdge*nPrimVarGrad]; V_j = V_i + nPrimVarGrad;
+    }
+    else if (second_order) {
       
       for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
+        Work->Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
+        Work->Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
       }
       
       Gradient_i = node[iPoint]->GetGradient_Primitive(); Gradient_j = node[jPoint]->GetGradient_Primitive();
@@ -995,47 +1054,93 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
         Project_Grad_i = 0.0; Project_Grad_j = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
+          Project_Grad_i += Work->Vector_i[iDim]*Gradient_i[iVar][iDim];
+          Project_Grad_j += Work->Vector_j[iDim]*Gradient_j[iVar][iDim];
         }
         if (limiter) {
-          Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+          Work->Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+          Work->Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
         }
         else {
-          Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+          Work->Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
+          Work->Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
         }
       }
       
-      /*--- Set conservative variables with reconstruction ---*/
+      V_i = Work->Primitive_i; V_j = Work->Primitive_j;
+      
+    }
+    
+    /*--- Batched schemes: the edge is stored in the next lane, and the batch is computed when all
+     the lanes are used or at the last edge of the chunk (the free lanes repeat the last edge). The
+     edges are added to the residual and to the Jacobian in the same order as one by one ---*/
+    
+    if (lanes) {
+      
+      Normal = geometry->edge[iEdge]->GetNormal();
+      for (iVar = 0; iVar < nLaneVar; iVar++) {
+        Work->Lanes_V_i[iVar*L+iLane] = V_i[iVar];
+        Work->Lanes_V_j[iVar*L+iLane] = V_j[iVar];
+      }
+      for (iDim = 0; iDim < nDim; iDim++)
+        Work->Lanes_Normal[iDim*L+iLane] = Normal[iDim];
+      Work->Lanes_Edge[iLane] = iEdge;
+      iLane++;
       
-      numerics->SetPrimitive(Primitive_i, Primitive_j);
+      if ((iLane < L) && (iEdge+1 < iEdge_end)) continue;
       
-    } else {
+      for (jLane = iLane; jLane < L; jLane++) {
+        for (iVar = 0; iVar < nLaneVar; iVar++) {
+          Work->Lanes_V_i[iVar*L+jLane] = Work->Lanes_V_i[iVar*L+iLane-1];
+          Work->Lanes_V_j[iVar*L+jLane] = Work->Lanes_V_j[iVar*L+iLane-1];
+        }
+        for (iDim = 0; iDim < nDim; iDim++)
+          Work->Lanes_Normal[iDim*L+jLane] = Work->Lanes_Normal[iDim*L+iLane-1];
+      }
       
-      /*--- Set conservative variables without reconstruction ---*/
+      ComputeResidual_Lanes_Static(numerics, Work->Lanes_V_i, Work->Lanes_V_j, Work->Lanes_Normal, Work->Lanes_Residual,
+                                   Work->Lanes_Jacobian_i, Work->Lanes_Jacobian_j, config);
       
-      numerics->SetPrimitive(V_i, V_j);
+      for (jLane = 0; jLane < iLane; jLane++) {
+        
+        iPoint = geometry->edge[Work->Lanes_Edge[jLane]]->GetNode(0); jPoint = geometry->edge[Work->Lanes_Edge[jLane]]->GetNode(1);
+        for (iVar = 0; iVar < nVar; iVar++)
+          Work->Residual[iVar] = Work->Lanes_Residual[iVar*L+jLane];
+        solver->LinSysRes.AddBlock(iPoint, Work->Residual);
+        solver->LinSysRes.SubtractBlock(jPoint, Work->Residual);
+        
+        if (implicit) {
+          for (iVar = 0; iVar < nVar; iVar++)
+            for (jVar = 0; jVar < nVar; jVar++) {
+              Work->Jacobian_i[iVar][jVar] = Work->Lanes_Jacobian_i[(iVar*nVar+jVar)*L+jLane];
+              Work->Jacobian_j[iVar][jVar] = Work->Lanes_Jacobian_j[(iVar*nVar+jVar)*L+jLane];
+            }
+          solver->Jacobian.UpdateBlocks(Work->Lanes_Edge[jLane], Work->Jacobian_i, Work->Jacobian_j);
+        }
+        
+      }
+      iLane = 0;
       
+      continue;
     }
     
+    /*--- Set the primitive variables (with or without reconstruction) ---*/
+    
+    numerics->SetPrimitive(V_i, V_j);
+    
     /*--- Compute the residual ---*/
     
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
+    ComputeResidual_Static(numerics, Work->Residual, Work->Jacobian_i, Work->Jacobian_j, config);
     
     /*--- Update residual value ---*/
     
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
+    solver->LinSysRes.AddBlock(iPoint, Work->Residual);
+    solver->LinSysRes.SubtractBlock(jPoint, Work->Residual);
     
     /*--- Set implicit jacobians ---*/
     
     if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+      solver->Jacobian.UpdateBlocks(iEdge, Work->Jacobian_i, Work->Jacobian_j);
     }
     
     /*--- Roe Turkel preconditioning, set the value of beta ---*/
@@ -1049,6 +1154,47 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   
 }
 
+template <class Num, bool roe_turkel>
+CGeometry::EdgeKernel CEulerSolver::Upwind_Residual_Kernel(bool second_order, bool limiter, bool implicit, bool grid_movement) {
+  
+  if (grid_movement) {
+    if (!second_order) return (implicit ? Upwind_Residual_Thread<Num, false, false, true, true, roe_turkel> : Upwind_Residual_Thread<Num, false, false, false, true, roe_turkel>);
+    else if (!limiter) return (implicit ? Upwind_Residual_Thread<Num, true, false, true, true, roe_turkel> : Upwind_Residual_Thread<Num, true, false, false, true, roe_turkel>);
+    else return (implicit ? Upwind_Residual_Thread<Num, true, true, true, true, roe_turkel> : Upwind_Residual_Thread<Num, true, true, false, true, roe_turkel>);
+  }
+  else {
+    if (!second_order) return (implicit ? Upwind_Residual_Thread<Num, false, false, true, false, roe_turkel> : Upwind_Residual_Thread<Num, false, false, false, false, roe_turkel>);
+    else if (!limiter) return (implicit ? Upwind_Residual_Thread<Num, true, false, true, false, roe_turkel> : Upwind_Residual_Thread<Num, true, false, false, false, roe_turkel>);
+    else return (implicit ? Upwind_Residual_Thread<Num, true, true, true, false, roe_turkel> : Upwind_Residual_Thread<Num, true, true, false, false, roe_turkel>);
+  }
+  
+}
+
+void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                                   CConfig *config, unsigned short iMesh) {
+  
+  CGeometry::EdgeKernel kernel;
+  
+  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
+  bool second_order     = (((config->GetSpatialOrder_Flow() == SECOND_ORDER) || (config->GetSpatialOrder_Flow() == SECOND_ORDER_LIMITER)) && (iMesh == MESH_0));
+  bool limiter          = (config->GetSpatialOrder_Flow() == SECOND_ORDER_LIMITER);
+  bool grid_movement    = config->GetGrid_Movement();
+  bool roe_turkel       = (config->GetKind_Upwind_Flow() == TURKEL);
+  
+  /*--- The scheme and the options are resolved here, once for all the edges (the other
+   upwind schemes keep the virtual call, Roe-Turkel is one of them) ---*/
+  
+  if (roe_turkel) kernel = Upwind_Residual_Kernel<CNumerics, true>(second_order, limiter, implicit, grid_movement);
+  else if (typeid(*numerics) == typeid(CUpwRoe_Flow)) kernel = Upwind_Residual_Kernel<CUpwRoe_Flow, false>(second_order, limiter, implicit, grid_movement);
+  else if (typeid(*numerics) == typeid(CUpwAUSM_Flow)) kernel = Upwind_Residual_Kernel<CUpwAUSM_Flow, false>(second_order, limiter, implicit, grid_movement);
+  else if (typeid(*numerics) == typeid(CUpwHLLC_Flow)) kernel = Upwind_Residual_Kernel<CUpwHLLC_Flow, false>(second_order, limiter, implicit, grid_movement);
+  else kernel = Upwind_Residual_Kernel<CNumerics, false>(second_order, limiter, implicit, grid_movement);
+  
+  SetThread_Work(nPrimVar);
+  Run_EdgeLoop(kernel, geometry, solver_container, numerics, config, iMesh);
+  
+}
+
 void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CNumerics *second_numerics,
                                    CConfig *config, unsigned short iMesh) {
   
@@ -1059,21 +1205,18 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   
 }
 
-void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
-  double *Normal, Area, Mean_SoundSpeed, Mean_ProjVel, Lambda,
-  ProjVel, ProjVel_i, ProjVel_j;
-  unsigned long iEdge, iVertex, iPoint, jPoint;
-  unsigned short iDim, iMarker;
+void CEulerSolver::SetMax_Eigenvalue_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
   
-  bool grid_movement = config->GetGrid_Movement();
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CGeometry *geometry = loop->geometry;
+  CVariable **node = loop->solver->node;
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iDim, nDim = geometry->GetnDim();
+  double *Normal, Area, Mean_SoundSpeed, Mean_ProjVel, Lambda, ProjVel_i, ProjVel_j;
   
-  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    node[iPoint]->SetLambda(0.0);
-  }
+  bool grid_movement = loop->config->GetGrid_Movement();
   
-  /*--- Loop interior edges ---*/
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     /*--- Point identification, Normal vector and area ---*/
     iPoint = geometry->edge[iEdge]->GetNode(0);
@@ -1105,6 +1248,23 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
     
   }
   
+}
+
+void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
+  double *Normal, Area, Mean_SoundSpeed, Mean_ProjVel, Lambda, ProjVel;
+  unsigned long iVertex, iPoint;
+  unsigned short iDim, iMarker;
+  
+  bool grid_movement = config->GetGrid_Movement();
+  
+  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    node[iPoint]->SetLambda(0.0);
+  }
+  
+  /*--- Loop interior edges ---*/
+  Run_EdgeLoop(SetMax_Eigenvalue_Thread, geometry, NULL, NULL, config, MESH_0);
+  
   /*--- Loop boundary edges ---*/
   for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
     for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
@@ -1138,17 +1298,17 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
   
 }
 
-void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config) {
-  unsigned long iPoint, jPoint, iEdge;
-  double Pressure_i = 0, Pressure_j = 0, *Diff;
-  unsigned short iVar;
+void CEulerSolver::SetUndivided_Laplacian_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
   
-  Diff = new double[nVar];
-  
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    node[iPoint]->SetUnd_LaplZero();
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CEulerSolver *solver = (CEulerSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CVariable **node = solver->node;
+  unsigned long iPoint, jPoint, iEdge;
+  double Pressure_i = 0, Pressure_j = 0, *Diff = solver->Thread_Work[iThread].Residual;
+  unsigned short iVar, nVar = solver->nVar;
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     iPoint = geometry->edge[iEdge]->GetNode(0);
     jPoint = geometry->edge[iEdge]->GetNode(1);
@@ -1190,11 +1350,26 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config)
     
   }
   
+}
+
+void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config) {
+  unsigned long iPoint;
+  
+  SetThread_Work(nPrimVar);
+  
+  if (Variable_Storage != NULL)
+    Variable_Storage->SetField_Zero(FIELD_UNDIVIDED_LAPLACIAN, nPointDomain);
+  else
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      node[iPoint]->SetUnd_LaplZero();
+  
+  Run_EdgeLoop(SetUndivided_Laplacian_Thread, geometry, NULL, NULL, config, MESH_0);
+  
 #ifdef STRUCTURED_GRID
   
   unsigned long Point_Normal = 0, iVertex;
-  double Pressure_mirror = 0, *U_mirror;
-  unsigned short iMarker;
+  double Pressure_mirror = 0, *U_mirror, *Diff = Thread_Work[0].Residual;
+  unsigned short iMarker, iVar;
   
   U_mirror = new double[nVar];
   
@@ -1236,22 +1411,18 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config)
   
 #endif
   
-  delete [] Diff;
-  
 }
 
-void CEulerSolver::SetDissipation_Switch(CGeometry *geometry, CConfig *config) {
-  unsigned long iEdge, iPoint, jPoint;
-  double Pressure_i, Pressure_j;
+void CEulerSolver::SetDissipation_Switch_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
   
-  /*--- Reset variables to store the undivided pressure ---*/
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    iPoint_UndLapl[iPoint] = 0.0;
-    jPoint_UndLapl[iPoint] = 0.0;
-  }
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CEulerSolver *solver = (CEulerSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CVariable **node = solver->node;
+  unsigned long iEdge, iPoint, jPoint;
+  double Pressure_i, Pressure_j, *iPoint_UndLapl = solver->iPoint_UndLapl, *jPoint_UndLapl = solver->jPoint_UndLapl;
   
-  /*--- Evaluate the pressure sensor ---*/
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     iPoint = geometry->edge[iEdge]->GetNode(0);
     jPoint = geometry->edge[iEdge]->GetNode(1);
@@ -1295,10 +1466,24 @@ void CEulerSolver::SetDissipation_Switch(CGeometry *geometry, CConfig *config) {
     
   }
   
+}
+
+void CEulerSolver::SetDissipation_Switch(CGeometry *geometry, CConfig *config) {
+  unsigned long iPoint;
+  
+  /*--- Reset variables to store the undivided pressure ---*/
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    iPoint_UndLapl[iPoint] = 0.0;
+    jPoint_UndLapl[iPoint] = 0.0;
+  }
+  
+  /*--- Evaluate the pressure sensor ---*/
+  Run_EdgeLoop(SetDissipation_Switch_Thread, geometry, NULL, NULL, config, MESH_0);
+  
 #ifdef STRUCTURED_GRID
   unsigned short iMarker;
   unsigned long iVertex, Point_Normal;
-  double Press_mirror;
+  double Pressure_i, Press_mirror;
   
   /*--- Loop over all boundaries and include an extra contribution
    from a mirror node. Find the nearest normal, interior point
@@ -1669,6 +1854,15 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry **geometry, CSolver ***solv
     SetRes_Max(iVar, 0.0, 0);
   }
   
+  /*--- Time step terms on the diagonal of the Jacobian, a lagged Jacobian keeps
+   those of the iteration where it was assembled ---*/
+  
+  if (Jacobian_Delta == NULL) {
+    Jacobian_Delta = new double [nPoint];
+    for (iPoint = 0; iPoint < nPoint; iPoint++) Jacobian_Delta[iPoint] = 0.0;
+  }
+  if (Jacobian_Update) Jacobian_Identity = false;
+  
   /*--- Build implicit system ---*/
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -1690,14 +1884,23 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry **geometry, CSolver ***solv
         for (iVar = 0; iVar < nVar; iVar ++ )
           for (jVar = 0; jVar < nVar; jVar ++ )
             LowMach_Precontioner[iVar][jVar] = Delta*LowMach_Precontioner[iVar][jVar];
-        Jacobian.AddBlock(iPoint, iPoint, LowMach_Precontioner);
+        Jacobian.AddBlock2Diag(iPoint, LowMach_Precontioner);
       }
       else {
-        Jacobian.AddVal2Diag(iPoint, Delta);
+        Jacobian.AddVal2Diag(iPoint, Delta - Jacobian_Delta[iPoint]);
+        Jacobian_Delta[iPoint] = Delta;
       }
     }
     else {
-      Jacobian.SetVal2Diag(iPoint, 1.0);
+      
+      /*--- The block of a lagged Jacobian is kept (the residual of the point is zero), the
+       identity replaces only an assembled block, and the next iteration assembles it again ---*/
+      
+      if (Jacobian_Update) {
+        Jacobian.SetVal2Diag(iPoint, 1.0);
+        Jacobian_Delta[iPoint] = 0.0;
+        Jacobian_Identity = true;
+      }
       for (iVar = 0; iVar < nVar; iVar++) {
         total_index = iPoint*nVar + iVar;
         LinSysRes[total_index] = 0.0;
@@ -1726,25 +1929,35 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry **geometry, CSolver ***solv
     }
   }
 
-  /*--- Solve or smooth the linear system ---*/
-  
-  CSysMatrix** Jacobian_Array = new CSysMatrix*[config->GetMGLevels()+1];
-  CSysVector** LinSysRes_Array = new CSysVector*[config->GetMGLevels()+1];
-  CSysVector** LinSysSol_Array = new CSysVector*[config->GetMGLevels()+1];
-
-  for (iMGlevel = 0; iMGlevel <= config->GetMGLevels(); iMGlevel++) {
-    Jacobian_Array[iMGlevel] = &solver_container[iMGlevel][FLOW_SOL]->Jacobian;
-    LinSysRes_Array[iMGlevel] = &solver_container[iMGlevel][FLOW_SOL]->LinSysRes;
-    LinSysSol_Array[iMGlevel] = &solver_container[iMGlevel][FLOW_SOL]->LinSysSol;
+  /*--- Solve or smooth the linear system, the arrays of the levels are set in
+   the first iteration, and the solver keeps its workspace between iterations ---*/
+  
+  if (Jacobian_Array == NULL) {
+    Jacobian_Array = new CSysMatrix*[config->GetMGLevels()+1];
+    LinSysRes_Array = new CSysVector*[config->GetMGLevels()+1];
+    LinSysSol_Array = new CSysVector*[config->GetMGLevels()+1];
+    for (iMGlevel = 0; iMGlevel <= config->GetMGLevels(); iMGlevel++) {
+      Jacobian_Array[iMGlevel] = &solver_container[iMGlevel][FLOW_SOL]->Jacobian;
+      LinSysRes_Array[iMGlevel] = &solver_container[iMGlevel][FLOW_SOL]->LinSysRes;
+      LinSysSol_Array[iMGlevel] = &solver_container[iMGlevel][FLOW_SOL]->LinSysSol;
+    }
   }
   
-  CSysSolve system;
+  /*--- Snapshot of the system of the finest grid for the linear solver benchmark ---*/
+  
+  if ((iMesh == MESH_0) && (long(config->GetExtIter()) == config->GetLinear_Solver_Dump_Iter())) {
+    Jacobian.Write_System(LinSysRes, geometry[iMesh], config, config->GetLinear_Solver_Dump_FileName());
+    cout << "Linear system of the flow written in " << config->GetLinear_Solver_Dump_FileName() << "." << endl;
+  }
   
-  IterLinSol = system.Solve(Jacobian_Array, LinSysRes_Array, LinSysSol_Array, geometry, config, iMesh);
+  System.SetNew_Matrix(Jacobian_Update);
+  System.SetNew_Operator(true);
+  IterLinSol = System.Solve(Jacobian_Array, LinSysRes_Array, LinSysSol_Array, geometry, config, iMesh);
   
-  /*--- The the number of iterations of the linear solver ---*/
+  /*--- The the number of iterations and the tolerance of the linear solver ---*/
   
   SetIterLinSolver(IterLinSol);
+  SetTolLinSolver(System.GetTolerance());
   
   /*--- Update solution (system written in terms of increments) ---*/
   
@@ -1760,31 +1973,23 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry **geometry, CSolver ***solv
   
 }
 
-void CEulerSolver::SetPrimVar_Gradient_GG(CGeometry *geometry, CConfig *config) {
-  unsigned long iPoint, jPoint, iEdge, iVertex;
-  unsigned short iDim, iVar, iMarker;
-  double *PrimVar_Vertex, *PrimVar_i, *PrimVar_j, PrimVar_Average,
-  Partial_Gradient, Partial_Res, *Normal;
-  
-  /*--- Gradient primitive variables compressible (temp, vx, vy, vz, P, rho)
-   Gradient primitive variables incompressible (rho, vx, vy, vz, beta) ---*/
-  PrimVar_Vertex = new double [nPrimVarGrad];
-  PrimVar_i = new double [nPrimVarGrad];
-  PrimVar_j = new double [nPrimVarGrad];
+template <bool bounds>
+void CEulerSolver::SetPrimVar_Gradient_GG_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
   
-  /*--- Set Gradient_Primitive to zero ---*/
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CEulerSolver *solver = (CEulerSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CVariable **node = solver->node;
+  unsigned long iPoint, jPoint, iEdge;
+  unsigned short iDim, iVar, nDim = solver->nDim, nPrimVarGrad = solver->nPrimVarGrad;
+  double *PrimVar_i, *PrimVar_j, PrimVar_Average, Partial_Res, *Normal, du;
   
-  /*--- Loop interior edges ---*/
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     iPoint = geometry->edge[iEdge]->GetNode(0);
     jPoint = geometry->edge[iEdge]->GetNode(1);
     
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      PrimVar_i[iVar] = node[iPoint]->GetPrimVar(iVar);
-      PrimVar_j[iVar] = node[jPoint]->GetPrimVar(iVar);
-    }
+    PrimVar_i = node[iPoint]->GetPrimVar();
+    PrimVar_j = node[jPoint]->GetPrimVar();
     
     Normal = geometry->edge[iEdge]->GetNormal();
     for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
@@ -1797,8 +2002,58 @@ void CEulerSolver::SetPrimVar_Gradient_GG(CGeometry *geometry, CConfig *config)
           node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
       }
     }
+    
+    /*--- Bounds of the limiter, the same as SetPrimVar_Limiter_Bounds_Thread ---*/
+    
+    if (bounds) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        du = (PrimVar_j[iVar] - PrimVar_i[iVar]);
+        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
+        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+      }
+    }
   }
   
+}
+
+void CEulerSolver::SetPrimVar_Gradient_GG(CGeometry *geometry, CConfig *config) {
+  
+  SetPrimVar_Gradient_GG(geometry, config, false);
+  
+}
+
+void CEulerSolver::SetPrimVar_Gradient_GG(CGeometry *geometry, CConfig *config, bool val_bounds) {
+  unsigned long iPoint, iVertex;
+  unsigned short iDim, iVar, iMarker;
+  double *PrimVar_Vertex, Partial_Gradient, Partial_Res, *Normal;
+  
+  /*--- Gradient primitive variables compressible (temp, vx, vy, vz, P, rho)
+   Gradient primitive variables incompressible (rho, vx, vy, vz, beta) ---*/
+  PrimVar_Vertex = new double [nPrimVarGrad];
+  
+  /*--- Set Gradient_Primitive to zero, and initialize the limiter in the same pass ---*/
+  if (val_bounds) {
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      if (iPoint < nPointDomain) node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        node[iPoint]->SetSolution_Max(iVar, -EPS);
+        node[iPoint]->SetSolution_Min(iVar, EPS);
+        node[iPoint]->SetLimiter_Primitive(iVar, 2.0);
+      }
+    }
+  }
+  else if (Variable_Storage != NULL)
+    Variable_Storage->SetField_Zero(FIELD_GRADIENT_PRIMITIVE, nPointDomain);
+  else
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
+  
+  /*--- Loop interior edges (and bounds of the limiter) ---*/
+  Run_EdgeLoop(val_bounds ? SetPrimVar_Gradient_GG_Thread<true> : SetPrimVar_Gradient_GG_Thread<false>,
+               geometry, NULL, NULL, config, MESH_0);
+  
   /*--- Loop boundary edges ---*/
   for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
     for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
@@ -1829,162 +2084,83 @@ void CEulerSolver::SetPrimVar_Gradient_GG(CGeometry *geometry, CConfig *config)
   }
   
   delete [] PrimVar_Vertex;
-  delete [] PrimVar_i;
-  delete [] PrimVar_j;
   
 }
 
 void CEulerSolver::SetPrimVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
   
-  unsigned short iVar, iDim, jDim, iNeigh;
+  SetPrimVar_Gradient_LS(geometry, config, false);
+  
+}
+
+void CEulerSolver::SetPrimVar_Gradient_LS(CGeometry *geometry, CConfig *config, bool val_bounds) {
+  
+  unsigned short iVar, iDim, iNeigh;
   unsigned long iPoint, jPoint;
-  double *PrimVar_i, *PrimVar_j, *Coord_i, *Coord_j, r11, r12, r13, r22, r23, r23_a,
-  r23_b, r33, weight, product, z11, z12, z13, z22, z23, z33, detR2;
-  bool singular;
+  double *PrimVar_i, *PrimVar_j, *Coeff, Delta;
   
-  /*--- Loop over points of the grid ---*/
+  /*--- The least squares coefficients only depend on the grid, they are
+   computed once and reused until the coordinates change ---*/
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    
-    /*--- Set the value of the singular ---*/
-    singular = false;
-    
-    /*--- Get coordinates ---*/
-    
-    Coord_i = geometry->node[iPoint]->GetCoord();
-    
-    /*--- Get primitives from CVariable ---*/
+  geometry->SetLS_Coeff();
+  
+  /*--- Loop over points of the grid (all of them for the bounds of the limiter) ---*/
+  
+  for (iPoint = 0; iPoint < (val_bounds ? nPoint : nPointDomain); iPoint++) {
     
     PrimVar_i = node[iPoint]->GetPrimVar();
-    
-    /*--- Inizialization of variables ---*/
+    Coeff = geometry->GetLS_Coeff(iPoint);
     
     for (iVar = 0; iVar < nPrimVarGrad; iVar++)
       for (iDim = 0; iDim < nDim; iDim++)
         cvector[iVar][iDim] = 0.0;
     
-    r11 = 0.0; r12 = 0.0;   r13 = 0.0;    r22 = 0.0;
-    r23 = 0.0; r23_a = 0.0; r23_b = 0.0;  r33 = 0.0; detR2 = 0.0;
+    if (val_bounds) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        node[iPoint]->SetSolution_Max(iVar, -EPS);
+        node[iPoint]->SetSolution_Min(iVar, EPS);
+        node[iPoint]->SetLimiter_Primitive(iVar, 2.0);
+      }
+    }
+    
+    /*--- Computation of the gradient: sum of the coefficients times the differences. The
+     neighbours are the points of the edges of the point, so the bounds of the limiter are the
+     same as with the edge loop of SetPrimVar_Limiter ---*/
     
     for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
       jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-      Coord_j = geometry->node[jPoint]->GetCoord();
-      
       PrimVar_j = node[jPoint]->GetPrimVar();
-      
-      weight = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-      
-      /*--- Sumations for entries of upper triangular matrix R ---*/
-      
-      if (weight != 0.0) {
-        
-        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
-        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
-        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
-        
-        if (nDim == 3) {
-          r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        Delta = PrimVar_j[iVar]-PrimVar_i[iVar];
+        for (iDim = 0; iDim < nDim; iDim++)
+          cvector[iVar][iDim] += Coeff[iNeigh*nDim+iDim]*Delta;
+        if (val_bounds) {
+          node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), Delta));
+          node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), Delta));
         }
-        
-        /*--- Entries of c:= transpose(A)*b ---*/
-        
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            cvector[iVar][iDim] += (Coord_j[iDim]-Coord_i[iDim])*(PrimVar_j[iVar]-PrimVar_i[iVar])/weight;
-        
       }
-      
     }
     
-    /*--- Entries of upper triangular matrix R ---*/
-    
-    if (r11 >= 0.0) r11 = sqrt(r11); else r11 = 0.0;
-    if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
-    if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
-    
-    if (nDim == 3) {
-      if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
-      if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
-      if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
-    }
-    
-    /*--- Compute determinant ---*/
-    
-    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
-    else detR2 = (r11*r22*r33)*(r11*r22*r33);
-    
-    /*--- Detect singular matrices ---*/
-    
-    if (abs(detR2) <= EPS) { detR2 = 1.0; singular = true; }
-    
-    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-    
-    if (singular) {
-      for (iDim = 0; iDim < nDim; iDim++)
-        for (jDim = 0; jDim < nDim; jDim++)
-          Smatrix[iDim][jDim] = 0.0;
-    }
-    else {
-      if (nDim == 2) {
-        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-        Smatrix[0][1] = -r11*r12/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = r11*r11/detR2;
-      }
-      else {
-        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
-        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
-        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-        Smatrix[0][2] = (z13*z33)/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-        Smatrix[1][2] = (z23*z33)/detR2;
-        Smatrix[2][0] = Smatrix[0][2];
-        Smatrix[2][1] = Smatrix[1][2];
-        Smatrix[2][2] = (z33*z33)/detR2;
-      }
-    }
-    
-    /*--- Computation of the gradient: S*c ---*/
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      for (iDim = 0; iDim < nDim; iDim++) {
-        product = 0.0;
-        for (jDim = 0; jDim < nDim; jDim++) {
-          product += Smatrix[iDim][jDim]*cvector[iVar][jDim];
-        }
-        
-        node[iPoint]->SetGradient_Primitive(iVar, iDim, product);
-      }
-    }
+    if (iPoint < nPointDomain)
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          node[iPoint]->SetGradient_Primitive(iVar, iDim, cvector[iVar][iDim]);
     
   }
   
 }
 
-void CEulerSolver::SetPrimVar_Limiter(CGeometry *geometry, CConfig *config) {
+void CEulerSolver::SetPrimVar_Limiter_Bounds_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
   
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CEulerSolver *solver = (CEulerSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CVariable **node = solver->node;
   unsigned long iEdge, iPoint, jPoint;
-  unsigned short iVar, iDim;
-  double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j, *Primitive_i, *Primitive_j,
-  dave, LimK, eps1, eps2, dm, dp, du, limiter;
-  
-  /*--- Initialize solution max and solution min in the entire domain --*/
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      node[iPoint]->SetSolution_Max(iVar, -EPS);
-      node[iPoint]->SetSolution_Min(iVar, EPS);
-      node[iPoint]->SetLimiter_Primitive(iVar, 2.0);
-    }
-  }
+  unsigned short iVar, nPrimVarGrad = solver->nPrimVarGrad;
+  double *Primitive_i, *Primitive_j, du;
   
-  /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     /*--- Point identification, Normal vector and area ---*/
     iPoint = geometry->edge[iEdge]->GetNode(0);
@@ -2004,7 +2180,19 @@ void CEulerSolver::SetPrimVar_Limiter(CGeometry *geometry, CConfig *config) {
     }
   }
   
-  /*--- Venkatakrishnan (Venkatakrishnan 1994) limiter ---*/
+}
+
+void CEulerSolver::SetPrimVar_Limiter_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
+  
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CEulerSolver *solver = (CEulerSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CConfig *config = loop->config;
+  CVariable **node = solver->node;
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iVar, iDim, nDim = solver->nDim, nPrimVarGrad = solver->nPrimVarGrad;
+  double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j,
+  dave, LimK, eps1, eps2, dm, dp, limiter;
   
   /*-- Get limiter parameters from the configuration file ---*/
   dave = config->GetRefElemLength();
@@ -2012,12 +2200,10 @@ void CEulerSolver::SetPrimVar_Limiter(CGeometry *geometry, CConfig *config) {
   eps1 = LimK*dave;
   eps2 = eps1*eps1*eps1;
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     iPoint     = geometry->edge[iEdge]->GetNode(0);
     jPoint     = geometry->edge[iEdge]->GetNode(1);
-    Primitive_i = node[iPoint]->GetPrimVar();
-    Primitive_j = node[jPoint]->GetPrimVar();
     Gradient_i = node[iPoint]->GetGradient_Primitive();
     Gradient_j = node[jPoint]->GetGradient_Primitive();
     Coord_i    = geometry->node[iPoint]->GetCoord();
@@ -2060,6 +2246,118 @@ void CEulerSolver::SetPrimVar_Limiter(CGeometry *geometry, CConfig *config) {
   
 }
 
+void CEulerSolver::SetPrimVar_Limiter(CGeometry *geometry, CConfig *config) {
+  
+  SetPrimVar_Limiter(geometry, config, true);
+  
+}
+
+void CEulerSolver::SetPrimVar_Limiter(CGeometry *geometry, CConfig *config, bool val_bounds) {
+  
+  unsigned long iPoint;
+  unsigned short iVar;
+  
+  if (val_bounds) {
+    
+    /*--- Initialize solution max and solution min in the entire domain --*/
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        node[iPoint]->SetSolution_Max(iVar, -EPS);
+        node[iPoint]->SetSolution_Min(iVar, EPS);
+        node[iPoint]->SetLimiter_Primitive(iVar, 2.0);
+      }
+    }
+    
+    /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
+    Run_EdgeLoop(SetPrimVar_Limiter_Bounds_Thread, geometry, NULL, NULL, config, MESH_0);
+    
+  }
+  
+  /*--- Venkatakrishnan (Venkatakrishnan 1994) limiter ---*/
+  
+  Run_EdgeLoop(SetPrimVar_Limiter_Thread, geometry, NULL, NULL, config, MESH_0);
+  
+}
+
+void CEulerSolver::SetPrimVar_Edge_States_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
+  
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CEulerSolver *solver = (CEulerSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CConfig *config = loop->config;
+  CVariable **node = solver->node;
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iVar, iDim, nDim = solver->nDim, nPrimVarGrad = solver->nPrimVarGrad;
+  double **Gradient_i, **Gradient_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, *State_i, *State_j,
+  Vector_i[3], Vector_j[3], Project_Grad_i, Project_Grad_j;
+  
+  bool limiter = (config->GetSpatialOrder_Flow() == SECOND_ORDER_LIMITER);
+  
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
+    
+    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
+    V_i = node[iPoint]->GetPrimVar(); V_j = node[jPoint]->GetPrimVar();
+    State_i = &solver->Edge_Primitive[2*iEdge*nPrimVarGrad]; State_j = State_i + nPrimVarGrad;
+    
+    /*--- MUSCL reconstruction, the same as in Upwind_Residual_Thread ---*/
+    
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
+      Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
+    }
+    
+    Gradient_i = node[iPoint]->GetGradient_Primitive(); Gradient_j = node[jPoint]->GetGradient_Primitive();
+    if (limiter) { Limiter_i = node[iPoint]->GetLimiter_Primitive(); Limiter_j = node[jPoint]->GetLimiter_Primitive(); }
+    
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
+        Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
+      }
+      if (limiter) {
+        State_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+        State_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+      }
+      else {
+        State_i[iVar] = V_i[iVar] + Project_Grad_i;
+        State_j[iVar] = V_j[iVar] + Project_Grad_j;
+      }
+    }
+    
+  }
+  
+}
+
+void CEulerSolver::SetPrimVar_Reconstruction(CGeometry *geometry, CConfig *config, bool val_limiter) {
+  
+  bool fused = config->GetFused_Reconstruction();
+  bool upwind_second_order = ((config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) &&
+                              ((config->GetSpatialOrder_Flow() == SECOND_ORDER) ||
+                               (config->GetSpatialOrder_Flow() == SECOND_ORDER_LIMITER)));
+  
+  /*--- Gradient computation, the fused mode finds the bounds of the limiter in the same pass ---*/
+  
+  if (config->GetKind_Gradient_Method() == GREEN_GAUSS)
+    SetPrimVar_Gradient_GG(geometry, config, fused && val_limiter);
+  
+  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES)
+    SetPrimVar_Gradient_LS(geometry, config, fused && val_limiter);
+  
+  /*--- Limiter computation ---*/
+  
+  if (val_limiter) SetPrimVar_Limiter(geometry, config, !fused);
+  
+  /*--- Reconstructed states of the edges, the upwind residuals of the flow and of the
+   turbulence model read them instead of the coordinates, gradients and limiters ---*/
+  
+  if (fused && upwind_second_order) {
+    if (Edge_Primitive == NULL) Edge_Primitive = new double [2*geometry->GetnEdge()*nPrimVarGrad];
+    Run_EdgeLoop(SetPrimVar_Edge_States_Thread, geometry, NULL, NULL, config, MESH_0);
+  }
+  
+}
+
 void CEulerSolver::SetPreconditioner(CConfig *config, unsigned short iPoint) {
   unsigned short iDim, jDim, iVar, jVar;
   double Beta, local_Mach, Beta2, rho, enthalpy, soundspeed, sq_vel;
@@ -2118,7 +2416,7 @@ void CEulerSolver::BC_Euler_Wall(CGeometry *geometry, CSolver **solver_container
   double Pressure, *Normal = NULL, *GridVel = NULL, Area, UnitNormal[3],
   ProjGridVel = 0.0, a2, phi, turb_ke = 0.0;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
   bool grid_movement  = config->GetGrid_Movement();
   bool tkeNeeded = ((config->GetKind_Solver() == RANS) && (config->GetKind_Turb_Model() == SST));
   
@@ -2207,7 +2505,7 @@ void CEulerSolver::BC_Euler_Wall(CGeometry *geometry, CSolver **solver_container
             Jacobian_i[nDim+1][jDim+1] = -a2*node[iPoint]->GetVelocity(jDim)*ProjGridVel;
           Jacobian_i[nDim+1][nDim+1] = a2*ProjGridVel;
         }
-        Jacobian.AddBlock(iPoint,iPoint,Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
         
       }
     }
@@ -2234,7 +2532,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   
   double Gas_Constant     = config->GetGas_ConstantND();
   
-  bool implicit         = config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT;
+  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
   bool grid_movement    = config->GetGrid_Movement();
   bool viscous          = config->GetViscous();
   bool tkeNeeded = ((config->GetKind_Solver() == RANS) && (config->GetKind_Turb_Model() == SST));
@@ -2419,7 +2717,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
       
       /*--- Convective Jacobian contribution for implicit integration ---*/
       if (implicit)
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       
       /*--- Roe Turkel preconditioning, set the value of beta ---*/
       if (config->GetKind_Upwind() == TURKEL)
@@ -2453,7 +2751,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
         
         /*--- Viscous Jacobian contribution for implicit integration ---*/
         if (implicit)
-          Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+          Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
         
       }
     }
@@ -2473,7 +2771,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   alpha, aa, bb, cc, dd, Area, UnitNormal[3];
   double *V_inlet, *V_domain;
   
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
   bool grid_movement        = config->GetGrid_Movement();
   double Two_Gamma_M1       = 2.0/Gamma_Minus_One;
   double Gas_Constant       = config->GetGas_ConstantND();
@@ -2678,7 +2976,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
       
       /*--- Jacobian contribution for implicit integration ---*/
       if (implicit)
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       
       /*--- Roe Turkel preconditioning, set the value of beta ---*/
       if (config->GetKind_Upwind() == TURKEL)
@@ -2709,7 +3007,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
         
         /*--- Jacobian contribution for implicit integration ---*/
         if (implicit)
-          Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+          Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
         
       }
       
@@ -2730,7 +3028,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   Area, UnitNormal[3];
   double *V_outlet, *V_domain;
   
-  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
   double Gas_Constant     = config->GetGas_ConstantND();
   bool grid_movement      = config->GetGrid_Movement();
   string Marker_Tag       = config->GetMarker_All_TagBound(val_marker);
@@ -2848,7 +3146,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
       
       /*--- Jacobian contribution for implicit integration ---*/
       if (implicit) {
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       }
       
       /*--- Roe Turkel preconditioning, set the value of beta ---*/
@@ -2880,7 +3178,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
         
         /*--- Jacobian contribution for implicit integration ---*/
         if (implicit)
-          Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+          Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
         
       }
       
@@ -2913,7 +3211,7 @@ void CEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_co
   double Volume_nM1, Volume_nP1, TimeStep;
   double *Normal = NULL, *GridVel_i = NULL, *GridVel_j = NULL, Residual_GCL;
   
-  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
   bool grid_movement  = config->GetGrid_Movement();
   
   /*--- Store the physical time step ---*/
@@ -2964,7 +3262,7 @@ void CEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_co
           if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND)
             Jacobian_i[iVar][iVar] = (Volume_nP1*3.0)/(2.0*TimeStep);
         }
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       }
     }
     
@@ -3091,7 +3389,7 @@ void CEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_co
           if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND)
             Jacobian_i[iVar][iVar] = (3.0*Volume_nP1)/(2.0*TimeStep);
         }
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       }
     }
   }
@@ -3213,6 +3511,8 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
         
     /*--- Recompute the edges and  dual mesh control volumes in the
      domain and on the boundaries. ---*/
+    geometry[MESH_0]->ResetLS_Coeff();
+    geometry[MESH_0]->ResetEdge_Geometry();
     geometry[MESH_0]->SetCG();
     geometry[MESH_0]->SetControlVolume(config, UPDATE);
     geometry[MESH_0]->SetBoundControlVolume(config, UPDATE);
@@ -3372,12 +3672,18 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
     if (rank == MASTER_NODE) cout << "Initialize jacobian structure (Navier-Stokes). MG level: " << iMesh <<"." << endl;
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
     
-    if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
+    if ((config->GetKind_Linear_Solver_Prec_Rows() == LINELET) ||
         (config->GetKind_Linear_Solver() == SMOOTHER_LINELET)) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
     
+    if ((config->GetKind_Linear_Solver_Prec_Rows() == LU_SGS) || (config->GetKind_Linear_Solver_Prec_Rows() == ILU) ||
+        (config->GetKind_Linear_Solver() == SMOOTHER_LUSGS) || (config->GetKind_Linear_Solver() == SMOOTHER_ILU)) {
+      if (rank == MASTER_NODE) cout << "Compute sweep schedule. " << Jacobian.GetnSweepGroup() << " groups of independent rows, "
+        << Jacobian.GetSweep_Reversed() << "% of the couplings reordered." << endl;
+    }
+    
   } else {
     if (rank == MASTER_NODE)
       cout << "Explicit scheme. No jacobian structure (Navier-Stokes). MG level: " << iMesh <<"." << endl;
@@ -3644,6 +3950,9 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
     delete [] Global2Local;
   }
   
+  /*--- The variables of all the points are moved to contiguous fields ---*/
+  SetVariable_Storage();
+  
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
   counter_local = 0;
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -3774,24 +4083,27 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     }
   }
   
-  /*--- Compute gradient of the primitive variables ---*/
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimVar_Gradient_GG(geometry, config);
+  /*--- Compute gradient of the primitive variables, and the limiter in case we need it in the turbulence model
+   or to limit the viscous terms (check this logic with JST and 2nd order turbulence model). On the finest
+   grid the fused mode also stores the reconstructed states of the edges ---*/
+  if (iMesh == MESH_0) {
+    SetPrimVar_Reconstruction(geometry, config, limiter_flow || limiter_turb);
   }
-  
-  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimVar_Gradient_LS(geometry, config);
-  }
-  
-  /*--- Compute the limiter in case we need it in the turbulence model
-   or to limit the viscous terms (check this logic with JST and 2nd order turbulence model) ---*/
-  if ((iMesh == MESH_0) && (limiter_flow || limiter_turb)) {
-    SetPrimVar_Limiter(geometry, config);
+  else {
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+      SetPrimVar_Gradient_GG(geometry, config);
+    }
+    
+    if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+      SetPrimVar_Gradient_LS(geometry, config);
+    }
   }
   
-  /*--- Initialize the jacobian matrices ---*/
-  if (implicit) {
+  /*--- Initialize the jacobian matrices (a lagged Jacobian is kept) ---*/
+  if (implicit && Jacobian_Update) {
     Jacobian.SetValZero();
+    if (Jacobian_Delta != NULL)
+      for (iPoint = 0; iPoint < nPoint; iPoint++) Jacobian_Delta[iPoint] = 0.0;
   }
   
   /*--- Error message ---*/
@@ -3800,30 +4112,21 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   
 }
 
-void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned long Iteration) {
-  double *Normal, Area, Vol, Mean_SoundSpeed, Mean_ProjVel, Lambda, Local_Delta_Time, Local_Delta_Time_Visc,
-  Global_Delta_Time = 1E6, Mean_LaminarVisc, Mean_EddyVisc, Mean_Density, Lambda_1, Lambda_2, K_v = 0.25, Global_Delta_UnstTimeND;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
-  unsigned short iDim, iMarker;
-  double ProjVel, ProjVel_i, ProjVel_j;
-  
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool grid_movement = config->GetGrid_Movement();
-  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
-                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
-  
-  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+void CNSSolver::SetTime_Step_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
   
-  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed and viscosity ---*/
-  
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    node[iPoint]->SetMax_Lambda_Inv(0.0);
-    node[iPoint]->SetMax_Lambda_Visc(0.0);
-  }
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CNSSolver *solver = (CNSSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CVariable **node = solver->node;
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iDim, nDim = geometry->GetnDim();
+  double *Normal, Area, Mean_SoundSpeed, Mean_ProjVel, Lambda, Mean_LaminarVisc, Mean_EddyVisc, Mean_Density,
+  Lambda_1, Lambda_2, ProjVel_i, ProjVel_j, Gamma = solver->Gamma, Prandtl_Lam = solver->Prandtl_Lam,
+  Prandtl_Turb = solver->Prandtl_Turb;
   
-  /*--- Loop interior edges ---*/
+  bool grid_movement = loop->config->GetGrid_Movement();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     /*--- Point identification, Normal vector and area ---*/
     
@@ -3872,6 +4175,33 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
     
   }
   
+}
+
+void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned long Iteration) {
+  double *Normal, Area, Vol, Mean_SoundSpeed, Mean_ProjVel, Lambda, Local_Delta_Time, Local_Delta_Time_Visc,
+  Global_Delta_Time = 1E6, Mean_LaminarVisc, Mean_EddyVisc, Mean_Density, Lambda_1, Lambda_2, K_v = 0.25, Global_Delta_UnstTimeND;
+  unsigned long iVertex, iPoint = 0;
+  unsigned short iDim, iMarker;
+  double ProjVel;
+  
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool grid_movement = config->GetGrid_Movement();
+  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  
+  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  
+  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed and viscosity ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    node[iPoint]->SetMax_Lambda_Inv(0.0);
+    node[iPoint]->SetMax_Lambda_Visc(0.0);
+  }
+  
+  /*--- Loop interior edges ---*/
+  
+  Run_EdgeLoop(SetTime_Step_Thread, geometry, solver_container, NULL, config, iMesh);
+  
   /*--- Loop boundary edges ---*/
   
   for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
@@ -3970,46 +4300,87 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
   
 }
 
-void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
-                                 CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+template <class Num, bool implicit, bool sst>
+void CNSSolver::Viscous_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
+  
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CNSSolver *solver = (CNSSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CSolver **solver_container = loop->solver_container;
+  CConfig *config = loop->config;
+  Num *numerics = (Num *)loop->numerics->GetThread_Numerics(iThread);
+  CSolver_Work *Work = &solver->Thread_Work[iThread];
+  CVariable **node = solver->node;
   unsigned long iPoint, jPoint, iEdge;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
-    /*--- Points, coordinates and normal vector in edge ---*/
+    /*--- Points, coordinates, normal vector and geometric factors of the edge ---*/
     iPoint = geometry->edge[iEdge]->GetNode(0);
     jPoint = geometry->edge[iEdge]->GetNode(1);
     numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
     numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    numerics->SetEdge_Geometry(geometry->GetEdge_Geometry(iEdge));
     
     /*--- Primitive variables, and gradient ---*/
     numerics->SetPrimitive(node[iPoint]->GetPrimVar(), node[jPoint]->GetPrimVar());
     numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
     
     /*--- Turbulent kinetic energy ---*/
-    if (config->GetKind_Turb_Model() == SST)
+    if (sst)
       numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
                                      solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
     
     /*--- Compute and update residual ---*/
-    numerics->ComputeResidual(Res_Visc, Jacobian_i, Jacobian_j, config);
+    ComputeResidual_Static(numerics, Work->Residual, Work->Jacobian_i, Work->Jacobian_j, config);
     
-    LinSysRes.SubtractBlock(iPoint, Res_Visc);
-    LinSysRes.AddBlock(jPoint, Res_Visc);
+    solver->LinSysRes.SubtractBlock(iPoint, Work->Residual);
+    solver->LinSysRes.AddBlock(jPoint, Work->Residual);
     
     /*--- Implicit part ---*/
     if (implicit) {
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+      solver->Jacobian.UpdateBlocksSub(iEdge, Work->Jacobian_i, Work->Jacobian_j);
     }
   }
   
 }
 
+void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                                 CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+  
+  CGeometry::EdgeKernel kernel;
+  
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
+  bool sst = (config->GetKind_Turb_Model() == SST);
+  
+  /*--- The scheme (corrected average on the finest grid) and the options are resolved here, once for all the edges ---*/
+  
+  if (sst) {
+    if (typeid(*numerics) == typeid(CAvgGradCorrected_Flow))
+      kernel = (implicit ? Viscous_Residual_Thread<CAvgGradCorrected_Flow, true, true> : Viscous_Residual_Thread<CAvgGradCorrected_Flow, false, true>);
+    else if (typeid(*numerics) == typeid(CAvgGrad_Flow))
+      kernel = (implicit ? Viscous_Residual_Thread<CAvgGrad_Flow, true, true> : Viscous_Residual_Thread<CAvgGrad_Flow, false, true>);
+    else
+      kernel = (implicit ? Viscous_Residual_Thread<CNumerics, true, true> : Viscous_Residual_Thread<CNumerics, false, true>);
+  }
+  else {
+    if (typeid(*numerics) == typeid(CAvgGradCorrected_Flow))
+      kernel = (implicit ? Viscous_Residual_Thread<CAvgGradCorrected_Flow, true, false> : Viscous_Residual_Thread<CAvgGradCorrected_Flow, false, false>);
+    else if (typeid(*numerics) == typeid(CAvgGrad_Flow))
+      kernel = (implicit ? Viscous_Residual_Thread<CAvgGrad_Flow, true, false> : Viscous_Residual_Thread<CAvgGrad_Flow, false, false>);
+    else
+      kernel = (implicit ? Viscous_Residual_Thread<CNumerics, true, false> : Viscous_Residual_Thread<CNumerics, false, false>);
+  }
+  
+  /*--- Geometric factors of the edges, computed once for this grid (and again after it moves) ---*/
+  
+  geometry->SetEdge_Geometry();
+  
+  SetThread_Work(nPrimVar);
+  Run_EdgeLoop(kernel, geometry, solver_container, numerics, config, iMesh);
+  
+}
+
 void CNSSolver::Viscous_Forces(CGeometry *geometry, CConfig *config) {
   
   unsigned long iVertex, iPoint, iPointNormal;
@@ -4296,7 +4667,7 @@ void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container
   double laminar_viscosity, eddy_viscosity, **grad_primvar, tau[3][3];
   double delta[3][3] = {{1.0, 0.0, 0.0},{0.0,1.0,0.0},{0.0,0.0,1.0}};
   
-  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
   bool grid_movement  = config->GetGrid_Movement();
   
   /*--- Identify the boundary by string name ---*/
@@ -4417,7 +4788,7 @@ void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container
           Jacobian_i[nDim+1][nDim+1] = (Gamma-1.0)*ProjGridVel;
           
           /*--- Add the block to the Global Jacobian structure ---*/
-          Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+          Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
           
           /*--- Now the Jacobian contribution related to the shear stress ---*/
           for (iVar = 0; iVar < nVar; iVar++)
@@ -4473,7 +4844,7 @@ void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container
           }
           
           /*--- Subtract the block from the Global Jacobian structure ---*/
-          Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+          Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
         }
       }
       
@@ -4514,7 +4885,7 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
   double Gas_Constant = config->GetGas_ConstantND();
   double cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && Jacobian_Update;
   bool grid_movement  = config->GetGrid_Movement();
   
   Point_Normal = 0;
@@ -4634,7 +5005,7 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
         
         /*--- Subtract the block from the Global Jacobian structure ---*/
         
-        Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
         
       }
       
@@ -4717,7 +5088,7 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
           
           /*--- Add the block to the Global Jacobian structure ---*/
           
-          Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+          Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
           
           /*--- Now the Jacobian contribution related to the shear stress ---*/
           
@@ -4761,7 +5132,7 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
           
           /*--- Subtract the block from the Global Jacobian structure ---*/
           
-          Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+          Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
         }
         
       }
@@ -54,16 +54,30 @@ CTurbSolver::~CTurbSolver(void) {
   
 }
 
-void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config, unsigned short iMesh) {
-  
-  double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j;
+template <class Num, bool second_order, bool limiter>
+void CTurbSolver::Upwind_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
+  
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CTurbSolver *solver = (CTurbSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CSolver **solver_container = loop->solver_container;
+  CConfig *config = loop->config;
+  Num *numerics = (Num *)loop->numerics->GetThread_Numerics(iThread);
+  CSolver_Work *Work = &solver->Thread_Work[iThread];
+  CVariable **node = solver->node;
+  double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j,
+  *Edge_Primitive = NULL;
   unsigned long iEdge, iPoint, jPoint;
-  unsigned short iDim, iVar;
+  unsigned short iDim, iVar, nDim = solver->nDim, nVar = solver->nVar,
+  nPrimVarGrad = solver_container[FLOW_SOL]->GetnPrimVarGrad();
   
-  bool second_order  = ((config->GetSpatialOrder() == SECOND_ORDER) || (config->GetSpatialOrder() == SECOND_ORDER_LIMITER));
-  bool limiter       = (config->GetSpatialOrder() == SECOND_ORDER_LIMITER);
+  /*--- The face states stored by the fused reconstruction of the flow are reused if they
+   were reconstructed with the same limiter ---*/
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  if (second_order && (limiter == (config->GetSpatialOrder_Flow() == SECOND_ORDER_LIMITER)))
+    Edge_Primitive = solver_container[FLOW_SOL]->GetEdge_Primitive();
+  
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     /*--- Points in edge and normal vectors ---*/
     
@@ -86,37 +100,44 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
     if (second_order) {
       
       for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
+        Work->Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
+        Work->Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
       }
       
       /*--- Mean flow primitive variables using gradient reconstruction and limiters ---*/
       
-      Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
-      Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
-      if (limiter) {
-        Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
+      if (Edge_Primitive != NULL) {
+        numerics->SetPrimitive(&Edge_Primitive[2*iEdge*nPrimVarGrad], &Edge_Primitive[(2*iEdge+1)*nPrimVarGrad]);
       }
-      
-      for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
-        }
+      else {
+        
+        Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+        Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
         if (limiter) {
-          FlowPrimVar_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          FlowPrimVar_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+          Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
+          Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
         }
-        else {
-          FlowPrimVar_i[iVar] = V_i[iVar] + Project_Grad_i;
-          FlowPrimVar_j[iVar] = V_j[iVar] + Project_Grad_j;
+        
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++) {
+            Project_Grad_i += Work->Vector_i[iDim]*Gradient_i[iVar][iDim];
+            Project_Grad_j += Work->Vector_j[iDim]*Gradient_j[iVar][iDim];
+          }
+          if (limiter) {
+            Work->Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+            Work->Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+          }
+          else {
+            Work->Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
+            Work->Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+          }
         }
+        
+        numerics->SetPrimitive(Work->Primitive_i, Work->Primitive_j);
+        
       }
       
-      numerics->SetPrimitive(FlowPrimVar_i, FlowPrimVar_j);
-      
       /*--- Turbulent variables using gradient reconstruction and limiters ---*/
       
       Gradient_i = node[iPoint]->GetGradient();
@@ -129,57 +150,91 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
       for (iVar = 0; iVar < nVar; iVar++) {
         Project_Grad_i = 0.0; Project_Grad_j = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
+          Project_Grad_i += Work->Vector_i[iDim]*Gradient_i[iVar][iDim];
+          Project_Grad_j += Work->Vector_j[iDim]*Gradient_j[iVar][iDim];
         }
         if (limiter) {
-          Solution_i[iVar] = Turb_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Solution_j[iVar] = Turb_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+          Work->Solution_i[iVar] = Turb_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+          Work->Solution_j[iVar] = Turb_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
         }
         else {
-          Solution_i[iVar] = Turb_i[iVar] + Project_Grad_i;
-          Solution_j[iVar] = Turb_j[iVar] + Project_Grad_j;
+          Work->Solution_i[iVar] = Turb_i[iVar] + Project_Grad_i;
+          Work->Solution_j[iVar] = Turb_j[iVar] + Project_Grad_j;
         }
       }
       
-      numerics->SetTurbVar(Solution_i, Solution_j);
+      numerics->SetTurbVar(Work->Solution_i, Work->Solution_j);
       
     }
  
     /*--- Add and subtract residual ---*/
     
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    ComputeResidual_Static(numerics, Work->Residual, Work->Jacobian_i, Work->Jacobian_j, config);
     
-    LinSysRes.AddBlock(iPoint, Residual);
-    LinSysRes.SubtractBlock(jPoint, Residual);
+    solver->LinSysRes.AddBlock(iPoint, Work->Residual);
+    solver->LinSysRes.SubtractBlock(jPoint, Work->Residual);
     
     /*--- Implicit part ---*/
     
-    Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+    solver->Jacobian.UpdateBlocks(iEdge, Work->Jacobian_i, Work->Jacobian_j);
     
   }
   
 }
 
-void CTurbSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
-                                   CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+template <class Num>
+CGeometry::EdgeKernel CTurbSolver::Upwind_Residual_Kernel(bool second_order, bool limiter) {
+  
+  if (!second_order) return Upwind_Residual_Thread<Num, false, false>;
+  else if (!limiter) return Upwind_Residual_Thread<Num, true, false>;
+  else return Upwind_Residual_Thread<Num, true, true>;
+  
+}
+
+void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config, unsigned short iMesh) {
+  
+  CGeometry::EdgeKernel kernel;
+  
+  bool second_order  = ((config->GetSpatialOrder() == SECOND_ORDER) || (config->GetSpatialOrder() == SECOND_ORDER_LIMITER));
+  bool limiter       = (config->GetSpatialOrder() == SECOND_ORDER_LIMITER);
+  
+  /*--- The scheme of the model and the options are resolved here, once for all the edges ---*/
+  
+  if (typeid(*numerics) == typeid(CUpwSca_TurbSA)) kernel = Upwind_Residual_Kernel<CUpwSca_TurbSA>(second_order, limiter);
+  else if (typeid(*numerics) == typeid(CUpwSca_TurbSST)) kernel = Upwind_Residual_Kernel<CUpwSca_TurbSST>(second_order, limiter);
+  else kernel = Upwind_Residual_Kernel<CNumerics>(second_order, limiter);
+  
+  SetThread_Work(nDim+7);
+  Run_EdgeLoop(kernel, geometry, solver_container, numerics, config, iMesh);
+  
+}
+
+template <class Num, bool sst>
+void CTurbSolver::Viscous_Residual_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
+  
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CTurbSolver *solver = (CTurbSolver *)loop->solver;
+  CGeometry *geometry = loop->geometry;
+  CSolver **solver_container = loop->solver_container;
+  CConfig *config = loop->config;
+  Num *numerics = (Num *)loop->numerics->GetThread_Numerics(iThread);
+  CSolver_Work *Work = &solver->Thread_Work[iThread];
+  CVariable **node = solver->node;
   unsigned long iEdge, iPoint, jPoint;
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     /*--- Points in edge ---*/
     
     iPoint = geometry->edge[iEdge]->GetNode(0);
     jPoint = geometry->edge[iEdge]->GetNode(1);
     
-    /*--- Points coordinates, and normal vector ---*/
+    /*--- Points coordinates, normal vector, and geometric factors of the edge ---*/
     
     numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
                        geometry->node[jPoint]->GetCoord());
     numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    numerics->SetEdge_Geometry(geometry->GetEdge_Geometry(iEdge));
     
     /*--- Conservative variables w/o reconstruction ---*/
     
@@ -192,27 +247,47 @@ void CTurbSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
     numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), node[jPoint]->GetGradient());
     
     /*--- Menter's first blending function (only SST)---*/
-    if (config->GetKind_Turb_Model() == SST)
+    if (sst)
       numerics->SetF1blending(node[iPoint]->GetF1blending(),node[jPoint]->GetF1blending());
     
     /*--- Compute residual, and Jacobians ---*/
     
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    ComputeResidual_Static(numerics, Work->Residual, Work->Jacobian_i, Work->Jacobian_j, config);
     
     /*--- Add and subtract residual, and update Jacobians ---*/
     
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
+    solver->LinSysRes.SubtractBlock(iPoint, Work->Residual);
+    solver->LinSysRes.AddBlock(jPoint, Work->Residual);
     
-    Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    solver->Jacobian.UpdateBlocksSub(iEdge, Work->Jacobian_i, Work->Jacobian_j);
     
   }
   
 }
 
+void CTurbSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                                   CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+  
+  CGeometry::EdgeKernel kernel;
+  
+  /*--- The scheme of the model (corrected average on the finest grid) is resolved here, once for all the edges ---*/
+  
+  if (typeid(*numerics) == typeid(CAvgGradCorrected_TurbSA)) kernel = Viscous_Residual_Thread<CAvgGradCorrected_TurbSA, false>;
+  else if (typeid(*numerics) == typeid(CAvgGrad_TurbSA)) kernel = Viscous_Residual_Thread<CAvgGrad_TurbSA, false>;
+  else if (typeid(*numerics) == typeid(CAvgGradCorrected_TurbSST)) kernel = Viscous_Residual_Thread<CAvgGradCorrected_TurbSST, true>;
+  else if (typeid(*numerics) == typeid(CAvgGrad_TurbSST)) kernel = Viscous_Residual_Thread<CAvgGrad_TurbSST, true>;
+  else if (config->GetKind_Turb_Model() == SST) kernel = Viscous_Residual_Thread<CNumerics, true>;
+  else kernel = Viscous_Residual_Thread<CNumerics, false>;
+  
+  /*--- Geometric factors of the edges, computed once for this grid (and again after it moves) ---*/
+  
+  geometry->SetEdge_Geometry();
+  
+  SetThread_Work(nDim+7);
+  Run_EdgeLoop(kernel, geometry, solver_container, numerics, config, iMesh);
+  
+}
+
 void CTurbSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
   /*--- Convective fluxes across symmetry plane are equal to zero. ---*/
 }
@@ -276,23 +351,28 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry **geometry, CSolver ***solve
     }
   }
   
-  /*--- Solve or smooth the linear system (No linear multigrid available) ---*/
-  
-  CSysMatrix** Jacobian_Array = new CSysMatrix*[1];
-  CSysVector** LinSysRes_Array = new CSysVector*[1];
-  CSysVector** LinSysSol_Array = new CSysVector*[1];
-  
-  Jacobian_Array[MESH_0] = &solver_container[MESH_0][TURB_SOL]->Jacobian;
-  LinSysRes_Array[MESH_0] = &solver_container[MESH_0][TURB_SOL]->LinSysRes;
-  LinSysSol_Array[MESH_0] = &solver_container[MESH_0][TURB_SOL]->LinSysSol;
+  /*--- Solve or smooth the linear system (No linear multigrid available), the
+   arrays are set in the first iteration, and the solver keeps its workspace ---*/
   
-  CSysSolve system;
+  if (Jacobian_Array == NULL) {
+    Jacobian_Array = new CSysMatrix*[1];
+    LinSysRes_Array = new CSysVector*[1];
+    LinSysSol_Array = new CSysVector*[1];
+    Jacobian_Array[MESH_0] = &solver_container[MESH_0][TURB_SOL]->Jacobian;
+    LinSysRes_Array[MESH_0] = &solver_container[MESH_0][TURB_SOL]->LinSysRes;
+    LinSysSol_Array[MESH_0] = &solver_container[MESH_0][TURB_SOL]->LinSysSol;
+    
+    /*--- The turbulence Jacobians of the coarse grids are not assembled, a
+     multigrid preconditioner can only use Galerkin coarse operators ---*/
+    
+    System.SetCoarse_Jacobian(false);
+  }
   
   if (ChangeSolver) {
     config->SetKind_Linear_Solver(FGMRES);
     config->SetLinear_Solver_Iter(100);
   }
-  IterLinSol = system.Solve(Jacobian_Array, LinSysRes_Array, LinSysSol_Array, geometry, config, MESH_0);
+  IterLinSol = System.Solve(Jacobian_Array, LinSysRes_Array, LinSysSol_Array, geometry, config, MESH_0);
   if (ChangeSolver) {
     config->SetKind_Linear_Solver(Kind_Linear_Solver);
     config->SetLinear_Solver_Iter(Linear_Solver_Iter);
@@ -417,7 +497,7 @@ void CTurbSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_con
           if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND)
             Jacobian_i[iVar][iVar] = (Volume_nP1*3.0)/(2.0*TimeStep);
         }
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       }
     }
     
@@ -587,7 +667,7 @@ void CTurbSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_con
           if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND)
             Jacobian_i[iVar][iVar] = (3.0*Volume_nP1)/(2.0*TimeStep);
         }
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       }
     }
   }
@@ -648,12 +728,18 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     if (rank == MASTER_NODE) cout << "Initialize jacobian structure (SA model)." << endl;
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
     
-    if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
+    if ((config->GetKind_Linear_Solver_Prec_Rows() == LINELET) ||
         (config->GetKind_Linear_Solver() == SMOOTHER_LINELET)) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
     
+    if ((config->GetKind_Linear_Solver_Prec_Rows() == LU_SGS) || (config->GetKind_Linear_Solver_Prec_Rows() == ILU) ||
+        (config->GetKind_Linear_Solver() == SMOOTHER_LUSGS) || (config->GetKind_Linear_Solver() == SMOOTHER_ILU)) {
+      if (rank == MASTER_NODE) cout << "Compute sweep schedule. " << Jacobian.GetnSweepGroup() << " groups of independent rows, "
+        << Jacobian.GetSweep_Reversed() << "% of the couplings reordered." << endl;
+    }
+    
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     
@@ -788,7 +874,10 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     /*--- Free memory needed for the transformation ---*/
     delete [] Global2Local;
   }
-    
+  
+  /*--- The variables of all the points are moved to contiguous fields ---*/
+  SetVariable_Storage();
+  
 }
 
 CTurbSASolver::~CTurbSASolver(void) {
@@ -852,6 +941,18 @@ void CTurbSASolver::Postprocessing(CGeometry *geometry, CSolver **solver_contain
 
 void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CNumerics *second_numerics,
                                     CConfig *config, unsigned short iMesh) {
+  
+  /*--- The source of the model is resolved here, once for all the points ---*/
+  
+  if (typeid(*numerics) == typeid(CSourcePieceWise_TurbSA))
+    Source_Residual_Points((CSourcePieceWise_TurbSA *)numerics, geometry, solver_container, config);
+  else
+    Source_Residual_Points(numerics, geometry, solver_container, config);
+  
+}
+
+template <class Num>
+void CTurbSASolver::Source_Residual_Points(Num *numerics, CGeometry *geometry, CSolver **solver_container, CConfig *config) {
   unsigned long iPoint;
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -875,12 +976,12 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
     numerics->SetDistance(geometry->node[iPoint]->GetWall_Distance(), 0.0);
     
     /*--- Compute the source term ---*/
-    numerics->ComputeResidual(Residual, Jacobian_i, NULL, config);
+    ComputeResidual_Static(numerics, Residual, Jacobian_i, NULL, config);
     
     /*--- Subtract residual and the jacobian ---*/
     LinSysRes.SubtractBlock(iPoint, Residual);
     
-    Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+    Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
     
   }
   
@@ -980,7 +1081,7 @@ void CTurbSASolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container
       
       /*--- Add residuals and jacobians ---*/
       LinSysRes.AddBlock(iPoint, Residual);
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       
     }
   }
@@ -1037,7 +1138,7 @@ void CTurbSASolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, CN
       LinSysRes.AddBlock(iPoint, Residual);
       
       /*--- Jacobian contribution for implicit integration ---*/
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       
       /*--- Viscous contribution ---*/
       visc_numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[Point_Normal]->GetCoord());
@@ -1055,7 +1156,7 @@ void CTurbSASolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, CN
       
       /*--- Subtract residual, and update Jacobians ---*/
       LinSysRes.SubtractBlock(iPoint, Residual);
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
       
     }
   }
@@ -1114,7 +1215,7 @@ void CTurbSASolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container, C
       LinSysRes.AddBlock(iPoint, Residual);
       
       /*--- Jacobian contribution for implicit integration ---*/
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       
       /*--- Viscous contribution ---*/
       visc_numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[Point_Normal]->GetCoord());
@@ -1132,7 +1233,7 @@ void CTurbSASolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container, C
       
       /*--- Subtract residual, and update Jacobians ---*/
       LinSysRes.SubtractBlock(iPoint, Residual);
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
       
     }
   }
@@ -1297,12 +1398,18 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     if (rank == MASTER_NODE) cout << "Initialize jacobian structure (SST model)." << endl;
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
     
-    if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
+    if ((config->GetKind_Linear_Solver_Prec_Rows() == LINELET) ||
         (config->GetKind_Linear_Solver() == SMOOTHER_LINELET)) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
     
+    if ((config->GetKind_Linear_Solver_Prec_Rows() == LU_SGS) || (config->GetKind_Linear_Solver_Prec_Rows() == ILU) ||
+        (config->GetKind_Linear_Solver() == SMOOTHER_LUSGS) || (config->GetKind_Linear_Solver() == SMOOTHER_ILU)) {
+      if (rank == MASTER_NODE) cout << "Compute sweep schedule. " << Jacobian.GetnSweepGroup() << " groups of independent rows, "
+        << Jacobian.GetSweep_Reversed() << "% of the couplings reordered." << endl;
+    }
+    
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
   }
@@ -1433,6 +1540,9 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     delete [] Global2Local;
   }
   
+  /*--- The variables of all the points are moved to contiguous fields ---*/
+  SetVariable_Storage();
+  
 }
 
 CTurbSSTSolver::~CTurbSSTSolver(void) {
@@ -1514,6 +1624,18 @@ void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_contai
 
 void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CNumerics *second_numerics, CConfig *config, unsigned short iMesh) {
   
+  /*--- The source of the model is resolved here, once for all the points ---*/
+  
+  if (typeid(*numerics) == typeid(CSourcePieceWise_TurbSST))
+    Source_Residual_Points((CSourcePieceWise_TurbSST *)numerics, geometry, solver_container, config);
+  else
+    Source_Residual_Points(numerics, geometry, solver_container, config);
+  
+}
+
+template <class Num>
+void CTurbSSTSolver::Source_Residual_Points(Num *numerics, CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+  
   unsigned long iPoint;
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -1557,12 +1679,12 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
     
     /*--- Compute the source term ---*/
     
-    numerics->ComputeResidual(Residual, Jacobian_i, NULL, config);
+    ComputeResidual_Static(numerics, Residual, Jacobian_i, NULL, config);
     
     /*--- Subtract residual and the jacobian ---*/
     
     LinSysRes.SubtractBlock(iPoint, Residual);
-    Jacobian.SubtractBlock(iPoint,iPoint,Jacobian_i);
+    Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
     
   }
   
@@ -1711,7 +1833,7 @@ void CTurbSSTSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_containe
       /*--- Add residuals and jacobians ---*/
       
       LinSysRes.AddBlock(iPoint, Residual);
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       
     }
   }
@@ -1773,7 +1895,7 @@ void CTurbSSTSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, C
       LinSysRes.AddBlock(iPoint, Residual);
       
       /*--- Jacobian contribution for implicit integration ---*/
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       
       /*--- Viscous contribution ---*/
       visc_numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[Point_Normal]->GetCoord());
@@ -1794,7 +1916,7 @@ void CTurbSSTSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, C
       
       /*--- Subtract residual, and update Jacobians ---*/
       LinSysRes.SubtractBlock(iPoint, Residual);
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
       
     }
   }
@@ -1853,7 +1975,7 @@ void CTurbSSTSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
       LinSysRes.AddBlock(iPoint, Residual);
       
       /*--- Jacobian contribution for implicit integration ---*/
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       
       /*--- Viscous contribution ---*/
       visc_numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[Point_Normal]->GetCoord());
@@ -1874,7 +1996,7 @@ void CTurbSSTSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
       
       /*--- Subtract residual, and update Jacobians ---*/
       LinSysRes.SubtractBlock(iPoint, Residual);
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
       
     }
   }
@@ -25,6 +25,8 @@
 CSolver::CSolver(void) {
   
   /*--- Array initialization ---*/
+  nResidual_Eval = 0;
+  TolLinSolver = 0.0;
   OutputHeadingNames = NULL;
 	Residual_RMS = NULL;
   Residual_Max = NULL;
@@ -55,6 +57,16 @@ CSolver::CSolver(void) {
 	cvector = NULL;
   node = NULL;
   nOutputVariables = 0;
+  Jacobian_Array = NULL;
+  LinSysRes_Array = NULL;
+  LinSysSol_Array = NULL;
+  Jacobian_Update = true;
+  Jacobian_Delta = NULL;
+  Jacobian_Identity = false;
+  Edge_Primitive = NULL;
+  Thread_Work = NULL;
+  nThread_Work = 0;
+  Variable_Storage = NULL;
   
 }
 
@@ -62,6 +74,33 @@ CSolver::~CSolver(void) {
   if( OutputHeadingNames != NULL){
     delete []OutputHeadingNames;
   }
+  if (Jacobian_Array != NULL) delete [] Jacobian_Array;
+  if (LinSysRes_Array != NULL) delete [] LinSysRes_Array;
+  if (LinSysSol_Array != NULL) delete [] LinSysSol_Array;
+  if (Jacobian_Delta != NULL) delete [] Jacobian_Delta;
+  if (Edge_Primitive != NULL) delete [] Edge_Primitive;
+  if (Thread_Work != NULL) {
+    for (unsigned short iThread = 0; iThread < nThread_Work; iThread++) {
+      delete [] Thread_Work[iThread].Residual;
+      delete [] Thread_Work[iThread].Primitive_i; delete [] Thread_Work[iThread].Primitive_j;
+      delete [] Thread_Work[iThread].Solution_i; delete [] Thread_Work[iThread].Solution_j;
+      delete [] Thread_Work[iThread].Vector_i; delete [] Thread_Work[iThread].Vector_j;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        delete [] Thread_Work[iThread].Jacobian_i[iVar];
+        delete [] Thread_Work[iThread].Jacobian_j[iVar];
+      }
+      delete [] Thread_Work[iThread].Jacobian_i; delete [] Thread_Work[iThread].Jacobian_j;
+      delete [] Thread_Work[iThread].Lanes_V_i; delete [] Thread_Work[iThread].Lanes_V_j;
+      delete [] Thread_Work[iThread].Lanes_Normal; delete [] Thread_Work[iThread].Lanes_Residual;
+      delete [] Thread_Work[iThread].Lanes_Jacobian_i; delete [] Thread_Work[iThread].Lanes_Jacobian_j;
+      delete [] Thread_Work[iThread].Lanes_Edge;
+    }
+    delete [] Thread_Work;
+  }
+  if (Variable_Storage != NULL) {
+    Variable_Storage->Release(node);
+    delete Variable_Storage;
+  }
   //  delete [] OutputHeadingNames;
   /*  unsigned short iVar, iDim;
    unsigned long iPoint;
@@ -153,6 +192,67 @@ CSolver::~CSolver(void) {
   
 }
 
+void CSolver::SetThread_Work(unsigned short val_nPrimVar) {
+  
+  unsigned short iThread, iVar, jVar;
+  
+  if (Thread_Work != NULL) return;
+  
+  nThread_Work = CThreadPool::GetnThread();
+  Thread_Work = new CSolver_Work [nThread_Work];
+  
+  for (iThread = 0; iThread < nThread_Work; iThread++) {
+    Thread_Work[iThread].Residual = new double [nVar];
+    Thread_Work[iThread].Primitive_i = new double [val_nPrimVar];
+    Thread_Work[iThread].Primitive_j = new double [val_nPrimVar];
+    Thread_Work[iThread].Solution_i = new double [nVar];
+    Thread_Work[iThread].Solution_j = new double [nVar];
+    Thread_Work[iThread].Vector_i = new double [nDim];
+    Thread_Work[iThread].Vector_j = new double [nDim];
+    Thread_Work[iThread].Jacobian_i = new double* [nVar];
+    Thread_Work[iThread].Jacobian_j = new double* [nVar];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Thread_Work[iThread].Jacobian_i[iVar] = new double [nVar];
+      Thread_Work[iThread].Jacobian_j[iVar] = new double [nVar];
+      for (jVar = 0; jVar < nVar; jVar++) {
+        Thread_Work[iThread].Jacobian_i[iVar][jVar] = 0.0;
+        Thread_Work[iThread].Jacobian_j[iVar][jVar] = 0.0;
+      }
+    }
+    Thread_Work[iThread].Lanes_V_i = new double [val_nPrimVar*NUMERICS_LANES];
+    Thread_Work[iThread].Lanes_V_j = new double [val_nPrimVar*NUMERICS_LANES];
+    Thread_Work[iThread].Lanes_Normal = new double [nDim*NUMERICS_LANES];
+    Thread_Work[iThread].Lanes_Residual = new double [nVar*NUMERICS_LANES];
+    Thread_Work[iThread].Lanes_Jacobian_i = new double [nVar*nVar*NUMERICS_LANES];
+    Thread_Work[iThread].Lanes_Jacobian_j = new double [nVar*nVar*NUMERICS_LANES];
+    Thread_Work[iThread].Lanes_Edge = new unsigned long [NUMERICS_LANES];
+  }
+  
+}
+
+void CSolver::SetVariable_Storage(void) {
+  
+  if (Variable_Storage != NULL) return;
+  
+  Variable_Storage = new CVariableStorage(nPoint);
+  Variable_Storage->Gather(node);
+  
+}
+
+void CSolver::Run_EdgeLoop(CGeometry::EdgeKernel kernel, CGeometry *geometry, CSolver **solver_container,
+                           CNumerics *numerics, CConfig *config, unsigned short iMesh) {
+  
+  CSolver_Loop loop;
+  loop.solver = this;
+  loop.geometry = geometry;
+  loop.solver_container = solver_container;
+  loop.numerics = numerics;
+  loop.config = config;
+  loop.iMesh = iMesh;
+  geometry->Run_EdgeLoop(kernel, &loop);
+  
+}
+
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
   unsigned short iVar;
   
@@ -161,6 +261,23 @@ void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
     
 }
 
+void CSolver::SetTime_Step_Diagonal(CGeometry *geometry) {
+  unsigned long iPoint;
+  double Delta;
+  
+  if (Jacobian_Delta == NULL) {
+    Jacobian_Delta = new double [nPoint];
+    for (iPoint = 0; iPoint < nPoint; iPoint++) Jacobian_Delta[iPoint] = 0.0;
+  }
+  
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    Delta = geometry->node[iPoint]->GetVolume() / node[iPoint]->GetDelta_Time();
+    Jacobian.AddVal2Diag(iPoint, Delta - Jacobian_Delta[iPoint]);
+    Jacobian_Delta[iPoint] = Delta;
+  }
+  
+}
+
 void CSolver::SetGrid_Movement_Residual (CGeometry *geometry, CConfig *config) {
   
 	unsigned short nDim = geometry->GetnDim();
@@ -280,136 +397,50 @@ void CSolver::SetAuxVar_Gradient_GG(CGeometry *geometry) {
 
 void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
   
-	unsigned short iDim, jDim, iNeigh;
+	unsigned short iDim, iNeigh;
 	unsigned short nDim = geometry->GetnDim();
 	unsigned long iPoint, jPoint;
-	double *Coord_i, *Coord_j, AuxVar_i, AuxVar_j, weight, r11, r12, r13, r22, r23, r23_a,
-  r23_b, r33, z11, z12, z13, z22, z23, z33, detR2, product;
-  bool singular = false;
+	double *Coeff, AuxVar_i, Delta, Grad[3];
   
-	double *cvector = new double [nDim];
+  /*--- Coefficients of the least squares gradients (computed once per grid) ---*/
+  
+  geometry->SetLS_Coeff();
   
 	/*--- Loop over points of the grid ---*/
 	for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
     
-		Coord_i = geometry->node[iPoint]->GetCoord();
+    if (!geometry->node[iPoint]->GetDomain()) continue;
+    
 		AuxVar_i = node[iPoint]->GetAuxVar();
+    Coeff = geometry->GetLS_Coeff(iPoint);
     
-		/*--- Inizialization of variables ---*/
 		for (iDim = 0; iDim < nDim; iDim++)
-			cvector[iDim] = 0.0;
-    
-    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
-    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
+			Grad[iDim] = 0.0;
     
 		for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
 			jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-			Coord_j = geometry->node[jPoint]->GetCoord();
-			AuxVar_j = node[jPoint]->GetAuxVar();
-      
-			weight = 0.0;
+      Delta = node[jPoint]->GetAuxVar()-AuxVar_i;
 			for (iDim = 0; iDim < nDim; iDim++)
-				weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-      
-			/*--- Sumations for entries of upper triangular matrix R ---*/
-      
-      if (fabs(weight) > EPS){
-        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
-        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
-        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
-        if (nDim == 3) {
-          r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
-        }
-        
-        /*--- Entries of c:= transpose(A)*b ---*/
-        
-        for (iDim = 0; iDim < nDim; iDim++)
-          cvector[iDim] += (Coord_j[iDim]-Coord_i[iDim])*(AuxVar_j-AuxVar_i)/(weight);
-      }
-      
+				Grad[iDim] += Coeff[iNeigh*nDim+iDim]*Delta;
 		}
     
-		/*--- Entries of upper triangular matrix R ---*/
-    
-    if (fabs(r11) < EPS) r11 = EPS;
-		r11 = sqrt(r11);
-		r12 = r12/r11;
-		r22 = sqrt(r22-r12*r12);
-    if (fabs(r22) < EPS) r22 = EPS;
-		if (nDim == 3) {
-			r13 = r13/r11;
-			r23 = r23_a/(r22) - r23_b*r12/(r11*r22);
-			r33 = sqrt(r33-r23*r23-r13*r13);
-		}
-    
-    /*--- Compute determinant ---*/
-    
-    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
-    else detR2 = (r11*r22*r33)*(r11*r22*r33);
-    
-    /*--- Detect singular matrices ---*/
-    
-    if (fabs(detR2) < EPS) singular = true;
-    
-		/*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-    
-    if (singular) {
-      for (iDim = 0; iDim < nDim; iDim++)
-        for (jDim = 0; jDim < nDim; jDim++)
-          Smatrix[iDim][jDim] = 0.0;
-    }
-    else {
-      if (nDim == 2) {
-        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-        Smatrix[0][1] = -r11*r12/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = r11*r11/detR2;
-      }
-      else {
-        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
-        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
-        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-        Smatrix[0][2] = (z13*z33)/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-        Smatrix[1][2] = (z23*z33)/detR2;
-        Smatrix[2][0] = Smatrix[0][2];
-        Smatrix[2][1] = Smatrix[1][2];
-        Smatrix[2][2] = (z33*z33)/detR2;
-      }
-    }
-    
-		/*--- Computation of the gradient: S*c ---*/
+		for (iDim = 0; iDim < nDim; iDim++)
+			node[iPoint]->SetAuxVarGradient(iDim, Grad[iDim]);
     
-		for (iDim = 0; iDim < nDim; iDim++) {
-			product = 0.0;
-			for (jDim = 0; jDim < nDim; jDim++)
-				product += Smatrix[iDim][jDim]*cvector[jDim];
-			if (geometry->node[iPoint]->GetDomain())
-				node[iPoint]->SetAuxVarGradient(iDim, product);
-		}
 	}
   
-	delete [] cvector;
-  
 }
 
-void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
-	unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
-	unsigned short iVar, iDim, iMarker;
-	double *Solution_Vertex, *Solution_i, *Solution_j, Solution_Average, **Gradient, DualArea,
-	Partial_Res, Grad_Val, *Normal;
-	
-	/*--- Set Gradient to Zero ---*/
-	for(iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
-		node[iPoint]->SetGradientZero();
+void CSolver::SetSolution_Gradient_GG_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
   
-	/*--- Loop interior edges ---*/
-	for(iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CGeometry *geometry = loop->geometry;
+  CVariable **node = loop->solver->node;
+  unsigned short iVar, iDim, nVar = loop->solver->nVar, nDim = loop->solver->nDim;
+  unsigned long iEdge, iPoint, jPoint;
+  double *Solution_i, *Solution_j, Solution_Average, Partial_Res, *Normal;
+  
+	for(iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
 		iPoint = geometry->edge[iEdge]->GetNode(0);
 		jPoint = geometry->edge[iEdge]->GetNode(1);
     
@@ -428,6 +459,24 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
 		}
 	}
   
+}
+
+void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
+	unsigned long Point = 0, iPoint = 0, iVertex;
+	unsigned short iVar, iDim, iMarker;
+	double *Solution_Vertex, **Gradient, DualArea,
+	Partial_Res, Grad_Val, *Normal;
+	
+	/*--- Set Gradient to Zero ---*/
+  if (Variable_Storage != NULL)
+    Variable_Storage->SetField_Zero(FIELD_GRADIENT, geometry->GetnPointDomain());
+  else
+    for(iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+      node[iPoint]->SetGradientZero();
+  
+	/*--- Loop interior edges ---*/
+  Run_EdgeLoop(SetSolution_Gradient_GG_Thread, geometry, NULL, NULL, config, MESH_0);
+  
 	/*--- Loop boundary edges ---*/
 	for(iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
 		for(iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
@@ -457,139 +506,50 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
 
 void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
   
-	unsigned short iDim, jDim, iVar, iNeigh;
+	unsigned short iDim, iVar, iNeigh;
 	unsigned long iPoint, jPoint;
-	double *Coord_i, *Coord_j, *Solution_i, *Solution_j,
-	r11, r12, r13, r22, r23, r23_a, r23_b, r33, weight, detR2, z11, z12, z13,
-	z22, z23, z33, product;
-  bool singular = false;
+	double *Solution_i, *Solution_j, *Coeff, Delta;
   
-	double **cvector = new double* [nVar];
+	double **Grad = new double* [nVar];
 	for (iVar = 0; iVar < nVar; iVar++)
-		cvector[iVar] = new double [nDim];
+		Grad[iVar] = new double [nDim];
+  
+  /*--- Coefficients of the least squares gradients (computed once per grid) ---*/
+  
+  geometry->SetLS_Coeff();
   
 	/*--- Loop over points of the grid ---*/
   
 	for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
     
-    /*--- Get coordinates ---*/
-    
-		Coord_i = geometry->node[iPoint]->GetCoord();
-    
-    /*--- Get consevative solution ---*/
-    
 		Solution_i = node[iPoint]->GetSolution();
-    
-		/*--- Inizialization of variables ---*/
+    Coeff = geometry->GetLS_Coeff(iPoint);
     
 		for (iVar = 0; iVar < nVar; iVar++)
 			for (iDim = 0; iDim < nDim; iDim++)
-				cvector[iVar][iDim] = 0.0;
-    
-		r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
-    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
+				Grad[iVar][iDim] = 0.0;
     
 		for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
 			jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-			Coord_j = geometry->node[jPoint]->GetCoord();
-      
 			Solution_j = node[jPoint]->GetSolution();
-      
-			weight = 0.0;
-			for (iDim = 0; iDim < nDim; iDim++)
-				weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-      
-			/*--- Sumations for entries of upper triangular matrix R ---*/
-      
-      if (fabs(weight) > EPS){
-        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
-        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
-        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
-        if (nDim == 3) {
-          r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
-        }
-        
-        /*--- Entries of c:= transpose(A)*b ---*/
-        
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            cvector[iVar][iDim] += (Coord_j[iDim]-Coord_i[iDim])*(Solution_j[iVar]-Solution_i[iVar])/weight;
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Delta = Solution_j[iVar]-Solution_i[iVar];
+        for (iDim = 0; iDim < nDim; iDim++)
+          Grad[iVar][iDim] += Coeff[iNeigh*nDim+iDim]*Delta;
       }
-      
-		}
-    
-		/*--- Entries of upper triangular matrix R ---*/
-    
-    if (fabs(r11) < EPS) r11 = EPS;
-		r11 = sqrt(r11);
-		r12 = r12/(r11);
-		r22 = sqrt(r22-r12*r12);
-    if (fabs(r22) < EPS) r22 = EPS;
-		if (nDim == 3) {
-			r13 = r13/(r11);
-			r23 = r23_a/(r22) - r23_b*r12/(r11*r22);
-			r33 = sqrt(r33-r23*r23-r13*r13);
 		}
     
-    /*--- Compute determinant ---*/
-    
-    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
-    else detR2 = (r11*r22*r33)*(r11*r22*r33);
-    
-    /*--- Detect singular matrices ---*/
-    
-    if (fabs(detR2) < EPS) singular = true;
-    
-		/*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-    
-    if (singular) {
-      for (iDim = 0; iDim < nDim; iDim++)
-        for (jDim = 0; jDim < nDim; jDim++)
-          Smatrix[iDim][jDim] = 0.0;
-    }
-    else {
-      if (nDim == 2) {
-        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-        Smatrix[0][1] = -r11*r12/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = r11*r11/detR2;
-      }
-      else {
-        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
-        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
-        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-        Smatrix[0][2] = (z13*z33)/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-        Smatrix[1][2] = (z23*z33)/detR2;
-        Smatrix[2][0] = Smatrix[0][2];
-        Smatrix[2][1] = Smatrix[1][2];
-        Smatrix[2][2] = (z33*z33)/detR2;
-      }
-    }
-    
-		/*--- Computation of the gradient: S*c ---*/
-    
-		for (iVar = 0; iVar < nVar; iVar++) {
-			for (iDim = 0; iDim < nDim; iDim++) {
-				product = 0.0;
-				for (jDim = 0; jDim < nDim; jDim++)
-					product += Smatrix[iDim][jDim]*cvector[iVar][jDim];
-				node[iPoint]->SetGradient(iVar,iDim,product);
-			}
-		}
+		for (iVar = 0; iVar < nVar; iVar++)
+			for (iDim = 0; iDim < nDim; iDim++)
+				node[iPoint]->SetGradient(iVar, iDim, Grad[iVar][iDim]);
     
 	}
   
 	/*--- Deallocate memory ---*/
   
 	for (iVar = 0; iVar < nVar; iVar++)
-		delete [] cvector[iVar];
-	delete [] cvector;
+		delete [] Grad[iVar];
+	delete [] Grad;
   
 }
 
@@ -949,23 +909,16 @@ void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
 	delete [] Smatrix;
 }
 
-void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
-  
-	unsigned long iEdge, iPoint, jPoint;
-	unsigned short iVar, iDim;
-	double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j, *Solution_i, *Solution_j,
-	dave, LimK, eps2, dm, dp, du, limiter;
+void CSolver::SetSolution_Limiter_Bounds_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
   
-	/*--- Initialize solution max and solution min in the entire domain --*/
-	for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-		for (iVar = 0; iVar < nVar; iVar++) {
-			node[iPoint]->SetSolution_Max(iVar, -EPS);
-			node[iPoint]->SetSolution_Min(iVar, EPS);
-		}
-	}
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CGeometry *geometry = loop->geometry;
+  CVariable **node = loop->solver->node;
+  unsigned short iVar, nVar = loop->solver->nVar;
+  unsigned long iEdge, iPoint, jPoint;
+  double *Solution_i, *Solution_j, du;
   
-	/*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
-	for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+	for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
 		
 		/*--- Point identification, Normal vector and area ---*/
 		iPoint = geometry->edge[iEdge]->GetNode(0);
@@ -985,26 +938,28 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
 		}
 	}
   
-	/*--- Initialize the limiter --*/
-	for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
-		for (iVar = 0; iVar < nVar; iVar++) {
-			node[iPoint]->SetLimiter(iVar, 2.0);
-		}
-	}
-	 
-  /*--- Venkatakrishnan (Venkatakrishnan 1994) limiter ---*/
+}
+
+void CSolver::SetSolution_Limiter_Thread(void *data, unsigned short iThread, unsigned long iEdge_begin, unsigned long iEdge_end) {
+  
+  CSolver_Loop *loop = (CSolver_Loop *)data;
+  CGeometry *geometry = loop->geometry;
+  CConfig *config = loop->config;
+  CVariable **node = loop->solver->node;
+  unsigned short iVar, iDim, nVar = loop->solver->nVar, nDim = loop->solver->nDim;
+  unsigned long iEdge, iPoint, jPoint;
+  double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j,
+  dave, LimK, eps2, dm, dp, limiter;
   
   /*-- Get limiter parameters from the configuration file ---*/
   dave = config->GetRefElemLength();
   LimK = config->GetLimiterCoeff();
   eps2 = (LimK*dave)*(LimK*dave)*(LimK*dave);
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  for (iEdge = iEdge_begin; iEdge < iEdge_end; iEdge++) {
     
     iPoint     = geometry->edge[iEdge]->GetNode(0);
     jPoint     = geometry->edge[iEdge]->GetNode(1);
-    Solution_i = node[iPoint]->GetSolution();
-    Solution_j = node[jPoint]->GetSolution();
     Gradient_i = node[iPoint]->GetGradient();
     Gradient_j = node[jPoint]->GetGradient();
     Coord_i    = geometry->node[iPoint]->GetCoord();
@@ -1040,6 +995,35 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
       if (geometry->node[jPoint]->GetDomain()) node[jPoint]->SetLimiter(iVar, limiter);
     }
   }
+  
+}
+
+void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
+  
+	unsigned long iPoint;
+	unsigned short iVar;
+  
+	/*--- Initialize solution max and solution min in the entire domain --*/
+	for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+		for (iVar = 0; iVar < nVar; iVar++) {
+			node[iPoint]->SetSolution_Max(iVar, -EPS);
+			node[iPoint]->SetSolution_Min(iVar, EPS);
+		}
+	}
+  
+	/*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
+  Run_EdgeLoop(SetSolution_Limiter_Bounds_Thread, geometry, NULL, NULL, config, MESH_0);
+  
+	/*--- Initialize the limiter --*/
+	for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+		for (iVar = 0; iVar < nVar; iVar++) {
+			node[iPoint]->SetLimiter(iVar, 2.0);
+		}
+	}
+	 
+  /*--- Venkatakrishnan (Venkatakrishnan 1994) limiter ---*/
+  
+  Run_EdgeLoop(SetSolution_Limiter_Thread, geometry, NULL, NULL, config, MESH_0);
 	
 }
 
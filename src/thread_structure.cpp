@@ -0,0 +1,197 @@
+/*!
+ * \file thread_structure.cpp
+ * \brief Main subroutines of the shared memory thread pool.
+ * \author Aerospace Design Laboratory (Stanford University).
+ * \version 1.2.0
+ *
+ * SU2 EDU, Copyright (C) 2014 Aerospace Design Laboratory (Stanford University).
+ *
+ * SU2 EDU is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 EDU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2 EDU. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/thread_structure.hpp"
+
+unsigned short CThreadPool::nThread = 1;
+pthread_t *CThreadPool::Threads = NULL;
+pthread_mutex_t CThreadPool::Mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t CThreadPool::Cond_Start = PTHREAD_COND_INITIALIZER;
+pthread_cond_t CThreadPool::Cond_Done = PTHREAD_COND_INITIALIZER;
+pthread_cond_t CThreadPool::Cond_Barrier = PTHREAD_COND_INITIALIZER;
+unsigned long CThreadPool::Generation = 0;
+unsigned short CThreadPool::nBusy = 0;
+unsigned short CThreadPool::nBarrier = 0;
+unsigned long CThreadPool::Barrier_Generation = 0;
+bool CThreadPool::Running = false;
+bool CThreadPool::Stop = false;
+CThreadPool::Kernel CThreadPool::Job = NULL;
+void *CThreadPool::Job_Data = NULL;
+
+void CThreadPool::Initialize(unsigned short val_nThread) {
+
+  unsigned short iThread;
+  char *env_nThread;
+
+  /*--- Restart the pool if it was already running ---*/
+
+  Finalize();
+
+  /*--- The config option has priority over the environment variable ---*/
+
+  if (val_nThread == 0) {
+    val_nThread = 1;
+    env_nThread = getenv("SU2_NUM_THREADS");
+    if ((env_nThread != NULL) && (atoi(env_nThread) > 0))
+      val_nThread = (unsigned short)atoi(env_nThread);
+  }
+  nThread = val_nThread;
+
+  /*--- The calling thread is thread 0, only nThread-1 workers are created. They start
+   from generation 0, so a job launched before a worker gets the mutex is not missed ---*/
+
+  Stop = false;
+  Generation = 0;
+  if (nThread > 1) {
+    Threads = new pthread_t [nThread-1];
+    for (iThread = 1; iThread < nThread; iThread++) {
+      if (pthread_create(&Threads[iThread-1], NULL, Worker, (void *)(size_t)iThread) != 0) {
+        cerr << "CThreadPool::Initialize: unable to create thread " << iThread << "." << endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+  }
+
+}
+
+void CThreadPool::Finalize(void) {
+
+  unsigned short iThread;
+
+  if (Threads == NULL) return;
+
+  pthread_mutex_lock(&Mutex);
+  Stop = true;
+  pthread_cond_broadcast(&Cond_Start);
+  pthread_mutex_unlock(&Mutex);
+
+  for (iThread = 1; iThread < nThread; iThread++)
+    pthread_join(Threads[iThread-1], NULL);
+
+  delete [] Threads;
+  Threads = NULL;
+  nThread = 1;
+
+}
+
+unsigned short CThreadPool::GetnThread(void) { return nThread; }
+
+void CThreadPool::Run(Kernel kernel, void *data, unsigned long nWork) {
+
+  /*--- Small jobs, and jobs launched from inside another job, are serial ---*/
+
+  if ((nThread == 1) || (nWork < THREAD_MIN_WORK) || Running) {
+    kernel(data, 0, 1);
+    return;
+  }
+
+  pthread_mutex_lock(&Mutex);
+  Running = true;
+  Job = kernel; Job_Data = data;
+  nBusy = nThread-1;
+  Generation++;
+  pthread_cond_broadcast(&Cond_Start);
+  pthread_mutex_unlock(&Mutex);
+
+  /*--- The calling thread does its own chunk ---*/
+
+  kernel(data, 0, nThread);
+
+  pthread_mutex_lock(&Mutex);
+  while (nBusy > 0) pthread_cond_wait(&Cond_Done, &Mutex);
+  Running = false;
+  pthread_mutex_unlock(&Mutex);
+
+}
+
+void CThreadPool::GetChunk(unsigned long nItem, unsigned short val_iThread, unsigned short val_nThread,
+                           unsigned long & begin, unsigned long & end) {
+
+  /*--- The first (nItem % val_nThread) chunks have one more item ---*/
+
+  unsigned long size = nItem/val_nThread, rest = nItem%val_nThread;
+
+  begin = val_iThread*size + (val_iThread < rest ? val_iThread : rest);
+  end = begin + size + (val_iThread < rest ? 1 : 0);
+
+}
+
+void CThreadPool::Barrier(unsigned short val_nThread) {
+
+  unsigned long MyGeneration;
+
+  if (val_nThread == 1) return;
+
+  /*--- The last thread releases the others, the generation counter protects
+   against spurious wakeups and against threads that reach the next barrier first ---*/
+
+  pthread_mutex_lock(&Mutex);
+  MyGeneration = Barrier_Generation;
+  nBarrier++;
+  if (nBarrier == val_nThread) {
+    nBarrier = 0;
+    Barrier_Generation++;
+    pthread_cond_broadcast(&Cond_Barrier);
+  }
+  else {
+    while (Barrier_Generation == MyGeneration)
+      pthread_cond_wait(&Cond_Barrier, &Mutex);
+  }
+  pthread_mutex_unlock(&Mutex);
+
+}
+
+void *CThreadPool::Worker(void *arg) {
+
+  unsigned short iThread = (unsigned short)(size_t)arg;
+  unsigned long MyGeneration;
+  Kernel MyJob;
+  void *MyData;
+
+  pthread_mutex_lock(&Mutex);
+  MyGeneration = 0;
+
+  while (true) {
+
+    /*--- Sleep until there is a new job (or the pool is stopped) ---*/
+
+    while ((Generation == MyGeneration) && (!Stop))
+      pthread_cond_wait(&Cond_Start, &Mutex);
+    if (Stop) break;
+
+    MyGeneration = Generation;
+    MyJob = Job; MyData = Job_Data;
+    pthread_mutex_unlock(&Mutex);
+
+    MyJob(MyData, iThread, nThread);
+
+    pthread_mutex_lock(&Mutex);
+    nBusy--;
+    if (nBusy == 0) pthread_cond_signal(&Cond_Done);
+
+  }
+
+  pthread_mutex_unlock(&Mutex);
+
+  return NULL;
+
+}
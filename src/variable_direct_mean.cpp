@@ -305,6 +305,20 @@ CEulerVariable::~CEulerVariable(void) {
   
 }
 
+void CEulerVariable::SetStorage(CVariableStorage *storage) {
+  
+  CVariable::SetStorage(storage);
+  storage->SetField(FIELD_SOLUTION_MAX, Solution_Max, nPrimVarGrad);
+  storage->SetField(FIELD_SOLUTION_MIN, Solution_Min, nPrimVarGrad);
+  storage->SetField(FIELD_TS_SOURCE, TS_Source, nVar);
+  storage->SetField(FIELD_WIND_GUST, WindGust, nDim);
+  storage->SetField(FIELD_WIND_GUST_DER, WindGustDer, nDim+1);
+  storage->SetField(FIELD_PRIMITIVE, Primitive, nPrimVar);
+  storage->SetField(FIELD_GRADIENT_PRIMITIVE, Gradient_Primitive, nPrimVarGrad, nDim);
+  storage->SetField(FIELD_LIMITER_PRIMITIVE, Limiter_Primitive, nPrimVarGrad);
+  
+}
+
 void CEulerVariable::SetGradient_PrimitiveZero(unsigned short val_primvar) {
 	unsigned short iVar, iDim;
   
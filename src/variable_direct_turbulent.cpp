@@ -49,6 +49,14 @@ CTurbVariable::~CTurbVariable(void) {
   
 }
 
+void CTurbVariable::SetStorage(CVariableStorage *storage) {
+  
+  CVariable::SetStorage(storage);
+  storage->SetField(FIELD_SOLUTION_MAX, Solution_Max, nVar);
+  storage->SetField(FIELD_SOLUTION_MIN, Solution_Min, nVar);
+  
+}
+
 double CTurbVariable::GetmuT(){ return muT; }
 
 void CTurbVariable::SetmuT(double val_muT){ muT = val_muT; }
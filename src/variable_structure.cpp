@@ -146,6 +146,24 @@ CVariable::~CVariable(void) {
 
 }
 
+void CVariable::SetStorage(CVariableStorage *storage) {
+  
+  /*--- Arrays of the base class, the extrema of the limiters depend on the derived class ---*/
+  
+  storage->SetField(FIELD_SOLUTION, Solution, nVar);
+  storage->SetField(FIELD_SOLUTION_OLD, Solution_Old, nVar);
+  storage->SetField(FIELD_SOLUTION_TIME_N, Solution_time_n, nVar);
+  storage->SetField(FIELD_SOLUTION_TIME_N1, Solution_time_n1, nVar);
+  storage->SetField(FIELD_GRADIENT, Gradient, nVar, nDim);
+  storage->SetField(FIELD_LIMITER, Limiter, nVar);
+  storage->SetField(FIELD_GRAD_AUXVAR, Grad_AuxVar, nDim);
+  storage->SetField(FIELD_UNDIVIDED_LAPLACIAN, Undivided_Laplacian, nVar);
+  storage->SetField(FIELD_RES_TRUNC_ERROR, Res_TruncError, nVar);
+  storage->SetField(FIELD_RESIDUAL_OLD, Residual_Old, nVar);
+  storage->SetField(FIELD_RESIDUAL_SUM, Residual_Sum, nVar);
+  
+}
+
 void CVariable::AddUnd_Lapl(double *val_und_lapl) {
 	for (unsigned short iVar = 0; iVar < nVar; iVar++)
 		Undivided_Laplacian[iVar] += val_und_lapl[iVar];
@@ -385,3 +403,164 @@ CBaselineVariable::CBaselineVariable(double *val_solution, unsigned short val_nV
 }
 
 CBaselineVariable::~CBaselineVariable(void) { }
+
+/*--- The fields are aligned to the cache lines, like the values of the matrices ---*/
+
+static double *VariableStorage_Allocate(unsigned long nElm) {
+  
+  void *ptr = NULL;
+  unsigned long nByte = max(nElm*sizeof(double), (unsigned long)VARIABLE_ALIGNMENT);
+  
+  if (posix_memalign(&ptr, VARIABLE_ALIGNMENT, nByte) != 0) {
+    cerr << "CVariableStorage: unable to allocate " << nElm << " values." << endl;
+    exit(1);
+  }
+  return (double *)ptr;
+  
+}
+
+CVariableStorage::CVariableStorage(unsigned long val_nPoint) {
+  
+  unsigned short iField;
+  
+  nPoint = val_nPoint;
+  iPoint = 0;
+  Release_Fields = false;
+  
+  for (iField = 0; iField < MAX_FIELDS; iField++) {
+    Field[iField] = NULL;
+    Field_Row[iField] = NULL;
+    Field_Size[iField] = 0;
+    Field_nRow[iField] = 0;
+  }
+  
+}
+
+CVariableStorage::~CVariableStorage(void) {
+  
+  unsigned short iField;
+  
+  for (iField = 0; iField < MAX_FIELDS; iField++) {
+    if (Field[iField] != NULL) free(Field[iField]);
+    if (Field_Row[iField] != NULL) delete [] Field_Row[iField];
+  }
+  
+}
+
+void CVariableStorage::Gather(CVariable **node) {
+  
+  Release_Fields = false;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetStorage(this);
+  
+}
+
+void CVariableStorage::Release(CVariable **node) {
+  
+  Release_Fields = true;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetStorage(this);
+  Release_Fields = false;
+  
+}
+
+void CVariableStorage::SetField(unsigned short val_field, double *&val_array, unsigned short val_size) {
+  
+  unsigned short iVar;
+  double *Values;
+  
+  if (Release_Fields) {
+    if (Field[val_field] != NULL) val_array = NULL;
+    return;
+  }
+  
+  /*--- The first point sets the size of the field, the other ones must agree ---*/
+  
+  if ((iPoint == 0) && (val_array != NULL)) {
+    Field[val_field] = VariableStorage_Allocate(nPoint*val_size);
+    Field_Size[val_field] = val_size;
+    Field_nRow[val_field] = 1;
+  }
+  
+  if ((val_array == NULL) != (Field[val_field] == NULL) ||
+      ((val_array != NULL) && ((Field_Size[val_field] != val_size) || (Field_nRow[val_field] != 1)))) {
+    cerr << "CVariableStorage::SetField: the field " << val_field << " of the point " << iPoint
+    << " doesn't match the one of the first point." << endl;
+    exit(1);
+  }
+  
+  if (val_array == NULL) return;
+  
+  Values = &Field[val_field][iPoint*val_size];
+  for (iVar = 0; iVar < val_size; iVar++)
+    Values[iVar] = val_array[iVar];
+  delete [] val_array;
+  val_array = Values;
+  
+}
+
+void CVariableStorage::SetField(unsigned short val_field, double **&val_array, unsigned short val_nRow, unsigned short val_nCol) {
+  
+  unsigned short iRow, iCol;
+  double **Rows;
+  
+  if (Release_Fields) {
+    if (Field[val_field] != NULL) val_array = NULL;
+    return;
+  }
+  
+  if ((iPoint == 0) && (val_array != NULL)) {
+    Field[val_field] = VariableStorage_Allocate(nPoint*val_nRow*val_nCol);
+    Field_Row[val_field] = new double* [nPoint*val_nRow];
+    Field_Size[val_field] = val_nRow*val_nCol;
+    Field_nRow[val_field] = val_nRow;
+  }
+  
+  if ((val_array == NULL) != (Field[val_field] == NULL) ||
+      ((val_array != NULL) && ((Field_Size[val_field] != val_nRow*val_nCol) || (Field_nRow[val_field] != val_nRow)))) {
+    cerr << "CVariableStorage::SetField: the field " << val_field << " of the point " << iPoint
+    << " doesn't match the one of the first point." << endl;
+    exit(1);
+  }
+  
+  if (val_array == NULL) return;
+  
+  /*--- The rows of the point are consecutive, so the whole gradient of a point is one block ---*/
+  
+  Rows = &Field_Row[val_field][iPoint*val_nRow];
+  for (iRow = 0; iRow < val_nRow; iRow++) {
+    Rows[iRow] = &Field[val_field][(iPoint*val_nRow+iRow)*val_nCol];
+    for (iCol = 0; iCol < val_nCol; iCol++)
+      Rows[iRow][iCol] = val_array[iRow][iCol];
+    delete [] val_array[iRow];
+  }
+  delete [] val_array;
+  val_array = Rows;
+  
+}
+
+void CVariableStorage::SetField_Zero(unsigned short val_field, unsigned long val_nPoint) {
+  
+  unsigned long iElm, nElm = val_nPoint*Field_Size[val_field];
+  double *Values = Field[val_field];
+  
+  for (iElm = 0; iElm < nElm; iElm++)
+    Values[iElm] = 0.0;
+  
+}
+
+void CVariableStorage::CopyField(unsigned short val_source, unsigned short val_target, unsigned long val_nPoint) {
+  
+  unsigned long iElm, nElm = val_nPoint*Field_Size[val_source];
+  double *Source = Field[val_source], *Target = Field[val_target];
+  
+  if (Field_Size[val_source] != Field_Size[val_target]) {
+    cerr << "CVariableStorage::CopyField: the fields " << val_source << " and " << val_target
+    << " have different sizes." << endl;
+    exit(1);
+  }
+  
+  for (iElm = 0; iElm < nElm; iElm++)
+    Target[iElm] = Source[iElm];
+  
+}
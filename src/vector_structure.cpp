@@ -22,6 +22,162 @@
 
 #include "../include/vector_structure.hpp"
 
+/*--- Threaded loops of the class, each thread works on the same static chunk
+ of blocks of the vector (see CThreadPool::GetChunk) ---*/
+
+enum VECTOR_LOOP {
+  SET_VAL,          /*!< \brief u = a */
+  COPY,             /*!< \brief u = x */
+  SCALE,            /*!< \brief u = a*u */
+  DIVIDE,           /*!< \brief u = u/a */
+  PLUS,             /*!< \brief u = u + x */
+  MINUS,            /*!< \brief u = u - x */
+  EQUALS_AX,        /*!< \brief u = a*x */
+  PLUS_AX,          /*!< \brief u = u + a*x */
+  EQUALS_AX_PLUS_BY /*!< \brief u = a*x + b*y */
+};
+
+struct CSysVector_Loop {
+  VECTOR_LOOP kind;
+  double *u;
+  const double *x, *y;
+  double a, b;
+  unsigned long nBlk;
+  unsigned short nVar;
+};
+
+static void SysVector_Loop_Kernel(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CSysVector_Loop *loop = (CSysVector_Loop *)data;
+  unsigned long i, begin, end;
+  double *u = loop->u, a = loop->a, b = loop->b;
+  const double *x = loop->x, *y = loop->y;
+  
+  CThreadPool::GetChunk(loop->nBlk, iThread, nThread, begin, end);
+  begin *= loop->nVar; end *= loop->nVar;
+  
+  switch (loop->kind) {
+    case SET_VAL:           for (i = begin; i < end; i++) u[i] = a; break;
+    case COPY:              for (i = begin; i < end; i++) u[i] = x[i]; break;
+    case SCALE:             for (i = begin; i < end; i++) u[i] *= a; break;
+    case DIVIDE:            for (i = begin; i < end; i++) u[i] /= a; break;
+    case PLUS:              for (i = begin; i < end; i++) u[i] += x[i]; break;
+    case MINUS:             for (i = begin; i < end; i++) u[i] -= x[i]; break;
+    case EQUALS_AX:         for (i = begin; i < end; i++) u[i] = a * x[i]; break;
+    case PLUS_AX:           for (i = begin; i < end; i++) u[i] += a * x[i]; break;
+    case EQUALS_AX_PLUS_BY: for (i = begin; i < end; i++) u[i] = a * x[i] + b * y[i]; break;
+  }
+  
+}
+
+static void SysVector_Loop(VECTOR_LOOP kind, double *u, unsigned long nBlk, unsigned short nVar,
+                           double a = 0.0, const double *x = NULL, double b = 0.0, const double *y = NULL) {
+  
+  CSysVector_Loop loop;
+  loop.kind = kind; loop.u = u; loop.x = x; loop.y = y;
+  loop.a = a; loop.b = b; loop.nBlk = nBlk; loop.nVar = nVar;
+  
+  CThreadPool::Run(SysVector_Loop_Kernel, &loop, nBlk*nVar);
+  
+}
+
+struct CSysVector_DotProd {
+  const double *u, *v;
+  unsigned long nElm;
+  double *partial;
+};
+
+static void SysVector_DotProd_Kernel(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CSysVector_DotProd *dot = (CSysVector_DotProd *)data;
+  unsigned long i, iChunk, begin, end, last, nChunk = (dot->nElm+REDUCTION_SIZE-1)/REDUCTION_SIZE;
+  double sum;
+  
+  /*--- The partial sums are always over the same entries, whatever the number of threads ---*/
+  
+  CThreadPool::GetChunk(nChunk, iThread, nThread, begin, end);
+  for (iChunk = begin; iChunk < end; iChunk++) {
+    last = (iChunk+1)*REDUCTION_SIZE;
+    if (last > dot->nElm) last = dot->nElm;
+    sum = 0.0;
+    for (i = iChunk*REDUCTION_SIZE; i < last; i++)
+      sum += dot->u[i]*dot->v[i];
+    dot->partial[iChunk] = sum;
+  }
+  
+}
+
+/*--- Fused kernels of the block Gram-Schmidt orthogonalization, each chunk of
+ REDUCTION_SIZE values of u is loaded once and reused from the L1 cache for
+ all the vectors v[k] ---*/
+
+struct CSysVector_Multi {
+  double *u;
+  const double * const *v;
+  const double *a;
+  unsigned long nVec, nElm;
+  double *partial;
+};
+
+static void SysVector_MultiDotProd_Kernel(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CSysVector_Multi *dot = (CSysVector_Multi *)data;
+  unsigned long i, k, iChunk, begin, end, first, last, nChunk = (dot->nElm+REDUCTION_SIZE-1)/REDUCTION_SIZE;
+  const double *u = dot->u, *v;
+  double sum;
+  
+  /*--- Same fixed partial sums as dotProd, so (u,v[k]) is the same value ---*/
+  
+  CThreadPool::GetChunk(nChunk, iThread, nThread, begin, end);
+  for (iChunk = begin; iChunk < end; iChunk++) {
+    first = iChunk*REDUCTION_SIZE;
+    last = first+REDUCTION_SIZE;
+    if (last > dot->nElm) last = dot->nElm;
+    for (k = 0; k < dot->nVec; k++) {
+      v = dot->v[k]; sum = 0.0;
+      for (i = first; i < last; i++)
+        sum += u[i]*v[i];
+      dot->partial[iChunk*dot->nVec+k] = sum;
+    }
+  }
+  
+}
+
+static void SysVector_Multi_AX_Kernel(void *data, unsigned short iThread, unsigned short nThread) {
+  
+  CSysVector_Multi *loop = (CSysVector_Multi *)data;
+  unsigned long i, k, begin, end, first, last;
+  double *u = loop->u, a;
+  const double *v;
+  
+  CThreadPool::GetChunk(loop->nElm, iThread, nThread, begin, end);
+  for (first = begin; first < end; first += REDUCTION_SIZE) {
+    last = first+REDUCTION_SIZE;
+    if (last > end) last = end;
+    for (k = 0; k < loop->nVec; k++) {
+      v = loop->v[k]; a = loop->a[k];
+      for (i = first; i < last; i++)
+        u[i] += a*v[i];
+    }
+  }
+  
+}
+
+/*--- The values are aligned to the cache lines, so the threaded chunks
+ and the SIMD loads don't straddle them ---*/
+
+static double *SysVector_Allocate(unsigned long nElm) {
+  
+  void *ptr = NULL;
+  
+  if (posix_memalign(&ptr, VECTOR_ALIGNMENT, nElm*sizeof(double)) != 0) {
+    cerr << "CSysVector: unable to allocate " << nElm << " values." << endl;
+    throw(-1);
+  }
+  return (double *)ptr;
+  
+}
+
 CSysVector::CSysVector(void) {
   
   vec_val = NULL;
@@ -41,9 +197,8 @@ CSysVector::CSysVector(const unsigned long & size, const double & val) {
     throw(-1);
   }
 
-  vec_val = new double[nElm];
-  for (unsigned int i = 0; i < nElm; i++)
-    vec_val[i] = val;
+  vec_val = SysVector_Allocate(nElm);
+  SysVector_Loop(SET_VAL, vec_val, nBlk, nVar, val);
   
 }
 
@@ -61,9 +216,8 @@ CSysVector::CSysVector(const unsigned long & numBlk, const unsigned long & numBl
     throw(-1);
   }
 	
-  vec_val = new double[nElm];
-  for (unsigned int i = 0; i < nElm; i++)
-    vec_val[i] = val;
+  vec_val = SysVector_Allocate(nElm);
+  SysVector_Loop(SET_VAL, vec_val, nBlk, nVar, val);
   
 }
 
@@ -74,9 +228,8 @@ CSysVector::CSysVector(const CSysVector & u) {
   nBlk = u.nBlk; nBlkDomain = u.nBlkDomain;
   nVar = u.nVar;
   
-  vec_val = new double[nElm];
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] = u.vec_val[i];
+  vec_val = SysVector_Allocate(nElm);
+  SysVector_Loop(COPY, vec_val, nBlk, nVar, 0.0, u.vec_val);
   
 }
 
@@ -93,9 +246,8 @@ CSysVector::CSysVector(const unsigned long & size, const double* u_array) {
     throw(-1);
   }
 
-  vec_val = new double[nElm];
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] = u_array[i];
+  vec_val = SysVector_Allocate(nElm);
+  SysVector_Loop(COPY, vec_val, nBlk, nVar, 0.0, u_array);
   
 }
 
@@ -113,14 +265,14 @@ CSysVector::CSysVector(const unsigned long & numBlk, const unsigned long & numBl
     throw(-1);
   }
 
-  vec_val = new double[nElm];
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] = u_array[i];
+  vec_val = SysVector_Allocate(nElm);
+  SysVector_Loop(COPY, vec_val, nBlk, nVar, 0.0, u_array);
   
 }
 
 CSysVector::~CSysVector() {
-  delete [] vec_val;
+  free(vec_val);
+  vec_val = NULL;
   nElm = -1;
 	nElmDomain = -1;
   nBlk = -1;
@@ -141,9 +293,8 @@ void CSysVector::Initialize(const unsigned long & numBlk, const unsigned long &
     throw(-1);
   }
 	
-  vec_val = new double[nElm];
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] = val;
+  vec_val = SysVector_Allocate(nElm);
+  SysVector_Loop(SET_VAL, vec_val, nBlk, nVar, val);
   
 }
 
@@ -160,8 +311,7 @@ void CSysVector::Equals_AX(const double & a, CSysVector & x) {
     cerr << "CSysVector::Equals_AX(): " << "sizes do not match";
     throw(-1);
   }
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] = a * x.vec_val[i];
+  SysVector_Loop(EQUALS_AX, vec_val, nBlk, nVar, a, x.vec_val);
 }
 
 void CSysVector::Plus_AX(const double & a, CSysVector & x) {
@@ -170,8 +320,28 @@ void CSysVector::Plus_AX(const double & a, CSysVector & x) {
     cerr << "CSysVector::Plus_AX(): " << "sizes do not match";
     throw(-1);
   }
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] += a * x.vec_val[i];
+  SysVector_Loop(PLUS_AX, vec_val, nBlk, nVar, a, x.vec_val);
+}
+
+void CSysVector::Plus_Multi_AX(unsigned long nVec, const double *a, vector<CSysVector> & x) {
+  
+  CSysVector_Multi loop;
+  vector<const double *> ptr(nVec);
+  
+  /*--- check that *this and x are compatible ---*/
+  for (unsigned long k = 0; k < nVec; k++) {
+    if (nElm != x[k].nElm) {
+      cerr << "CSysVector::Plus_Multi_AX(): " << "sizes do not match";
+      throw(-1);
+    }
+    ptr[k] = x[k].vec_val;
+  }
+  if (nVec == 0) return;
+  
+  loop.u = vec_val; loop.v = &ptr[0]; loop.a = a;
+  loop.nVec = nVec; loop.nElm = nElm; loop.partial = NULL;
+  CThreadPool::Run(SysVector_Multi_AX_Kernel, &loop, nElm*nVec);
+  
 }
 
 void CSysVector::Equals_AX_Plus_BY(const double & a, CSysVector & x, const double & b, CSysVector & y) {
@@ -180,8 +350,7 @@ void CSysVector::Equals_AX_Plus_BY(const double & a, CSysVector & x, const doubl
     cerr << "CSysVector::Equals_AX_Plus_BY(): " << "sizes do not match";
     throw(-1);
   }
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] = a * x.vec_val[i] + b * y.vec_val[i];
+  SysVector_Loop(EQUALS_AX_PLUS_BY, vec_val, nBlk, nVar, a, x.vec_val, b, y.vec_val);
 }
 
 CSysVector & CSysVector::operator=(const CSysVector & u) {
@@ -189,7 +358,11 @@ CSysVector & CSysVector::operator=(const CSysVector & u) {
   /*--- check if self-assignment, otherwise perform deep copy ---*/
   if (this == &u) return *this;
   
-  delete [] vec_val; // in case the size is different
+  /*--- The storage is kept if the size is the same ---*/
+  if ((vec_val == NULL) || (nElm != u.nElm)) {
+    free(vec_val);
+    vec_val = SysVector_Allocate(u.nElm);
+  }
   nElm = u.nElm;
   nElmDomain = u.nElmDomain;
   
@@ -197,16 +370,13 @@ CSysVector & CSysVector::operator=(const CSysVector & u) {
 	nBlkDomain = u.nBlkDomain;
   
   nVar = u.nVar;
-  vec_val = new double[nElm];
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] = u.vec_val[i];
+  SysVector_Loop(COPY, vec_val, nBlk, nVar, 0.0, u.vec_val);
   
   return *this;
 }
 
 CSysVector & CSysVector::operator=(const double & val) {
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] = val;
+  SysVector_Loop(SET_VAL, vec_val, nBlk, nVar, val);
   return *this;
 }
 
@@ -225,8 +395,7 @@ CSysVector & CSysVector::operator+=(const CSysVector & u) {
     cerr << "CSysVector::operator+=(CSysVector): " << "sizes do not match";
     throw(-1);
   }
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] += u.vec_val[i];
+  SysVector_Loop(PLUS, vec_val, nBlk, nVar, 0.0, u.vec_val);
   return *this;
 }
 
@@ -245,8 +414,7 @@ CSysVector & CSysVector::operator-=(const CSysVector & u) {
     cerr << "CSysVector::operator-=(CSysVector): " << "sizes do not match";
     throw(-1);
   }
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] -= u.vec_val[i];
+  SysVector_Loop(MINUS, vec_val, nBlk, nVar, 0.0, u.vec_val);
   return *this;
 }
 
@@ -270,8 +438,7 @@ CSysVector operator*(const double & val, const CSysVector & u) {
 
 CSysVector & CSysVector::operator*=(const double & val) {
   
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] *= val;
+  SysVector_Loop(SCALE, vec_val, nBlk, nVar, val);
   return *this;
 }
 
@@ -286,8 +453,7 @@ CSysVector CSysVector::operator/(const double & val) const {
 
 CSysVector & CSysVector::operator/=(const double & val) {
   
-  for (unsigned long i = 0; i < nElm; i++)
-    vec_val[i] /= val;
+  SysVector_Loop(DIVIDE, vec_val, nBlk, nVar, val);
   return *this;
 }
 
@@ -363,10 +529,17 @@ double dotProd(const CSysVector & u, const CSysVector & v) {
   }
   
   /*--- find local inner product and, if a parallel run, sum over all
-   processors (we use nElemDomain instead of nElem) ---*/
+   processors (we use nElemDomain instead of nElem). The partial sums of the
+   threads are added in order, so the result is reproducible ---*/
+  CSysVector_DotProd dot;
+  unsigned long iChunk, nChunk = (u.nElmDomain+REDUCTION_SIZE-1)/REDUCTION_SIZE;
+  vector<double> partial(nChunk);
+  dot.u = u.vec_val; dot.v = v.vec_val; dot.nElm = u.nElmDomain; dot.partial = &partial[0];
+  if (nChunk > 0) CThreadPool::Run(SysVector_DotProd_Kernel, &dot, u.nElmDomain);
+  
   double loc_prod = 0.0;
-  for (unsigned long i = 0; i < u.nElmDomain; i++)
-    loc_prod += u.vec_val[i]*v.vec_val[i];
+  for (iChunk = 0; iChunk < nChunk; iChunk++)
+    loc_prod += partial[iChunk];
   double prod = 0.0;
   
   prod = loc_prod;
@@ -374,19 +547,74 @@ double dotProd(const CSysVector & u, const CSysVector & v) {
   return prod;
 }
 
+void multiDotProd(const CSysVector & u, unsigned long nVec, vector<CSysVector> & v, double *prod) {
+  
+  CSysVector_Multi dot;
+  vector<const double *> ptr(nVec);
+  unsigned long k, iChunk, nChunk = (u.nElmDomain+REDUCTION_SIZE-1)/REDUCTION_SIZE;
+  
+  /*--- check for consistent sizes ---*/
+  for (k = 0; k < nVec; k++) {
+    if (u.nElm != v[k].nElm) {
+      cerr << "CSysVector friend multiDotProd(CSysVector,vector<CSysVector>): "
+      << "CSysVector sizes do not match";
+      throw(-1);
+    }
+    ptr[k] = v[k].vec_val;
+    prod[k] = 0.0;
+  }
+  if ((nVec == 0) || (nChunk == 0)) return;
+  
+  /*--- The partial sums are added in order (as in dotProd) ---*/
+  vector<double> partial(nChunk*nVec);
+  dot.u = u.vec_val; dot.v = &ptr[0]; dot.a = NULL;
+  dot.nVec = nVec; dot.nElm = u.nElmDomain; dot.partial = &partial[0];
+  CThreadPool::Run(SysVector_MultiDotProd_Kernel, &dot, u.nElmDomain*nVec);
+  
+  for (iChunk = 0; iChunk < nChunk; iChunk++)
+    for (k = 0; k < nVec; k++)
+      prod[k] += partial[iChunk*nVec+k];
+  
+}
+
 void spVec_utils::csr_write(unsigned long nrows, double* values,
                             char* filename)
 {
-  FILE *fp=fopen(filename, "w");
-  fwrite(&(nrows), sizeof(nrows), 1, fp);
-  fwrite(values, sizeof(double), nrows, fp);
+  FILE *fp=fopen(filename, "wb");
+  csr_write(fp, nrows, values);
   fclose (fp);
 }
 
 void spVec_utils::bsr_write(unsigned short bdim, unsigned long nbrows, double* bvalues, char* filename)
 {
-  FILE *fp=fopen(filename, "w");
+  FILE *fp=fopen(filename, "wb");
+  bsr_write(fp, bdim, nbrows, bvalues);
+  fclose (fp);
+}
+
+void spVec_utils::csr_write(FILE *fp, unsigned long nrows, const double* values)
+{
+  bsr_write(fp, 1, nrows, values);
+}
+
+void spVec_utils::bsr_write(FILE *fp, unsigned short bdim, unsigned long nbrows, const double* bvalues)
+{
   fwrite(&(nbrows), sizeof(nbrows), 1, fp);
   fwrite(bvalues, sizeof(double), nbrows*bdim, fp);
-  fclose (fp);
+}
+
+void spVec_utils::csr_read(FILE *fp, unsigned long nrows, double* values)
+{
+  bsr_read(fp, 1, nrows, values);
+}
+
+void spVec_utils::bsr_read(FILE *fp, unsigned short bdim, unsigned long nbrows, double* bvalues)
+{
+  unsigned long nbrows_file = 0;
+  
+  if ((fread(&(nbrows_file), sizeof(nbrows_file), 1, fp) != 1) || (nbrows_file != nbrows) ||
+      (fread(bvalues, sizeof(double), nbrows*bdim, fp) != nbrows*bdim)) {
+    cerr << "spVec_utils::bsr_read: expected " << nbrows << " rows of size " << bdim << "." << endl;
+    throw(-1);
+  }
 }